@@ -22,6 +22,7 @@ struct [[nodiscard("unnecessary construction")]] GeneratorOptions
 	const bool verbose = false;
 	const bool stubs = false;
 	const bool noIntrospection = false;
+	const bool threadSafeResolvers = false;
 };
 
 class [[nodiscard("unnecessary construction")]] Generator
@@ -167,12 +167,61 @@ private:
 	ValidateType _variableType;
 };
 
+// ValidateExecutableSchema stores the Introspection schema information used by
+// ValidateExecutableVisitor. It does not change between queries and it is not modified after
+// construction, so a single instance can be shared by visitors running on any number of threads.
+class [[nodiscard("unnecessary construction")]] ValidateExecutableSchema
+{
+public:
+	GRAPHQLSERVICE_EXPORT explicit ValidateExecutableSchema(
+		std::shared_ptr<schema::Schema> schema);
+
+	using FieldTypes = internal::string_view_map<ValidateTypeField>;
+	using TypeFields = internal::string_view_map<FieldTypes>;
+	using InputFieldTypes = ValidateTypeFieldArguments;
+	using InputTypeFields = internal::string_view_map<InputFieldTypes>;
+	using EnumValues = internal::string_view_map<internal::string_view_set>;
+	using Directives = internal::string_view_map<ValidateDirective>;
+	using MatchingTypes = internal::string_view_map<internal::string_view_set>;
+	using ScalarTypes = internal::string_view_set;
+
+	[[nodiscard("unnecessary call")]] static constexpr bool isScalarType(
+		introspection::TypeKind kind);
+
+	[[nodiscard("unnecessary call")]] static ValidateTypeFieldArguments getArguments(
+		const std::vector<std::shared_ptr<const schema::InputValue>>& args);
+
+private:
+	friend class ValidateExecutableVisitor;
+	friend class ValidateQueryCost;
+
+	void addTypeFields(const ValidateType& type);
+
+	const std::shared_ptr<schema::Schema> _schema;
+
+	ValidateTypes _operationTypes;
+	ValidateTypes _types;
+	MatchingTypes _matchingTypes;
+	Directives _directives;
+	EnumValues _enumValues;
+	ScalarTypes _scalarTypes;
+
+	// These are expanded eagerly for every type in the schema so they never need to be updated
+	// while validating a query.
+	TypeFields _typeFields;
+	InputTypeFields _inputTypeFields;
+};
+
 // ValidateExecutableVisitor visits the AST and validates that it is executable against the service
-// schema.
+// schema. Each instance only holds the state for a single query, so it's cheap to construct one
+// for every call and the shared ValidateExecutableSchema does not need any synchronization.
 class [[nodiscard("unnecessary construction")]] ValidateExecutableVisitor
 {
 public:
-	GRAPHQLSERVICE_EXPORT ValidateExecutableVisitor(std::shared_ptr<schema::Schema> schema);
+	GRAPHQLSERVICE_EXPORT explicit ValidateExecutableVisitor(
+		std::shared_ptr<schema::Schema> schema);
+	GRAPHQLSERVICE_EXPORT explicit ValidateExecutableVisitor(
+		std::shared_ptr<const ValidateExecutableSchema> validationSchema) noexcept;
 
 	GRAPHQLSERVICE_EXPORT void visit(const peg::ast_node& root);
 
@@ -180,22 +229,16 @@ public:
 	getStructuredErrors();
 
 private:
-	[[nodiscard("unnecessary call")]] static ValidateTypeFieldArguments getArguments(
-		const std::vector<std::shared_ptr<const schema::InputValue>>& args);
-
-	using FieldTypes = internal::string_view_map<ValidateTypeField>;
-	using TypeFields = internal::string_view_map<FieldTypes>;
-	using InputFieldTypes = ValidateTypeFieldArguments;
-	using InputTypeFields = internal::string_view_map<InputFieldTypes>;
-	using EnumValues = internal::string_view_map<internal::string_view_set>;
-
-	[[nodiscard("unnecessary call")]] constexpr bool isScalarType(introspection::TypeKind kind);
+	using FieldTypes = ValidateExecutableSchema::FieldTypes;
+	using TypeFields = ValidateExecutableSchema::TypeFields;
+	using InputFieldTypes = ValidateExecutableSchema::InputFieldTypes;
+	using InputTypeFields = ValidateExecutableSchema::InputTypeFields;
 
 	[[nodiscard("unnecessary call")]] bool matchesScopedType(std::string_view name) const;
 
-	[[nodiscard("unnecessary call")]] TypeFields::const_iterator getScopedTypeFields();
+	[[nodiscard("unnecessary call")]] TypeFields::const_iterator getScopedTypeFields() const;
 	[[nodiscard("unnecessary call")]] InputTypeFields::const_iterator getInputTypeFields(
-		std::string_view name);
+		std::string_view name) const;
 	[[nodiscard("unnecessary call")]] static const ValidateType& getValidateFieldType(
 		const FieldTypes::mapped_type& value);
 	[[nodiscard("unnecessary call")]] static const ValidateType& getValidateFieldType(
@@ -228,27 +271,29 @@ private:
 		const schema_location& position,
 		const ValidateType& inputType);
 
-	const std::shared_ptr<schema::Schema> _schema;
+	// This is shared between every visitor for the same schema, it's never modified.
+	const std::shared_ptr<const ValidateExecutableSchema> _validationSchema;
+	const std::shared_ptr<schema::Schema>& _schema;
 	std::list<schema_error> _errors;
 
-	using Directives = internal::string_view_map<ValidateDirective>;
 	using AstNodeRef = std::reference_wrapper<const peg::ast_node>;
 	using ExecutableNodes = internal::string_view_map<AstNodeRef>;
 	using FragmentSet = internal::string_view_set;
-	using MatchingTypes = internal::string_view_map<internal::string_view_set>;
-	using ScalarTypes = internal::string_view_set;
 	using VariableDefinitions = internal::string_view_map<AstNodeRef>;
 	using VariableTypes = internal::string_view_map<ValidateArgument>;
 	using OperationVariables = std::optional<VariableTypes>;
 	using VariableSet = internal::string_view_set;
 
-	// These members store Introspection schema information which does not change between queries.
-	ValidateTypes _operationTypes;
-	ValidateTypes _types;
-	MatchingTypes _matchingTypes;
-	Directives _directives;
-	EnumValues _enumValues;
-	ScalarTypes _scalarTypes;
+	// These members borrow Introspection schema information which does not change between queries
+	// from the _validationSchema.
+	const ValidateTypes& _operationTypes;
+	const ValidateTypes& _types;
+	const ValidateExecutableSchema::MatchingTypes& _matchingTypes;
+	const ValidateExecutableSchema::Directives& _directives;
+	const ValidateExecutableSchema::EnumValues& _enumValues;
+	const ValidateExecutableSchema::ScalarTypes& _scalarTypes;
+	const TypeFields& _typeFields;
+	const InputTypeFields& _inputTypeFields;
 
 	// These members store information that's specific to a single query and changes every time we
 	// visit a new one. They must be reset in between queries.
@@ -264,12 +309,48 @@ private:
 	FragmentSet _fragmentStack;
 	size_t _fieldCount = 0;
 	size_t _introspectionFieldCount = 0;
-	TypeFields _typeFields;
-	InputTypeFields _inputTypeFields;
 	ValidateType _scopedType;
 	internal::string_view_map<ValidateField> _selectionFields;
 };
 
+// ValidateQueryCost estimates the cost of resolving an operation which has already been validated
+// with ValidateExecutableVisitor. The list size arguments may come from variables, so this runs
+// for each request instead of being cached with the validated query. It stops as soon as the
+// estimate exceeds the maxCost, so a document with deeply nested fragment spreads cannot make it
+// expand every path.
+class [[nodiscard("unnecessary construction")]] ValidateQueryCost
+{
+public:
+	explicit ValidateQueryCost(const ValidateExecutableSchema& validationSchema,
+		const CostLimits& limits, const FragmentMap& fragments,
+		const response::Value& variables) noexcept;
+
+	[[nodiscard("unnecessary call")]] size_t visit(std::string_view operationType,
+		const peg::ast_node& operationDefinition);
+
+private:
+	void visitSelection(const peg::ast_node& selection, std::string_view typeName,
+		size_t multiplier, size_t listSize);
+	void visitField(const peg::ast_node& field, std::string_view typeName, size_t multiplier,
+		size_t listSize);
+
+	[[nodiscard("unnecessary call")]] size_t getFieldCost(std::string_view typeName,
+		std::string_view fieldName) const;
+	[[nodiscard("unnecessary call")]] std::optional<size_t> getListSize(
+		const peg::ast_node& field) const;
+
+	const ValidateTypes& _operationTypes;
+	const ValidateExecutableSchema::TypeFields& _typeFields;
+	const CostLimits& _limits;
+	const FragmentMap& _fragments;
+	const response::Value& _variables;
+
+	// Integer default values of the operation's variables, which apply if the request leaves them
+	// out, in the same way as they do when the operation is resolved.
+	internal::string_view_map<int> _defaultValues;
+	size_t _cost = 0;
+};
+
 } // namespace graphql::service
 
 #endif // VALIDATION_H
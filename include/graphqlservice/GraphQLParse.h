@@ -22,6 +22,12 @@
 #include <string_view>
 
 namespace graphql {
+namespace service {
+
+class ExecutionPlan;
+
+} // namespace service
+
 namespace peg {
 
 class ast_node;
@@ -32,6 +38,10 @@ struct [[nodiscard("unnecessary parse")]] ast
 	std::shared_ptr<ast_input> input;
 	std::shared_ptr<ast_node> root;
 	bool validated = false;
+
+	// Once the document is validated, service::Request caches the compiled selection sets here so
+	// they can be shared by every copy of the AST.
+	std::shared_ptr<service::ExecutionPlan> plan {};
 };
 
 // By default, we want to limit the depth of nested nodes. You can override this with
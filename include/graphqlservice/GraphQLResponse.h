@@ -21,7 +21,9 @@
 #include "graphqlservice/internal/Awaitable.h"
 
 #include <cstdint>
+#include <concepts>
 #include <initializer_list>
+#include <iosfwd>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -46,9 +48,42 @@ enum class [[nodiscard("unnecessary conversion")]] Type : std::uint8_t {
 	Scalar,	   // JSON any type
 };
 
+// Map keys are usually field names or aliases which repeat in every element of a list, so a MapKey
+// can share an interned string with all of the other maps that use the same key instead of holding
+// its own copy.
+class [[nodiscard("unnecessary construction")]] MapKey
+{
+public:
+	GRAPHQLRESPONSE_EXPORT MapKey() noexcept;
+	GRAPHQLRESPONSE_EXPORT MapKey(std::string&& key) noexcept;
+	GRAPHQLRESPONSE_EXPORT MapKey(const char* key);
+	GRAPHQLRESPONSE_EXPORT explicit MapKey(std::string_view key);
+	GRAPHQLRESPONSE_EXPORT explicit MapKey(std::shared_ptr<const std::string> key) noexcept;
+
+	GRAPHQLRESPONSE_EXPORT [[nodiscard("unnecessary call")]] operator const std::string&()
+		const noexcept;
+	GRAPHQLRESPONSE_EXPORT [[nodiscard("unnecessary call")]] operator std::string_view()
+		const noexcept;
+
+	GRAPHQLRESPONSE_EXPORT [[nodiscard("unnecessary call")]] bool operator==(
+		std::string_view rhs) const noexcept;
+
+	// Only compare directly with another MapKey, anything else should convert to std::string_view.
+	template <std::same_as<MapKey> Other>
+	[[nodiscard("unnecessary call")]] bool operator==(const Other& rhs) const noexcept
+	{
+		return *this == static_cast<std::string_view>(rhs);
+	}
+
+	GRAPHQLRESPONSE_EXPORT friend std::ostream& operator<<(std::ostream& stream, const MapKey& key);
+
+private:
+	std::variant<std::string, std::shared_ptr<const std::string>> _key;
+};
+
 struct Value;
 
-using MapType = std::vector<std::pair<std::string, Value>>;
+using MapType = std::vector<std::pair<MapKey, Value>>;
 using ListType = std::vector<Value>;
 using StringType = std::string;
 using BooleanType = bool;
@@ -265,7 +300,7 @@ struct [[nodiscard("unnecessary conversion")]] Value
 	GRAPHQLRESPONSE_EXPORT [[nodiscard("unnecessary call")]] size_t size() const;
 
 	// Valid for Type::Map
-	GRAPHQLRESPONSE_EXPORT bool emplace_back(std::string && name, Value && value);
+	GRAPHQLRESPONSE_EXPORT bool emplace_back(MapKey && name, Value && value);
 	GRAPHQLRESPONSE_EXPORT [[nodiscard("unnecessary call")]] MapType::const_iterator find(
 		std::string_view name) const;
 	GRAPHQLRESPONSE_EXPORT [[nodiscard("unnecessary call")]] MapType::const_iterator begin() const;
@@ -475,6 +510,9 @@ private:
 		std::unique_ptr<T> _pimpl;
 	};
 
+	// Walk the value by const reference, so it can be shared with other responses.
+	void writeValue(const Value& value) const;
+
 	const std::shared_ptr<const Concept> _concept;
 
 public:
@@ -486,6 +524,18 @@ public:
 	}
 
 	GRAPHQLRESPONSE_EXPORT void write(Value value) const;
+
+	// Write a value which is shared with other responses without copying it first.
+	GRAPHQLRESPONSE_EXPORT void write(const std::shared_ptr<const Value>& value) const;
+
+	// Write an object incrementally, e.g. when streaming each member as soon as it is available.
+	GRAPHQLRESPONSE_EXPORT void start_object() const;
+	GRAPHQLRESPONSE_EXPORT void add_member(const std::string& key) const;
+	GRAPHQLRESPONSE_EXPORT void end_object() const;
+
+	// Write a list incrementally, e.g. when streaming each element as soon as it is available.
+	GRAPHQLRESPONSE_EXPORT void start_array() const;
+	GRAPHQLRESPONSE_EXPORT void end_array() const;
 };
 
 } // namespace graphql::response
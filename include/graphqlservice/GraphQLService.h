@@ -25,21 +25,31 @@
 #include "graphqlservice/internal/SortedMap.h"
 #include "graphqlservice/internal/Version.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <future>
+#include <iterator>
+#include <limits>
 #include <list>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <sstream>
 #include <stdexcept>
+#include <stop_token>
 #include <string>
 #include <string_view>
 #include <thread>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -122,6 +132,17 @@ private:
 		std::string_view methodName) noexcept;
 };
 
+// A DataLoader collects the keys which are requested while a batch is open on the RequestState, and
+// then calls its batch function once for all of them when the outermost batch is closed.
+class [[nodiscard("unnecessary construction")]] DataLoaderBase
+{
+public:
+	virtual ~DataLoaderBase() = default;
+
+	// Call the batch function with all of the keys which were requested since the last dispatch.
+	virtual void dispatch() noexcept = 0;
+};
+
 // The RequestState is nullable, but if you have multiple threads processing requests and there's
 // any per-request state that you want to maintain throughout the request (e.g. optimizing or
 // batching backend requests), you can inherit from RequestState and pass it to Request::resolve to
@@ -129,7 +150,257 @@ private:
 struct [[nodiscard("unnecessary construction")]] RequestState
 	: std::enable_shared_from_this<RequestState>
 {
-	virtual ~RequestState() = default;
+	GRAPHQLSERVICE_EXPORT RequestState();
+
+	// The DataLoader batches belong to the instance, so a copy starts with its own empty batch
+	// and assigning one RequestState to another leaves the batch alone.
+	GRAPHQLSERVICE_EXPORT RequestState(const RequestState& other);
+	GRAPHQLSERVICE_EXPORT RequestState& operator=(const RequestState& other) noexcept;
+
+	GRAPHQLSERVICE_EXPORT virtual ~RequestState();
+
+	// Object::resolve and the list modifier in ModifiedResult open a batch while they start
+	// resolving sibling fields or list elements, so any DataLoader keys they request are deferred
+	// until all of the siblings have had a chance to add theirs. Batches may be nested, and an
+	// object or list element keeps its parent's batch open while it hops to the launch policy.
+	GRAPHQLSERVICE_EXPORT void beginBatch() noexcept;
+	GRAPHQLSERVICE_EXPORT void endBatch() noexcept;
+
+	// A DataLoader with pending keys schedules itself for the next dispatch, which happens right
+	// away if there is no open batch.
+	GRAPHQLSERVICE_EXPORT void schedule(DataLoaderBase& loader);
+	GRAPHQLSERVICE_EXPORT void unschedule(DataLoaderBase& loader) noexcept;
+
+private:
+	struct LoaderState;
+
+	void dispatchPending() noexcept;
+
+	const std::unique_ptr<LoaderState> _loaders;
+};
+
+// Hold a batch open on the RequestState (if there is one) for the lifetime of this object.
+class [[nodiscard("unnecessary construction")]] DataLoaderBatch
+{
+public:
+	explicit DataLoaderBatch(RequestState* state) noexcept
+		: _state { state }
+	{
+		if (_state)
+		{
+			_state->beginBatch();
+		}
+	}
+
+	~DataLoaderBatch()
+	{
+		if (_state)
+		{
+			_state->endBatch();
+		}
+	}
+
+	DataLoaderBatch(const DataLoaderBatch&) = delete;
+	DataLoaderBatch& operator=(const DataLoaderBatch&) = delete;
+
+private:
+	RequestState* const _state;
+};
+
+// Batch and cache lookups by Key for the lifetime of a request. The batch function receives each
+// distinct Key once and must return a Value for each of them in the same order. Every caller of
+// load(key) gets a copy of the same Value, or the same exception if the batch function failed.
+//
+// The DataLoader must outlive any batch it dispatches, so it's usually a member of a RequestState
+// subclass which is passed to Request::resolve.
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class [[nodiscard("unnecessary construction")]] DataLoader final : public DataLoaderBase
+{
+	struct [[nodiscard("unnecessary construction")]] Entry
+	{
+		std::mutex mutex {};
+		std::atomic_bool ready = false;
+		std::optional<Value> value {};
+		std::exception_ptr exception {};
+		std::vector<coro::coroutine_handle<>> waiters {};
+	};
+
+public:
+	using BatchFunction =
+		std::function<internal::Awaitable<std::vector<Value>>(std::vector<Key>)>;
+
+	explicit DataLoader(RequestState& state, BatchFunction batch)
+		: _state { state }
+		, _batch { std::move(batch) }
+	{
+	}
+
+	~DataLoader() override
+	{
+		_state.unschedule(*this);
+	}
+
+	DataLoader(const DataLoader&) = delete;
+	DataLoader& operator=(const DataLoader&) = delete;
+
+	// Awaitable result of a single load(key) call.
+	class [[nodiscard("unnecessary construction")]] Load
+	{
+	public:
+		explicit Load(std::shared_ptr<Entry> entry) noexcept
+			: _entry { std::move(entry) }
+		{
+		}
+
+		[[nodiscard("unexpected call")]] bool await_ready() const noexcept
+		{
+			return _entry->ready;
+		}
+
+		[[nodiscard("unexpected call")]] bool await_suspend(coro::coroutine_handle<> h) const
+		{
+			std::lock_guard lock { _entry->mutex };
+
+			if (_entry->ready)
+			{
+				return false;
+			}
+
+			_entry->waiters.push_back(h);
+			return true;
+		}
+
+		[[nodiscard("unnecessary construction")]] Value await_resume() const
+		{
+			if (_entry->exception)
+			{
+				std::rethrow_exception(_entry->exception);
+			}
+
+			return *_entry->value;
+		}
+
+	private:
+		std::shared_ptr<Entry> _entry;
+	};
+
+	// Return the cached Value for this key, or add it to the next batch.
+	[[nodiscard("unnecessary call")]] Load load(Key key)
+	{
+		std::shared_ptr<Entry> entry;
+		bool added = false;
+
+		{
+			std::lock_guard lock { _mutex };
+			auto [itr, inserted] = _cache.try_emplace(key);
+
+			if (inserted)
+			{
+				itr->second = std::make_shared<Entry>();
+				_pendingKeys.push_back(std::move(key));
+				_pendingEntries.push_back(itr->second);
+			}
+
+			entry = itr->second;
+			added = inserted;
+		}
+
+		if (added)
+		{
+			_state.schedule(*this);
+		}
+
+		return Load { std::move(entry) };
+	}
+
+	// Forget all of the cached values, e.g. after a mutation changes them. Pending loads are not
+	// affected.
+	void clear()
+	{
+		std::lock_guard lock { _mutex };
+
+		_cache.clear();
+	}
+
+	void dispatch() noexcept override
+	{
+		std::vector<Key> keys;
+		std::vector<std::shared_ptr<Entry>> entries;
+
+		{
+			std::lock_guard lock { _mutex };
+
+			keys.swap(_pendingKeys);
+			entries.swap(_pendingEntries);
+		}
+
+		if (!keys.empty())
+		{
+			// The coroutine frame destroys itself when the batch completes.
+			[[maybe_unused]] auto pending = fulfill(std::move(keys), std::move(entries));
+		}
+	}
+
+private:
+	internal::Awaitable<void> fulfill(
+		std::vector<Key> keys, std::vector<std::shared_ptr<Entry>> entries)
+	{
+		std::vector<Value> values;
+		std::exception_ptr exception;
+
+		try
+		{
+			values = co_await _batch(std::move(keys));
+
+			if (values.size() != entries.size())
+			{
+				throw std::logic_error(
+					"DataLoader batch function returned the wrong number of values");
+			}
+		}
+		catch (...)
+		{
+			exception = std::current_exception();
+		}
+
+		// Anything the waiters load when they resume is batched together for the next level.
+		DataLoaderBatch batch { &_state };
+
+		for (size_t i = 0; i < entries.size(); ++i)
+		{
+			auto& entry = *entries[i];
+			std::vector<coro::coroutine_handle<>> waiters;
+
+			{
+				std::lock_guard lock { entry.mutex };
+
+				if (exception)
+				{
+					entry.exception = exception;
+				}
+				else
+				{
+					entry.value = std::make_optional(std::move(values[i]));
+				}
+
+				entry.ready = true;
+				waiters.swap(entry.waiters);
+			}
+
+			for (auto waiter : waiters)
+			{
+				waiter.resume();
+			}
+		}
+	}
+
+	RequestState& _state;
+	const BatchFunction _batch;
+
+	std::mutex _mutex {};
+	std::unordered_map<Key, std::shared_ptr<Entry>, Hash> _cache {};
+	std::vector<Key> _pendingKeys {};
+	std::vector<std::shared_ptr<Entry>> _pendingEntries {};
 };
 
 inline namespace keywords {
@@ -138,6 +409,7 @@ using namespace std::literals;
 
 constexpr std::string_view strData { "data"sv };
 constexpr std::string_view strErrors { "errors"sv };
+constexpr std::string_view strExtensions { "extensions"sv };
 constexpr std::string_view strMessage { "message"sv };
 constexpr std::string_view strLocations { "locations"sv };
 constexpr std::string_view strLine { "line"sv };
@@ -197,6 +469,42 @@ private:
 	std::thread _worker;
 };
 
+// Queue coroutine execution on a fixed size pool of worker threads any time co_await is called.
+// Each worker has its own queue and resumes the most recently queued coroutine first, and when its
+// own queue is empty it steals the oldest coroutine from another worker's queue.
+class [[nodiscard("unnecessary construction")]] await_worker_pool : public coro::suspend_always
+{
+public:
+	// Default to one worker per hardware thread. If pinThreads is true, each worker is restricted
+	// to a single CPU on platforms which support setting the thread affinity.
+	GRAPHQLSERVICE_EXPORT explicit await_worker_pool(
+		size_t threadCount = 0, bool pinThreads = false);
+	GRAPHQLSERVICE_EXPORT ~await_worker_pool();
+
+	GRAPHQLSERVICE_EXPORT void await_suspend(coro::coroutine_handle<> h);
+
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] size_t size() const noexcept;
+
+private:
+	struct [[nodiscard("unnecessary construction")]] WorkerQueue
+	{
+		std::mutex mutex {};
+		std::deque<coro::coroutine_handle<>> pending {};
+	};
+
+	void resumePending(size_t index);
+	[[nodiscard("unexpected call")]] coro::coroutine_handle<> takePending(size_t index);
+
+	std::vector<WorkerQueue> _queues;
+	std::atomic_size_t _pending = 0;
+	std::atomic_size_t _idle = 0;
+	std::atomic_size_t _nextQueue = 0;
+	std::mutex _idleMutex {};
+	std::condition_variable _idleCv {};
+	bool _shutdown = false;
+	std::vector<std::thread> _workers;
+};
+
 // Type-erased awaitable.
 class [[nodiscard("unnecessary construction")]] await_async final
 {
@@ -263,9 +571,228 @@ public:
 // preserves the order of the elements without complete uniqueness.
 using Directives = std::vector<std::pair<std::string_view, response::Value>>;
 
-// Traversing a fragment spread adds a new set of directives.
-using FragmentDefinitionDirectiveStack = std::list<std::reference_wrapper<const Directives>>;
-using FragmentSpreadDirectiveStack = std::list<Directives>;
+// Traversing a fragment spread adds a new set of directives, and each nested SelectionSet adds an
+// empty set. The stack is an immutable linked list which shares the entries below the top with the
+// stack it was copied from, so each field can keep a copy of it. Empty entries are only counted, so
+// it does not allocate anything unless the fragments have directives.
+template <typename T>
+class [[nodiscard("unnecessary construction")]] DirectiveStack
+{
+private:
+	struct Node
+	{
+		T value;
+		size_t emptyBelow;
+		size_t size;
+		std::shared_ptr<const Node> next;
+	};
+
+public:
+	using value_type = T;
+	using size_type = size_t;
+	using const_reference = const T&;
+
+	class [[nodiscard("unnecessary construction")]] const_iterator
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const T*;
+		using reference = const T&;
+
+		constexpr const_iterator() noexcept = default;
+
+		constexpr const_iterator(const Node* node, size_t empty) noexcept
+			: _node { node }
+			, _empty { empty }
+		{
+		}
+
+		[[nodiscard("unnecessary call")]] reference operator*() const noexcept
+		{
+			return _empty > 0 ? DirectiveStack::emptyValue() : _node->value;
+		}
+
+		[[nodiscard("unnecessary call")]] pointer operator->() const noexcept
+		{
+			return &**this;
+		}
+
+		const_iterator& operator++() noexcept
+		{
+			if (_empty > 0)
+			{
+				--_empty;
+			}
+			else
+			{
+				_empty = _node->emptyBelow;
+				_node = _node->next.get();
+			}
+
+			return *this;
+		}
+
+		const_iterator operator++(int) noexcept
+		{
+			auto result = *this;
+
+			++*this;
+
+			return result;
+		}
+
+		[[nodiscard("unnecessary call")]] constexpr bool operator==(
+			const const_iterator& rhs) const noexcept = default;
+
+	private:
+		const Node* _node = nullptr;
+		size_t _empty = 0;
+	};
+
+	[[nodiscard("unnecessary call")]] bool empty() const noexcept
+	{
+		return _empty == 0 && !_top;
+	}
+
+	[[nodiscard("unnecessary call")]] size_t size() const noexcept
+	{
+		return _empty + (_top ? _top->size : 0);
+	}
+
+	[[nodiscard("unnecessary call")]] const T& front() const noexcept
+	{
+		return *begin();
+	}
+
+	[[nodiscard("unnecessary call")]] const_iterator begin() const noexcept
+	{
+		return { _top.get(), _empty };
+	}
+
+	[[nodiscard("unnecessary call")]] const_iterator end() const noexcept
+	{
+		return {};
+	}
+
+	[[nodiscard("unnecessary call")]] const_iterator cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	[[nodiscard("unnecessary call")]] const_iterator cend() const noexcept
+	{
+		return end();
+	}
+
+	void push_front(T value)
+	{
+		if (isEmpty(value))
+		{
+			++_empty;
+			return;
+		}
+
+		const size_t size = 1 + _empty + (_top ? _top->size : 0);
+
+		_top = std::make_shared<const Node>(Node { std::move(value), _empty, size, std::move(_top) });
+		_empty = 0;
+	}
+
+	void pop_front() noexcept
+	{
+		if (_empty > 0)
+		{
+			--_empty;
+			return;
+		}
+
+		_empty = _top->emptyBelow;
+		_top = _top->next;
+	}
+
+private:
+	[[nodiscard("unnecessary call")]] static bool isEmpty(const T& value) noexcept
+	{
+		if constexpr (std::is_same_v<T, std::reference_wrapper<const Directives>>)
+		{
+			return value.get().empty();
+		}
+		else
+		{
+			return value.empty();
+		}
+	}
+
+	[[nodiscard("unnecessary call")]] static const T& emptyValue() noexcept
+	{
+		static const Directives s_empty;
+
+		if constexpr (std::is_same_v<T, std::reference_wrapper<const Directives>>)
+		{
+			static const T s_emptyRef { std::cref(s_empty) };
+
+			return s_emptyRef;
+		}
+		else
+		{
+			return s_empty;
+		}
+	}
+
+	std::shared_ptr<const Node> _top;
+	size_t _empty = 0;
+};
+
+using FragmentDefinitionDirectiveStack = DirectiveStack<std::reference_wrapper<const Directives>>;
+using FragmentSpreadDirectiveStack = DirectiveStack<Directives>;
+
+// Stop resolving a request once the client cancels it through the std::stop_source for the
+// stopToken, or once the deadline passes. Fields and list elements which have already started
+// still run to completion, but the ones after them are skipped and reported as errors.
+struct [[nodiscard("unnecessary construction")]] RequestCancellation
+{
+	std::stop_token stopToken {};
+	std::optional<std::chrono::steady_clock::time_point> deadline {};
+
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] bool stopRequested() const noexcept;
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] schema_error getError(
+		schema_location location, error_path && path) const;
+};
+
+// Phases of a request which are reported to the RequestInstrumentation. The query is parsed before
+// it is passed to Request::resolve, so only the caller can report the Parse phase.
+enum class RequestPhase
+{
+	Parse,
+	Validate,
+	Execute,
+};
+
+// Observe the phases of Request::resolve and each of the field resolvers it calls. Nothing is
+// measured unless it is installed with RequestResolveParams::instrumentation. The field callbacks
+// may be called concurrently from different threads if the launch policy is asynchronous.
+class [[nodiscard("unnecessary construction")]] RequestInstrumentation
+{
+public:
+	GRAPHQLSERVICE_EXPORT virtual ~RequestInstrumentation();
+
+	GRAPHQLSERVICE_EXPORT virtual void beginPhase(RequestPhase phase);
+	GRAPHQLSERVICE_EXPORT virtual void endPhase(RequestPhase phase,
+		std::chrono::steady_clock::duration duration);
+
+	// The typeName is empty for objects which were not generated by schemagen. The field ends
+	// when its result is ready, including any nested selection sets.
+	GRAPHQLSERVICE_EXPORT virtual void beginField(std::string_view typeName,
+		std::string_view fieldName, const error_path& path);
+	GRAPHQLSERVICE_EXPORT virtual void endField(std::string_view typeName,
+		std::string_view fieldName, const error_path& path,
+		std::chrono::steady_clock::duration duration);
+
+	// Return a map to add as the extensions member of the response, or null to leave it out.
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] virtual response::Value getExtensions();
+};
 
 // Pass a common bundle of parameters to all of the generated Object::getField accessors in a
 // SelectionSet
@@ -278,19 +805,44 @@ struct [[nodiscard("unnecessary construction")]] SelectionSetParams
 	// by the accessor is resolved or destroyed. They are owned by the OperationData shared pointer.
 	const std::shared_ptr<RequestState>& state;
 	const Directives& operationDirectives;
-	const std::shared_ptr<FragmentDefinitionDirectiveStack> fragmentDefinitionDirectives;
+	const FragmentDefinitionDirectiveStack fragmentDefinitionDirectives;
 
-	// Fragment directives are shared for all fields in that fragment, but they aren't kept alive
-	// after the call to the last accessor in the fragment. If you need to keep them alive longer,
-	// you'll need to explicitly copy them into other instances of Directives.
-	const std::shared_ptr<FragmentSpreadDirectiveStack> fragmentSpreadDirectives;
-	const std::shared_ptr<FragmentSpreadDirectiveStack> inlineFragmentDirectives;
+	// Fragment directives are shared for all fields in that fragment. Each field gets its own copy
+	// of the stacks, which keeps the directives alive as long as the params.
+	const FragmentSpreadDirectiveStack fragmentSpreadDirectives;
+	const FragmentSpreadDirectiveStack inlineFragmentDirectives;
 
 	// Field error path to this selection set.
 	std::optional<field_path> errorPath;
 
 	// Async launch policy for sub-field resolvers.
 	const await_async launch {};
+
+	// Compiled selection sets cached with the validated peg::ast, which owns them. If this is
+	// nullptr, Object::resolve compiles each selection set again without caching it.
+	ExecutionPlan* const plan = nullptr;
+
+	// Cancellation token and deadline for the request, or nullptr if it cannot be cancelled.
+	const RequestCancellation* const cancellation = nullptr;
+
+	// Instrumentation for the request, or nullptr if it is not being measured.
+	RequestInstrumentation* const instrumentation = nullptr;
+
+	// Number of list elements to resolve together each time the list hops to an asynchronous
+	// launch policy, or 0 to launch each element separately.
+	const size_t listGrainSize = 0;
+
+	// Memory resource for coroutine frames and intermediate results, or nullptr for the heap.
+	std::pmr::memory_resource* const memoryResource = nullptr;
+
+	// Objects and lists resolve to a ResolverStream instead of a response::Value, so they can be
+	// written to a response::Writer as their fields and elements complete.
+	bool streamed = false;
+
+	[[nodiscard("unnecessary call")]] std::pmr::memory_resource* getMemoryResource() const noexcept
+	{
+		return memoryResource ? memoryResource : std::pmr::get_default_resource();
+	}
 };
 
 // Pass a common bundle of parameters to all of the generated Object::getField accessors.
@@ -321,40 +873,14 @@ public:
 	{
 	}
 
-	struct promise_type
+	struct promise_type : internal::AwaitablePromise<T>
 	{
 		[[nodiscard("unnecessary construction")]] AwaitableScalar<T> get_return_object() noexcept
 		{
-			return { _promise.get_future() };
-		}
-
-		coro::suspend_never initial_suspend() const noexcept
-		{
-			return {};
-		}
-
-		coro::suspend_never final_suspend() const noexcept
-		{
-			return {};
-		}
-
-		void return_value(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)
-		{
-			_promise.set_value(value);
-		}
-
-		void return_value(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>)
-		{
-			_promise.set_value(std::move(value));
+			return { internal::AwaitableHandle<T> {
+				coro::coroutine_handle<promise_type>::from_promise(*this),
+				*this } };
 		}
-
-		void unhandled_exception() noexcept
-		{
-			_promise.set_exception(std::current_exception());
-		}
-
-	private:
-		std::promise<T> _promise;
 	};
 
 	[[nodiscard("unexpected call")]] bool await_ready() const noexcept
@@ -373,6 +899,10 @@ public:
 
 					return value.wait_for(0s) != std::future_status::timeout;
 				}
+				else if constexpr (std::is_same_v<value_type, internal::AwaitableHandle<T>>)
+				{
+					return value.await_ready();
+				}
 				else if constexpr (std::is_same_v<value_type,
 									   std::shared_ptr<const response::Value>>)
 				{
@@ -382,8 +912,13 @@ public:
 			_value);
 	}
 
-	void await_suspend(coro::coroutine_handle<> h) const
+	[[nodiscard("unexpected call")]] bool await_suspend(coro::coroutine_handle<> h) const
 	{
+		if (const auto awaitable = std::get_if<internal::AwaitableHandle<T>>(&_value))
+		{
+			return awaitable->await_suspend(h);
+		}
+
 		std::thread(
 			[this](coro::coroutine_handle<> h) noexcept {
 				std::get<std::future<T>>(_value).wait();
@@ -391,6 +926,8 @@ public:
 			},
 			std::move(h))
 			.detach();
+
+		return true;
 	}
 
 	[[nodiscard("unnecessary construction")]] T await_resume()
@@ -407,6 +944,10 @@ public:
 				{
 					return value.get();
 				}
+				else if constexpr (std::is_same_v<value_type, internal::AwaitableHandle<T>>)
+				{
+					return value.await_resume();
+				}
 				else if constexpr (std::is_same_v<value_type,
 									   std::shared_ptr<const response::Value>>)
 				{
@@ -435,7 +976,9 @@ public:
 	}
 
 private:
-	std::variant<T, std::future<T>, std::shared_ptr<const response::Value>> _value;
+	std::variant<T, std::future<T>, internal::AwaitableHandle<T>,
+		std::shared_ptr<const response::Value>>
+		_value;
 };
 
 // Field accessors may return either a result of T, an awaitable of T, or a std::future<T>, so at
@@ -451,40 +994,14 @@ public:
 	{
 	}
 
-	struct promise_type
+	struct promise_type : internal::AwaitablePromise<T>
 	{
-		[[nodiscard("unnecessary construction")]] AwaitableObject<T> get_return_object() noexcept
-		{
-			return { _promise.get_future() };
-		}
-
-		coro::suspend_never initial_suspend() const noexcept
-		{
-			return {};
-		}
-
-		coro::suspend_never final_suspend() const noexcept
-		{
-			return {};
-		}
-
-		void return_value(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)
-		{
-			_promise.set_value(value);
-		}
-
-		void return_value(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>)
-		{
-			_promise.set_value(std::move(value));
-		}
-
-		void unhandled_exception() noexcept
+		[[nodiscard("unnecessary construction")]] AwaitableObject<T> get_return_object() noexcept
 		{
-			_promise.set_exception(std::current_exception());
+			return { internal::AwaitableHandle<T> {
+				coro::coroutine_handle<promise_type>::from_promise(*this),
+				*this } };
 		}
-
-	private:
-		std::promise<T> _promise;
 	};
 
 	[[nodiscard("unexpected call")]] bool await_ready() const noexcept
@@ -503,12 +1020,21 @@ public:
 
 					return value.wait_for(0s) != std::future_status::timeout;
 				}
+				else if constexpr (std::is_same_v<value_type, internal::AwaitableHandle<T>>)
+				{
+					return value.await_ready();
+				}
 			},
 			_value);
 	}
 
-	void await_suspend(coro::coroutine_handle<> h) const
+	[[nodiscard("unexpected call")]] bool await_suspend(coro::coroutine_handle<> h) const
 	{
+		if (const auto awaitable = std::get_if<internal::AwaitableHandle<T>>(&_value))
+		{
+			return awaitable->await_suspend(h);
+		}
+
 		std::thread(
 			[this](coro::coroutine_handle<> h) noexcept {
 				std::get<std::future<T>>(_value).wait();
@@ -516,6 +1042,8 @@ public:
 			},
 			std::move(h))
 			.detach();
+
+		return true;
 	}
 
 	[[nodiscard("unnecessary construction")]] T await_resume()
@@ -532,12 +1060,16 @@ public:
 				{
 					return value.get();
 				}
+				else if constexpr (std::is_same_v<value_type, internal::AwaitableHandle<T>>)
+				{
+					return value.await_resume();
+				}
 			},
 			std::move(_value));
 	}
 
 private:
-	std::variant<T, std::future<T>> _value;
+	std::variant<T, std::future<T>, internal::AwaitableHandle<T>> _value;
 };
 
 // Fragments are referenced by name and have a single type condition (except for inline
@@ -579,6 +1111,14 @@ struct [[nodiscard("unnecessary construction")]] ResolverParams : SelectionSetPa
 
 	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] schema_location getLocation() const;
 
+	// The coroutines which take a ResolverParams are created by the executor, so their frames are
+	// allocated from the request's memory resource. Field getters only see FieldParams, so the
+	// coroutines they create are allocated from the heap and may outlive the request.
+	[[nodiscard("unnecessary call")]] std::pmr::memory_resource* frameResource() const noexcept
+	{
+		return memoryResource;
+	}
+
 	// These values are different for each resolver.
 	const peg::ast_node& field;
 	std::string fieldName;
@@ -592,18 +1132,57 @@ struct [[nodiscard("unnecessary construction")]] ResolverParams : SelectionSetPa
 	const response::Value& variables;
 };
 
+// When the data is streamed to a response::Writer, only the errors are propagated back up.
+using AwaitableErrors = internal::Awaitable<std::list<schema_error>>;
+
+// Objects and lists with streamed SelectionSetParams write each of their fields or elements to a
+// response::Writer in order as soon as it completes, instead of building a response::Value.
+class [[nodiscard("unnecessary construction")]] ResolverStream
+{
+public:
+	GRAPHQLSERVICE_EXPORT virtual ~ResolverStream() = default;
+
+	// Await anything which could still make the whole value null, and throw its errors if it does.
+	// This must be called before write.
+	[[nodiscard("unnecessary call")]] virtual internal::Awaitable<void> prepare() = 0;
+
+	// Write the value and return the errors for the fields or elements inside of it.
+	[[nodiscard("unnecessary call")]] virtual AwaitableErrors write(
+		const response::Writer& writer) = 0;
+};
+
+// The fields or elements of a ResolverStream borrow its state, so it must finish before it is
+// destroyed even if it is not written. This awaits all of them and only returns their errors.
+GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] AwaitableErrors discardStream(
+	std::unique_ptr<ResolverStream> stream);
+
 // Propagate data and errors together without bundling them into a response::Value struct until
 // we're ready to return from the top level Operation.
 struct [[nodiscard("unnecessary construction")]] ResolverResult
 {
 	response::Value data;
 	std::list<schema_error> errors {};
+
+	// If the params were streamed, objects and lists are returned here instead of in the data.
+	std::unique_ptr<ResolverStream> stream {};
 };
 
 using AwaitableResolver = internal::Awaitable<ResolverResult>;
 using Resolver = std::function<AwaitableResolver(ResolverParams&&)>;
 using ResolverMap = internal::string_view_map<Resolver>;
 
+class Object;
+
+// Forward declare just the class type so both overloads of Object::resolve can share the code
+// which starts resolving the fields in a selection set.
+struct SelectionFields;
+
+// Generated objects share a static ResolverTable for each type instead of building a ResolverMap
+// for every instance. Each FieldResolver is called with the Object which owns the table, and the
+// index of a field in the table is its field id.
+using FieldResolver = AwaitableResolver (*)(const Object& object, ResolverParams&& params);
+using ResolverTable = internal::string_view_map<FieldResolver>;
+
 // GraphQL types are nullable by default, but they may be wrapped with non-null or list types.
 // Since nullability is a more special case in C++, we invert the default and apply that modifier
 // instead when the non-null wrapper is not present in that part of the wrapper chain.
@@ -885,6 +1464,15 @@ class [[nodiscard("unnecessary construction")]] Object : public std::enable_shar
 public:
 	GRAPHQLSERVICE_EXPORT explicit Object(TypeNames && typeNames,
 		ResolverMap && resolvers) noexcept;
+
+	// The static tables must outlive the Object. If they belong to another Object, e.g. the
+	// implementation of an interface or union type, pass that as the resolverObject.
+	GRAPHQLSERVICE_EXPORT explicit Object(const TypeNames& typeNames,
+		const ResolverTable& resolvers, const Object* resolverObject = nullptr) noexcept;
+
+	// Generated object types also name their concrete type, which must outlive the Object.
+	GRAPHQLSERVICE_EXPORT explicit Object(const TypeNames& typeNames,
+		const ResolverTable& resolvers, std::string_view typeName) noexcept;
 	GRAPHQLSERVICE_EXPORT virtual ~Object() = default;
 
 	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] AwaitableResolver resolve(
@@ -893,9 +1481,33 @@ public:
 		const FragmentMap& fragments,
 		const response::Value& variables) const;
 
+	// Write each field in this selection set to the writer in document order as soon as it has
+	// been resolved, instead of building a response::Value for the whole selection set. Nested
+	// objects and lists are streamed the same way, so only the scalar leaves are held until they
+	// are written.
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] AwaitableErrors resolve(
+		const SelectionSetParams& selectionSetParams,
+		const peg::ast_node& selection,
+		const FragmentMap& fragments,
+		const response::Value& variables,
+		const response::Writer& writer) const;
+
+	// Start resolving the fields in this selection set, and return a ResolverStream which writes
+	// them in document order. If the Object is owned by a std::shared_ptr, the stream keeps it
+	// alive, otherwise the caller must.
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] std::unique_ptr<ResolverStream> stream(
+		const SelectionSetParams& selectionSetParams,
+		const peg::ast_node& selection,
+		const FragmentMap& fragments,
+		const response::Value& variables) const;
+
 	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] bool matchesType(
 		std::string_view typeName) const;
 
+	// Returns the name of the concrete type, or an empty string if it was not specified.
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] std::string_view getTypeName()
+		const noexcept;
+
 protected:
 	// These callbacks are optional, you may override either, both, or neither of them. The
 	// implementer can use these to to accumulate state for the entire SelectionSet on this object,
@@ -909,14 +1521,31 @@ protected:
 	mutable std::mutex _resolverMutex {};
 
 private:
-	TypeNames _typeNames;
+	// Compile the selection set and start resolving each of the fields, for either overload of
+	// resolve to await them in document order.
+	[[nodiscard("unnecessary call")]] SelectionFields startFields(
+		const SelectionSetParams& selectionSetParams, const peg::ast_node& selection,
+		const FragmentMap& fragments, const response::Value& variables) const;
+
+	TypeNames _ownedTypeNames;
 	ResolverMap _resolvers;
+	const TypeNames& _typeNames;
+	const ResolverTable* const _resolverTable = nullptr;
+	const Object* const _resolverObject = nullptr;
+	const std::string_view _typeName;
 };
 
 // Test if this Type inherits from Object.
 template <typename Type>
 concept ObjectBaseType = std::is_base_of_v<Object, Type>;
 
+// Objects generated with schemagen --thread-safe-resolvers skip the _resolverMutex if the
+// implementation type declares that its field getters are safe to call concurrently:
+//
+//     static constexpr bool threadSafeResolvers = true;
+template <typename Type>
+concept ThreadSafeResolvers = requires { requires Type::threadSafeResolvers; };
+
 // Convert result types with non-templated static methods.
 template <typename Type>
 struct Result
@@ -1082,8 +1711,17 @@ struct ModifiedResult
 		// Move the paramsArg into a local variable before the first suspension point.
 		auto params = std::move(paramsArg);
 
+		// Keep the parent's batch open across the hop, until the object has started its fields.
+		std::optional<DataLoaderBatch> batch { std::in_place, params.state.get() };
+
 		co_await params.launch;
 
+		// The field getter may be waiting for a DataLoader, so it can't wait for the batch.
+		if (!result.await_ready())
+		{
+			batch.reset();
+		}
+
 		auto awaitedResult = co_await std::move(result);
 
 		if (!awaitedResult)
@@ -1092,122 +1730,664 @@ struct ModifiedResult
 		}
 
 		auto modifiedResult =
-			co_await ModifiedResult::convert<Other...>(std::move(awaitedResult), std::move(params));
+			ModifiedResult::convert<Other...>(std::move(awaitedResult), std::move(params));
 
-		co_return modifiedResult;
+		batch.reset();
+
+		co_return co_await std::move(modifiedResult);
 	}
 
 	// Peel off nullable modifiers for anything else, which should all be std::optional.
 	template <TypeModifier Modifier, TypeModifier... Other>
 	[[nodiscard("unnecessary conversion")]] static AwaitableResolver convert(
 		typename ResultTraits<Type, Modifier, Other...>::future_type result,
-		ResolverParams&& paramsArg)
+		ResolverParams&& params)
 		requires NullableResultOptional<Type, Modifier, Other...>
 	{
 		static_assert(std::is_same_v<std::optional<typename ResultTraits<Type, Other...>::type>,
 						  typename ResultTraits<Type, Modifier, Other...>::type>,
 			"this is the optional version");
 
-		if constexpr (!ObjectBaseType<Type>)
+		if constexpr (!ObjectBaseType<Type>)
+		{
+			try
+			{
+				auto value = result.get_value();
+
+				if (value)
+				{
+					ModifiedResult::validateScalar<Modifier, Other...>(*value);
+					return ResolverResult { response::Value {
+						std::shared_ptr { std::move(value) } } };
+				}
+
+				// Unwrap a value which is already available without a coroutine frame.
+				if (result.await_ready() && params.launch.await_ready())
+				{
+					auto awaitedResult = result.await_resume();
+
+					if (!awaitedResult)
+					{
+						return ResolverResult {};
+					}
+
+					return ModifiedResult::convert<Other...>(std::move(*awaitedResult),
+						std::move(params));
+				}
+			}
+			catch (...)
+			{
+				return std::current_exception();
+			}
+		}
+
+		return convertOptional<Modifier, Other...>(std::move(result), std::move(params));
+	}
+
+	// Peel off list modifiers.
+	template <TypeModifier Modifier, TypeModifier... Other>
+	[[nodiscard("unnecessary conversion")]] static AwaitableResolver convert(
+		typename ResultTraits<Type, Modifier, Other...>::future_type result,
+		ResolverParams&& paramsArg)
+		requires ListModifier<Modifier>
+	{
+		if constexpr (!ObjectBaseType<Type>)
+		{
+			auto value = result.get_value();
+
+			if (value)
+			{
+				ModifiedResult::validateScalar<Modifier, Other...>(*value);
+				co_return ResolverResult { response::Value {
+					std::shared_ptr { std::move(value) } } };
+			}
+		}
+
+		// Move the paramsArg into a local variable before the first suspension point.
+		auto params = std::move(paramsArg);
+
+		// Keep the parent's batch open across the hop, so the elements which start on another
+		// thread still add their DataLoader keys to the same batch as their siblings.
+		std::optional<DataLoaderBatch> batch { std::in_place, params.state.get() };
+
+		co_await params.launch;
+
+		// The field getter may be waiting for a DataLoader, so it can't wait for the batch.
+		if (!result.await_ready())
+		{
+			batch.reset();
+		}
+
+		auto awaitedResult = co_await std::move(result);
+
+		using vector_type = std::decay_t<decltype(awaitedResult)>;
+		using elements_type = ListElements<vector_type, Other...>;
+
+		// A streamed list is written after this coroutine returns, so the elements and the state
+		// they borrow live on the heap instead of in this frame.
+		std::unique_ptr<elements_type> streamedElements;
+		std::optional<elements_type> localElements;
+
+		if (params.streamed)
+		{
+			streamedElements =
+				std::make_unique<elements_type>(std::move(params), std::move(awaitedResult));
+		}
+		else
+		{
+			localElements.emplace(std::move(params), std::move(awaitedResult));
+		}
+
+		auto& elements = streamedElements ? *streamedElements : *localElements;
+
+		// Start all of the elements before any of the DataLoader keys they request are dispatched.
+		if (!batch)
+		{
+			batch.emplace(elements.params.state.get());
+		}
+
+		elements.start();
+		batch.reset();
+
+		if (streamedElements)
+		{
+			co_return ResolverResult { {}, {}, std::move(streamedElements) };
+		}
+
+		const auto chunked = elements.chunked;
+		const auto grainSize = elements.params.listGrainSize;
+		ResolverResult document { response::Value { response::Type::List } };
+
+		// If the request was cancelled before every element started, the list is incomplete.
+		bool cancelled = elements.cancelled;
+		bool incomplete = false;
+
+		document.data.reserve(elements.values.size());
+
+		for (auto& child : elements.children)
+		{
+			try
+			{
+				// Only hop to the launch policy if the element still has work left to do. The
+				// chunks already hopped to it on their own.
+				if (!chunked && !child.await_ready())
+				{
+					co_await elements.params.launch;
+				}
+
+				auto value = co_await std::move(child);
+
+				if (!chunked)
+				{
+					document.data.emplace_back(std::move(value.data));
+				}
+				else if (value.data.type() == response::Type::List)
+				{
+					auto entries = value.data.template release<response::ListType>();
+
+					for (auto& entry : entries)
+					{
+						document.data.emplace_back(std::move(entry));
+					}
+				}
+				else
+				{
+					// The chunk was cancelled before it started. Each chunk still needs to be
+					// awaited, since the ones before it are still running.
+					cancelled = true;
+				}
+
+				if (!value.errors.empty())
+				{
+					document.errors.splice(document.errors.end(), value.errors);
+				}
+			}
+			catch (...)
+			{
+				addElementError(document.errors, elements.elementParams, std::current_exception());
+
+				if (!chunked && isNullable<Other...>())
+				{
+					document.data.emplace_back(response::Value {});
+				}
+				else
+				{
+					// The elements in the chunk are missing, or the element type is not nullable,
+					// so the list is incomplete.
+					incomplete = true;
+				}
+			}
+
+			std::get<size_t>(elements.elementParams.errorPath->segment) +=
+				chunked ? grainSize : 1;
+		}
+
+		if (cancelled || incomplete)
+		{
+			// A shorter list would look like a complete result, so the whole list field is null
+			// with the element errors and the cancellation error at its own path instead.
+			if (cancelled)
+			{
+				document.errors.push_back(elements.getCancellationError());
+			}
+
+			throw schema_exception { std::move(document.errors) };
+		}
+
+		co_return document;
+	}
+
+	// Peel off the none modifier. If it's included, it should always be last in the list.
+	template <TypeModifier Modifier = TypeModifier::None, TypeModifier... Other>
+	static void validateScalar(const response::Value& value)
+		requires OnlyNoneModifiers<Modifier, Other...>
+	{
+		static_assert(sizeof...(Other) == 0, "None modifier should always be last");
+
+		// Just call through to the partial specialization without the modifier.
+		Result<Type>::validateScalar(value);
+	}
+
+	// Peel off nullable modifiers.
+	template <TypeModifier Modifier, TypeModifier... Other>
+	static void validateScalar(const response::Value& value)
+		requires NullableModifier<Modifier>
+	{
+		if (value.type() != response::Type::Null)
+		{
+			ModifiedResult::validateScalar<Other...>(value);
+		}
+	}
+
+	// Peel off list modifiers.
+	template <TypeModifier Modifier, TypeModifier... Other>
+	static void validateScalar(const response::Value& value)
+		requires ListModifier<Modifier>
+	{
+		if (value.type() != response::Type::List)
+		{
+			throw schema_exception { { R"ex(not a valid List value)ex" } };
+		}
+
+		for (size_t i = 0; i < value.size(); ++i)
+		{
+			ModifiedResult::validateScalar<Other...>(value[i]);
+		}
+	}
+
+	using ResolverCallback =
+		std::function<response::Value(typename ResultTraits<Type>::type, const ResolverParams&)>;
+
+	[[nodiscard("unnecessary call")]] static AwaitableResolver resolve(
+		typename ResultTraits<Type>::future_type result, ResolverParams&& params,
+		ResolverCallback&& resolver)
+	{
+		static_assert(!ObjectBaseType<Type>, "ModfiedResult<Object> needs special handling");
+
+		try
+		{
+			auto value = result.get_value();
+
+			if (value)
+			{
+				Result<Type>::validateScalar(*value);
+				return ResolverResult { response::Value { std::shared_ptr { std::move(value) } } };
+			}
+		}
+		catch (...)
+		{
+			return std::current_exception();
+		}
+
+		// Most field getters return the value directly, so unless the launch policy needs to
+		// suspend, call the resolver without allocating a coroutine frame.
+		if (result.await_ready() && params.launch.await_ready())
+		{
+			ResolverResult document;
+
+			try
+			{
+				document.data = resolver(result.await_resume(), params);
+			}
+			catch (...)
+			{
+				addResolverError(document, params, std::current_exception());
+			}
+
+			return document;
+		}
+
+		return resolveAwaitable(std::move(result), std::move(params), std::move(resolver));
+	}
+
+private:
+	// Test if the next modifier is Nullable, e.g. whether the elements of a list can be null.
+	template <TypeModifier Modifier = TypeModifier::None, TypeModifier... Other>
+	static constexpr bool isNullable() noexcept
+	{
+		return NullableModifier<Modifier>;
+	}
+
+	// The elements of a list which convert has started, and the state they borrow from the list.
+	// A list of values awaits them in convert, a streamed list writes them to a response::Writer.
+	template <typename Vector, TypeModifier... Other>
+	struct ListElements final : ResolverStream
+	{
+		explicit ListElements(ResolverParams&& paramsArg, Vector&& valuesArg)
+			: params { std::move(paramsArg) }
+			, elementParams { params,
+				params.field,
+				std::string { params.fieldName },
+				response::Value { response::Type::Map },
+				Directives {},
+				params.selection,
+				params.fragments,
+				params.variables }
+			, values { std::move(valuesArg) }
+			, children { params.getMemoryResource() }
+			, results { params.getMemoryResource() }
+		{
+			// The elements share everything but the errorPath with the list field. The arguments
+			// and directives were only needed to call the field resolver, so they are not copied.
+			elementParams.errorPath = std::make_optional(field_path {
+				params.errorPath ? std::make_optional(std::cref(*params.errorPath)) : std::nullopt,
+				path_segment { size_t { 0 } } });
+		}
+
+		void start()
+		{
+			// Resolve the elements in chunks if hopping to the launch policy for each of them
+			// would cost more than resolving them.
+			const auto grainSize = params.listGrainSize;
+
+			chunked = grainSize > 1 && values.size() > grainSize && !params.launch.await_ready();
+
+			// Stop starting elements once the request is cancelled, and truncate the list.
+			const auto stopRequested = [this]() noexcept {
+				return params.cancellation && params.cancellation->stopRequested();
+			};
+
+			if (chunked)
+			{
+				children.reserve((values.size() + grainSize - 1) / grainSize);
+
+				for (size_t begin = 0; begin < values.size(); begin += grainSize)
+				{
+					std::get<size_t>(elementParams.errorPath->segment) = begin;
+					children.push_back(convertChunk<Vector, Other...>(values,
+						begin,
+						std::min(begin + grainSize, values.size()),
+						ResolverParams(elementParams)));
+				}
+			}
+			else if constexpr (!std::is_same_v<std::decay_t<typename Vector::reference>,
+								   typename Vector::value_type>)
+			{
+				children.reserve(values.size());
+
+				// Special handling for std::vector<> specializations which don't return a
+				// reference to the underlying type, i.e. std::vector<bool> on many platforms.
+				// Copy the values from the std::vector<> rather than moving them.
+				for (typename Vector::value_type entry : values)
+				{
+					if (stopRequested())
+					{
+						break;
+					}
+
+					children.push_back(ModifiedResult::convert<Other...>(std::move(entry),
+						ResolverParams(elementParams)));
+					++std::get<size_t>(elementParams.errorPath->segment);
+				}
+			}
+			else
+			{
+				children.reserve(values.size());
+
+				for (auto& entry : values)
+				{
+					if (stopRequested())
+					{
+						break;
+					}
+
+					children.push_back(ModifiedResult::convert<Other...>(std::move(entry),
+						ResolverParams(elementParams)));
+					++std::get<size_t>(elementParams.errorPath->segment);
+				}
+			}
+
+			// If the request was cancelled before every element started, the list is incomplete.
+			cancelled = !chunked && children.size() < values.size();
+			std::get<size_t>(elementParams.errorPath->segment) = 0;
+		}
+
+		[[nodiscard("unnecessary call")]] schema_error getCancellationError() const
 		{
-			auto value = result.get_value();
+			return params.cancellation->getError(params.getLocation(),
+				buildErrorPath(params.errorPath));
+		}
 
-			if (value)
+		// Once the list starts writing it can't be replaced with null anymore, so unless a failed
+		// element is just null, every element needs to resolve before any of them are written.
+		[[nodiscard("unnecessary call")]] bool writesInOrder() const noexcept
+		{
+			return !chunked && !cancelled && isNullable<Other...>();
+		}
+
+		[[nodiscard("unnecessary call")]] internal::Awaitable<void> prepare() final
+		{
+			if (writesInOrder())
 			{
-				ModifiedResult::validateScalar<Modifier, Other...>(*value);
-				co_return ResolverResult { response::Value {
-					std::shared_ptr { std::move(value) } } };
+				return {};
 			}
+
+			return awaitResults();
 		}
 
-		// Move the paramsArg into a local variable before the first suspension point.
-		auto params = std::move(paramsArg);
+		[[nodiscard("unnecessary call")]] AwaitableErrors write(
+			const response::Writer& writer) final
+		{
+			writer.start_array();
 
-		co_await params.launch;
+			if (writesInOrder())
+			{
+				// Write each element as soon as it completes, a failed element is null.
+				for (auto& child : children)
+				{
+					ResolverResult value;
+
+					try
+					{
+						if (!child.await_ready())
+						{
+							co_await params.launch;
+						}
+
+						value = co_await std::move(child);
+						errors.splice(errors.end(), value.errors);
+
+						if (value.stream)
+						{
+							co_await value.stream->prepare();
+						}
+					}
+					catch (...)
+					{
+						addElementError(errors, elementParams, std::current_exception());
+						value = {};
+					}
+
+					if (value.stream)
+					{
+						auto streamErrors = co_await value.stream->write(writer);
+
+						errors.splice(errors.end(), streamErrors);
+					}
+					else
+					{
+						writer.write(std::move(value.data));
+					}
+
+					++std::get<size_t>(elementParams.errorPath->segment);
+				}
+			}
+			else
+			{
+				for (auto& value : results)
+				{
+					if (value.stream)
+					{
+						auto streamErrors = co_await value.stream->write(writer);
+
+						errors.splice(errors.end(), streamErrors);
+					}
+					else if (chunked)
+					{
+						auto entries = value.data.template release<response::ListType>();
+
+						for (auto& entry : entries)
+						{
+							writer.write(std::move(entry));
+						}
+					}
+					else
+					{
+						writer.write(std::move(value.data));
+					}
+				}
+			}
 
-		auto awaitedResult = co_await std::move(result);
+			writer.end_array();
 
-		if (!awaitedResult)
-		{
-			co_return ResolverResult {};
+			co_return std::move(errors);
 		}
 
-		auto modifiedResult = co_await ModifiedResult::convert<Other...>(std::move(*awaitedResult),
-			std::move(params));
-
-		co_return modifiedResult;
-	}
+		ResolverParams params;
+		ResolverParams elementParams;
+		Vector values;
+		std::pmr::vector<AwaitableResolver> children;
+		bool chunked = false;
+		bool cancelled = false;
 
-	// Peel off list modifiers.
-	template <TypeModifier Modifier, TypeModifier... Other>
-	[[nodiscard("unnecessary conversion")]] static AwaitableResolver convert(
-		typename ResultTraits<Type, Modifier, Other...>::future_type result,
-		ResolverParams&& paramsArg)
-		requires ListModifier<Modifier>
-	{
-		if constexpr (!ObjectBaseType<Type>)
+	private:
+		// Await every element, or every chunk of elements, in order before writing any of them.
+		[[nodiscard("unnecessary call")]] internal::Awaitable<void> awaitResults()
 		{
-			auto value = result.get_value();
+			bool incomplete = false;
 
-			if (value)
+			results.reserve(children.size());
+
+			for (auto& child : children)
 			{
-				ModifiedResult::validateScalar<Modifier, Other...>(*value);
-				co_return ResolverResult { response::Value {
-					std::shared_ptr { std::move(value) } } };
+				try
+				{
+					if (!chunked && !child.await_ready())
+					{
+						co_await params.launch;
+					}
+
+					auto value = co_await std::move(child);
+
+					errors.splice(errors.end(), value.errors);
+
+					if (value.stream)
+					{
+						// A nested list which is null is an error for this element.
+						co_await value.stream->prepare();
+					}
+					else if (chunked && value.data.type() != response::Type::List)
+					{
+						// The chunk was cancelled before it started.
+						cancelled = true;
+					}
+
+					results.push_back(std::move(value));
+				}
+				catch (...)
+				{
+					addElementError(errors, elementParams, std::current_exception());
+
+					if (!chunked && isNullable<Other...>())
+					{
+						results.push_back(ResolverResult {});
+					}
+					else
+					{
+						incomplete = true;
+					}
+				}
+
+				std::get<size_t>(elementParams.errorPath->segment) +=
+					chunked ? params.listGrainSize : 1;
+			}
+
+			if (cancelled || incomplete)
+			{
+				// The elements which were started still borrow this list, so they need to finish
+				// before it's destroyed along with the null list field.
+				for (auto& value : results)
+				{
+					if (value.stream)
+					{
+						auto streamErrors = co_await discardStream(std::move(value.stream));
+
+						errors.splice(errors.end(), streamErrors);
+					}
+				}
+
+				if (cancelled)
+				{
+					errors.push_back(getCancellationError());
+				}
+
+				throw schema_exception { std::move(errors) };
 			}
 		}
 
+		std::pmr::vector<ResolverResult> results;
+		std::list<schema_error> errors;
+	};
+
+	// Resolve a chunk of list elements after a single hop to the launch policy. The elements
+	// themselves are resolved synchronously, and the data is a list with one entry for each of
+	// them, or null if the request was cancelled before the chunk started. If an element which
+	// is not nullable fails, it throws the errors so the whole list is null. The elements are
+	// never streamed, a streamed list writes the whole chunk once it has resolved.
+	template <typename Vector, TypeModifier... Other>
+	[[nodiscard("unnecessary conversion")]] static AwaitableResolver convertChunk(Vector& values,
+		size_t begin, size_t end, ResolverParams&& paramsArg)
+	{
 		// Move the paramsArg into a local variable before the first suspension point.
 		auto params = std::move(paramsArg);
 
-		std::vector<AwaitableResolver> children;
-		const auto parentPath = params.errorPath;
+		// Keep the list's batch open across the hop, until the elements in the chunk have started.
+		std::optional<DataLoaderBatch> batch { std::in_place, params.state.get() };
 
 		co_await params.launch;
 
-		auto awaitedResult = co_await std::move(result);
-
-		children.reserve(awaitedResult.size());
-		params.errorPath = std::make_optional(
-			field_path { parentPath ? std::make_optional(std::cref(*parentPath)) : std::nullopt,
-				path_segment { size_t { 0 } } });
-
-		using vector_type = std::decay_t<decltype(awaitedResult)>;
+		if (params.cancellation && params.cancellation->stopRequested())
+		{
+			co_return ResolverResult {};
+		}
 
-		if constexpr (!std::is_same_v<std::decay_t<typename vector_type::reference>,
-						  typename vector_type::value_type>)
+		ResolverParams elementParams { SelectionSetParams {
+										   params.resolverContext,
+										   params.state,
+										   params.operationDirectives,
+										   params.fragmentDefinitionDirectives,
+										   params.fragmentSpreadDirectives,
+										   params.inlineFragmentDirectives,
+										   params.errorPath,
+										   await_async {},
+										   params.plan,
+										   params.cancellation,
+										   params.instrumentation,
+										   params.listGrainSize,
+										   params.memoryResource,
+										   false,
+									   },
+			params.field,
+			std::string { params.fieldName },
+			response::Value { response::Type::Map },
+			Directives {},
+			params.selection,
+			params.fragments,
+			params.variables };
+		std::pmr::vector<AwaitableResolver> children { params.getMemoryResource() };
+
+		children.reserve(end - begin);
+
+		for (size_t i = begin; i < end; ++i)
 		{
-			// Special handling for std::vector<> specializations which don't return a
-			// reference to the underlying type, i.e. std::vector<bool> on many platforms.
-			// Copy the values from the std::vector<> rather than moving them.
-			for (typename vector_type::value_type entry : awaitedResult)
+			if constexpr (!std::is_same_v<std::decay_t<typename Vector::reference>,
+							  typename Vector::value_type>)
 			{
 				children.push_back(
-					ModifiedResult::convert<Other...>(std::move(entry), ResolverParams(params)));
-				++std::get<size_t>(params.errorPath->segment);
+					ModifiedResult::convert<Other...>(typename Vector::value_type { values[i] },
+						ResolverParams(elementParams)));
 			}
-		}
-		else
-		{
-			for (auto& entry : awaitedResult)
+			else
 			{
-				children.push_back(
-					ModifiedResult::convert<Other...>(std::move(entry), ResolverParams(params)));
-				++std::get<size_t>(params.errorPath->segment);
+				children.push_back(ModifiedResult::convert<Other...>(std::move(values[i]),
+					ResolverParams(elementParams)));
 			}
+
+			++std::get<size_t>(elementParams.errorPath->segment);
 		}
 
+		batch.reset();
+
 		ResolverResult document { response::Value { response::Type::List } };
+		bool incomplete = false;
 
 		document.data.reserve(children.size());
-		std::get<size_t>(params.errorPath->segment) = 0;
+		std::get<size_t>(elementParams.errorPath->segment) = begin;
 
 		for (auto& child : children)
 		{
 			try
 			{
-				co_await params.launch;
-
 				auto value = co_await std::move(child);
 
 				document.data.emplace_back(std::move(value.data));
@@ -1217,88 +2397,70 @@ struct ModifiedResult
 					document.errors.splice(document.errors.end(), value.errors);
 				}
 			}
-			catch (schema_exception& scx)
+			catch (...)
 			{
-				auto errors = scx.getStructuredErrors();
+				addElementError(document.errors, elementParams, std::current_exception());
 
-				if (!errors.empty())
+				if constexpr (isNullable<Other...>())
+				{
+					document.data.emplace_back(response::Value {});
+				}
+				else
 				{
-					document.errors.splice(document.errors.end(), errors);
+					incomplete = true;
 				}
 			}
-			catch (const std::exception& ex)
-			{
-				std::ostringstream message;
-
-				message << "Field error name: " << params.fieldName
-						<< " unknown error: " << ex.what();
 
-				document.errors.emplace_back(schema_error { message.str(),
-					params.getLocation(),
-					buildErrorPath(params.errorPath) });
-			}
+			++std::get<size_t>(elementParams.errorPath->segment);
+		}
 
-			++std::get<size_t>(params.errorPath->segment);
+		if (incomplete)
+		{
+			// A non-nullable element failed, so the list which contains this chunk is incomplete.
+			throw schema_exception { std::move(document.errors) };
 		}
 
 		co_return document;
 	}
 
-	// Peel off the none modifier. If it's included, it should always be last in the list.
-	template <TypeModifier Modifier = TypeModifier::None, TypeModifier... Other>
-	static void validateScalar(const response::Value& value)
-		requires OnlyNoneModifiers<Modifier, Other...>
+	template <TypeModifier Modifier, TypeModifier... Other>
+	[[nodiscard("unnecessary conversion")]] static AwaitableResolver convertOptional(
+		typename ResultTraits<Type, Modifier, Other...>::future_type result,
+		ResolverParams&& paramsArg)
 	{
-		static_assert(sizeof...(Other) == 0, "None modifier should always be last");
+		// Move the paramsArg into a local variable before the first suspension point.
+		auto params = std::move(paramsArg);
 
-		// Just call through to the partial specialization without the modifier.
-		Result<Type>::validateScalar(value);
-	}
+		// Keep the parent's batch open across the hop, until the value has started resolving.
+		std::optional<DataLoaderBatch> batch { std::in_place, params.state.get() };
 
-	// Peel off nullable modifiers.
-	template <TypeModifier Modifier, TypeModifier... Other>
-	static void validateScalar(const response::Value& value)
-		requires NullableModifier<Modifier>
-	{
-		if (value.type() != response::Type::Null)
-		{
-			ModifiedResult::validateScalar<Other...>(value);
-		}
-	}
+		co_await params.launch;
 
-	// Peel off list modifiers.
-	template <TypeModifier Modifier, TypeModifier... Other>
-	static void validateScalar(const response::Value& value)
-		requires ListModifier<Modifier>
-	{
-		if (value.type() != response::Type::List)
+		// The field getter may be waiting for a DataLoader, so it can't wait for the batch.
+		if (!result.await_ready())
 		{
-			throw schema_exception { { R"ex(not a valid List value)ex" } };
+			batch.reset();
 		}
 
-		for (size_t i = 0; i < value.size(); ++i)
+		auto awaitedResult = co_await std::move(result);
+
+		if (!awaitedResult)
 		{
-			ModifiedResult::validateScalar<Other...>(value[i]);
+			co_return ResolverResult {};
 		}
-	}
 
-	using ResolverCallback =
-		std::function<response::Value(typename ResultTraits<Type>::type, const ResolverParams&)>;
+		auto modifiedResult =
+			ModifiedResult::convert<Other...>(std::move(*awaitedResult), std::move(params));
 
-	[[nodiscard("unnecessary call")]] static AwaitableResolver resolve(
+		batch.reset();
+
+		co_return co_await std::move(modifiedResult);
+	}
+
+	[[nodiscard("unnecessary call")]] static AwaitableResolver resolveAwaitable(
 		typename ResultTraits<Type>::future_type result, ResolverParams&& paramsArg,
 		ResolverCallback&& resolver)
 	{
-		static_assert(!ObjectBaseType<Type>, "ModfiedResult<Object> needs special handling");
-
-		auto value = result.get_value();
-
-		if (value)
-		{
-			Result<Type>::validateScalar(*value);
-			co_return ResolverResult { response::Value { std::shared_ptr { std::move(value) } } };
-		}
-
 		auto pendingResolver = std::move(resolver);
 		ResolverResult document;
 
@@ -1310,6 +2472,21 @@ struct ModifiedResult
 			co_await params.launch;
 			document.data = pendingResolver(co_await result, params);
 		}
+		catch (...)
+		{
+			addResolverError(document, params, std::current_exception());
+		}
+
+		co_return document;
+	}
+
+	static void addResolverError(ResolverResult& document, const ResolverParams& params,
+		std::exception_ptr exception)
+	{
+		try
+		{
+			std::rethrow_exception(exception);
+		}
 		catch (schema_exception& scx)
 		{
 			auto errors = scx.getStructuredErrors();
@@ -1329,8 +2506,35 @@ struct ModifiedResult
 				params.getLocation(),
 				buildErrorPath(params.errorPath) });
 		}
+	}
 
-		co_return document;
+	static void addElementError(std::list<schema_error>& errors, const ResolverParams& params,
+		std::exception_ptr exception)
+	{
+		try
+		{
+			std::rethrow_exception(exception);
+		}
+		catch (schema_exception& scx)
+		{
+			auto messages = scx.getStructuredErrors();
+
+			if (!messages.empty())
+			{
+				errors.splice(errors.end(), messages);
+			}
+		}
+		catch (const std::exception& ex)
+		{
+			std::ostringstream message;
+
+			message << "Field error name: " << params.fieldName
+					<< " unknown error: " << ex.what();
+
+			errors.emplace_back(schema_error { message.str(),
+				params.getLocation(),
+				buildErrorPath(params.errorPath) });
+		}
 	}
 };
 
@@ -1358,6 +2562,7 @@ using SubscriptionName = std::string;
 using AwaitableSubscribe = internal::Awaitable<SubscriptionKey>;
 using AwaitableUnsubscribe = internal::Awaitable<void>;
 using AwaitableDeliver = internal::Awaitable<void>;
+using AwaitableWrite = internal::Awaitable<void>;
 
 struct [[nodiscard("unnecessary construction")]] RequestResolveParams
 {
@@ -1371,6 +2576,27 @@ struct [[nodiscard("unnecessary construction")]] RequestResolveParams
 
 	// Optional sub-class of RequestState which will be passed to each resolver and field accessor.
 	std::shared_ptr<RequestState> state {};
+
+	// Optional fragment definitions which were already collected from the query, e.g. by the
+	// DocumentCache. If this is empty, they will be collected from the query in Request::resolve.
+	std::shared_ptr<const FragmentMap> fragments {};
+
+	// Optional cancellation token and deadline, e.g. to stop resolving when the client
+	// disconnects. The rest of the response is still returned with an error for the skipped
+	// fields.
+	RequestCancellation cancellation {};
+
+	// Optional instrumentation which measures the phases of the request and each field resolver.
+	std::shared_ptr<RequestInstrumentation> instrumentation {};
+
+	// Optional number of list elements to resolve in each task with an asynchronous launch
+	// policy. Resolving small elements in chunks avoids scheduling a task for each one of them.
+	size_t listGrainSize = 0;
+
+	// Optional memory resource for the coroutine frames and intermediate results of the request,
+	// e.g. a std::pmr::synchronized_pool_resource which can release all of them at once. It must
+	// be thread safe if the launch policy is asynchronous, and outlive the request.
+	std::pmr::memory_resource* memoryResource = nullptr;
 };
 
 struct [[nodiscard("unnecessary construction")]] RequestSubscribeParams
@@ -1455,12 +2681,12 @@ struct [[nodiscard("unnecessary construction")]] OperationData
 	explicit OperationData(std::shared_ptr<RequestState> state,
 		response::Value variables,
 		Directives directives,
-		FragmentMap fragments);
+		std::shared_ptr<const FragmentMap> fragments);
 
 	std::shared_ptr<RequestState> state;
 	response::Value variables;
 	Directives directives;
-	FragmentMap fragments;
+	std::shared_ptr<const FragmentMap> fragments;
 };
 
 // Registration information for subscription, cached in the Request::subscribe call.
@@ -1485,6 +2711,10 @@ struct [[nodiscard("unnecessary construction")]] SubscriptionData
 	std::string operationName;
 	SubscriptionCallback callback;
 	const peg::ast_node& selection;
+
+	// Hash of the document, operation name, and RequestState, computed once when subscribing so
+	// each delivery can group identical subscriptions without hashing the document again.
+	const size_t hash;
 };
 
 // Placeholder for an empty subscription object.
@@ -1495,7 +2725,21 @@ class SubscriptionPlaceholder
 };
 
 // Forward declare just the class type so we can reference it in the Request::_validation member.
-class ValidateExecutableVisitor;
+class ValidateExecutableSchema;
+
+// Limit the estimated cost of an operation before resolving any fields. Each field costs its
+// weight in fieldCosts (or 1 if it is not listed, and 0 for __typename) multiplied by the
+// estimated number of times it will be resolved. A list field multiplies the cost of its
+// selection set by the first matching listSizeArguments argument, or by defaultListSize if it
+// does not have one. A size argument on a field which does not return a list, e.g. a connection,
+// applies to the list fields in its selection set instead.
+struct [[nodiscard("unnecessary construction")]] CostLimits
+{
+	size_t maxCost = std::numeric_limits<size_t>::max();
+	size_t defaultListSize = 10;
+	std::vector<std::string> listSizeArguments { "first", "last" };
+	std::map<std::string, std::map<std::string, size_t, std::less<>>, std::less<>> fieldCosts;
+};
 
 // Request scans the fragment definitions and finds the right operation definition to interpret
 // depending on the operation name (which might be empty for a single-operation document). It
@@ -1519,6 +2763,14 @@ public:
 
 	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] response::AwaitableValue resolve(
 		RequestResolveParams params) const;
+
+	// Stream the response document to the writer in document order as each field or list element
+	// is resolved, so the response::Value for the whole document never needs to be built. Nested
+	// objects and lists are written as they complete too, unless a list might still be null, in
+	// which case it is written once all of its elements have resolved. The writer must outlive
+	// the awaitable.
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] AwaitableWrite resolve(
+		RequestResolveParams params, const response::Writer& writer) const;
 	GRAPHQLSERVICE_EXPORT [[nodiscard("leaked subscription")]] AwaitableSubscribe subscribe(
 		RequestSubscribeParams params);
 	GRAPHQLSERVICE_EXPORT [[nodiscard("potentially leaked subscription")]] AwaitableUnsubscribe
@@ -1526,20 +2778,267 @@ public:
 	GRAPHQLSERVICE_EXPORT [[nodiscard("potentially leaked event")]] AwaitableDeliver deliver(
 		RequestDeliverParams params) const;
 
+	// Set the limits which resolve and subscribe enforce before they resolve any fields, or pass
+	// nullptr to stop enforcing them.
+	GRAPHQLSERVICE_EXPORT void setCostLimits(std::shared_ptr<const CostLimits> limits);
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] std::shared_ptr<const CostLimits>
+	getCostLimits() const;
+
+	// Throw a schema_exception if the estimated cost of the operation exceeds the maxCost in the
+	// CostLimits. The query should already be validated.
+	GRAPHQLSERVICE_EXPORT void checkCost(std::string_view operationType,
+		const peg::ast_node& operationDefinition, const FragmentMap& fragments,
+		const response::Value& variables) const;
+
+	// Reuse the data from the first response to a query which has no variables and only selects
+	// introspection fields at the top level, until the schema changes. The data is cached with the
+	// validated peg::ast, so this only helps if the document is reused, e.g. with a DocumentCache.
+	// Requests with a RequestInstrumentation always resolve the fields. This is off by default.
+	GRAPHQLSERVICE_EXPORT void setCacheIntrospection(bool cacheIntrospection) noexcept;
+
 private:
-	[[nodiscard("leaked subscription")]] SubscriptionKey addSubscription(
-		RequestSubscribeParams && params);
+	// Subscriptions are spread across shards by key, so subscribing or unsubscribing only takes an
+	// exclusive lock on one shard, and concurrent calls to deliver only take shared locks.
+	static constexpr size_t c_subscriptionShards = 16;
+
+	struct SubscriptionNameHash
+	{
+		using is_transparent = void;
+
+		[[nodiscard("unnecessary call")]] size_t operator()(
+			std::string_view name) const noexcept;
+	};
+
+	using SubscriptionMap =
+		std::unordered_map<SubscriptionKey, std::shared_ptr<const SubscriptionData>>;
+
+	struct [[nodiscard("unnecessary construction")]] SubscriptionShard
+	{
+		mutable std::shared_mutex mutex {};
+		SubscriptionMap subscriptions;
+		std::unordered_map<SubscriptionName, SubscriptionMap, SubscriptionNameHash, std::equal_to<>>
+			listeners;
+	};
+
+	[[nodiscard("leaked subscription")]] std::pair<SubscriptionKey,
+		std::shared_ptr<const SubscriptionData>>
+	addSubscription(RequestSubscribeParams && params);
 	void removeSubscription(SubscriptionKey key);
+	[[nodiscard("unnecessary call")]] std::shared_ptr<const SubscriptionData> findSubscription(
+		SubscriptionKey key) const;
 	[[nodiscard("unnecessary call")]] std::vector<std::shared_ptr<const SubscriptionData>>
 	collectRegistrations(std::string_view field, RequestDeliverFilter && filter) const noexcept;
 
 	const TypeMap _operations;
-	mutable std::mutex _validationMutex {};
-	const std::unique_ptr<ValidateExecutableVisitor> _validation;
-	mutable std::mutex _subscriptionMutex {};
-	internal::sorted_map<SubscriptionKey, std::shared_ptr<const SubscriptionData>> _subscriptions;
-	internal::sorted_map<SubscriptionName, internal::sorted_set<SubscriptionKey>> _listeners;
-	SubscriptionKey _nextKey = 0;
+	const std::shared_ptr<const schema::Schema> _schema;
+	const std::shared_ptr<const ValidateExecutableSchema> _validation;
+	std::array<SubscriptionShard, c_subscriptionShards> _subscriptionShards {};
+	std::atomic<SubscriptionKey> _nextKey = 0;
+
+	mutable std::shared_mutex _costMutex {};
+	std::shared_ptr<const CostLimits> _costLimits;
+	std::atomic_bool _cacheIntrospection = false;
+};
+
+// A parsed and validated query document, along with the fragment definitions collected from it.
+// The query AST can be copied cheaply into RequestResolveParams, it only holds shared pointers.
+struct [[nodiscard("unnecessary construction")]] CachedDocument
+{
+	peg::ast query;
+
+	// If any of the fragment definitions have directives, they might reference variables, so they
+	// need to be collected again for each request and this will be empty.
+	std::shared_ptr<const FragmentMap> fragments;
+};
+
+struct [[nodiscard("unnecessary construction")]] DocumentCacheStats
+{
+	size_t hits = 0;
+	size_t misses = 0;
+	size_t evictions = 0;
+	size_t size = 0;
+};
+
+// DocumentCache is a bounded, thread-safe LRU cache of parsed and validated query documents, so a
+// repeated request can skip parsing, validation, and collecting the fragment definitions. Documents
+// may either be looked up by the full query text, or by an id which the caller computes, e.g. the
+// sha256 hash sent by an Automatic Persisted Queries client. It's up to the caller to verify that
+// the id matches the query text before adding a persisted document.
+class [[nodiscard("unnecessary construction")]] DocumentCache
+{
+public:
+	static constexpr size_t c_defaultCapacity = 1024;
+
+	GRAPHQLSERVICE_EXPORT explicit DocumentCache(std::shared_ptr<const Request> service,
+		size_t capacity = c_defaultCapacity, size_t depthLimit = peg::c_defaultDepthLimit);
+
+	// Find the document for this query text, or parse and validate it on a miss. This will throw a
+	// peg::parse_error or a schema_exception if the query is invalid, and it will not be cached.
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] std::shared_ptr<const CachedDocument>
+	getDocument(std::string_view query);
+
+	// Find a persisted document by id, returns nullptr on a miss.
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] std::shared_ptr<const CachedDocument>
+	findPersistedDocument(std::string_view id);
+
+	// Parse, validate, and cache a persisted document by id. This has the same error handling as
+	// getDocument if the query is invalid.
+	GRAPHQLSERVICE_EXPORT std::shared_ptr<const CachedDocument> addPersistedDocument(
+		std::string_view id, std::string_view query);
+
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] DocumentCacheStats getStats() const;
+	GRAPHQLSERVICE_EXPORT void clear();
+
+private:
+	struct [[nodiscard("unnecessary construction")]] Entry
+	{
+		std::string key;
+		bool persisted = false;
+		std::shared_ptr<const CachedDocument> document;
+	};
+
+	using EntryList = std::list<Entry>;
+	using EntryMap = std::unordered_map<std::string_view, EntryList::iterator>;
+
+	[[nodiscard("unnecessary call")]] std::shared_ptr<const CachedDocument> find(
+		EntryMap& entries, std::string_view key);
+	[[nodiscard("unnecessary call")]] std::shared_ptr<const CachedDocument> parseDocument(
+		std::string_view query) const;
+	std::shared_ptr<const CachedDocument> insert(bool persisted, std::string_view key,
+		std::shared_ptr<const CachedDocument> document);
+
+	const std::shared_ptr<const Request> _service;
+	const size_t _capacity;
+	const size_t _depthLimit;
+
+	mutable std::mutex _mutex {};
+
+	// The most recently used entries are at the front of the list, and the maps reference the
+	// key strings owned by each entry.
+	EntryList _entries;
+	EntryMap _queries;
+	EntryMap _persisted;
+	size_t _hits = 0;
+	size_t _misses = 0;
+	size_t _evictions = 0;
+};
+
+struct [[nodiscard("unnecessary construction")]] RequestCoalescerStats
+{
+	size_t resolved = 0;
+	size_t coalesced = 0;
+	size_t inFlight = 0;
+};
+
+// RequestCoalescer shares a single resolution between identical queries which arrive while the
+// first one is still in flight, so a burst of the same query only resolves it once. Requests are
+// identical if they have the same document key, e.g. the query text or persisted query id which
+// was passed to the DocumentCache, the same operationName and variables, and the same partition.
+// Only the first request's RequestState, launch policy, and instrumentation are used for the
+// shared resolution, so the partition must identify everything in the RequestState which the
+// resolvers depend on, e.g. the authenticated user. Mutations and subscriptions are never
+// coalesced. The RequestCoalescer must outlive every request which is still in flight.
+class [[nodiscard("unnecessary construction")]] RequestCoalescer
+{
+public:
+	GRAPHQLSERVICE_EXPORT explicit RequestCoalescer(std::shared_ptr<const Request> service);
+
+	// Resolve the query, or wait for an identical query which is already in flight. Every caller
+	// gets a response::Value which shares the same immutable result, unless its own cancellation
+	// stops it from waiting for the result. Either a stop request or the deadline interrupts the
+	// wait, and a waiter whose deadline passes is resumed on the RequestCoalescer's timer thread
+	// before it hops back to its own launch policy.
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] response::AwaitableValue resolve(
+		std::string_view documentKey, std::string_view partition, RequestResolveParams params);
+
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] RequestCoalescerStats getStats() const;
+
+private:
+	struct Waiter;
+
+	using Deadlines = std::multimap<std::chrono::steady_clock::time_point, std::shared_ptr<Waiter>>;
+
+	// Either the shared result or the caller's own stop token or deadline resumes each waiter,
+	// whichever claims it first.
+	struct [[nodiscard("unnecessary construction")]] Waiter
+	{
+		coro::coroutine_handle<> handle {};
+		std::atomic_bool resumed = true;
+
+		// The entry in _deadlines, guarded by _deadlineMutex.
+		std::optional<Deadlines::iterator> deadline {};
+
+		void resume() noexcept;
+	};
+
+	struct [[nodiscard("unnecessary construction")]] InFlight
+	{
+		std::mutex mutex {};
+		std::atomic_bool ready = false;
+		std::shared_ptr<const response::Value> result {};
+		std::exception_ptr exception {};
+		std::vector<std::shared_ptr<Waiter>> waiters {};
+	};
+
+	struct [[nodiscard("unnecessary construction")]] ResumeWaiter
+	{
+		std::shared_ptr<Waiter> waiter;
+
+		void operator()() const noexcept;
+	};
+
+	// Awaitable result of the query which is in flight, which returns nullptr if the caller's
+	// cancellation stopped waiting for it first.
+	class [[nodiscard("unnecessary construction")]] Wait
+	{
+	public:
+		explicit Wait(RequestCoalescer& coalescer, std::shared_ptr<InFlight> inFlight,
+			const RequestCancellation& cancellation) noexcept;
+		~Wait();
+
+		Wait(const Wait&) = delete;
+		Wait& operator=(const Wait&) = delete;
+
+		[[nodiscard("unexpected call")]] bool await_ready() const noexcept;
+		[[nodiscard("unexpected call")]] bool await_suspend(coro::coroutine_handle<> h);
+		[[nodiscard("unnecessary construction")]] std::shared_ptr<const response::Value>
+		await_resume() const;
+
+	private:
+		RequestCoalescer& _coalescer;
+		const std::shared_ptr<InFlight> _inFlight;
+		const RequestCancellation& _cancellation;
+		const std::shared_ptr<Waiter> _waiter;
+		std::optional<std::stop_callback<ResumeWaiter>> _stopCallback {};
+		bool _deadlineArmed = false;
+	};
+
+	// Resume the waiter on the timer thread once the deadline passes, unless it's disarmed first.
+	void armDeadline(std::chrono::steady_clock::time_point deadline,
+		const std::shared_ptr<Waiter>& waiter);
+	void disarmDeadline(Waiter& waiter) noexcept;
+	void resumeExpiredWaiters(std::stop_token stopToken);
+
+	// The shared resolution runs on its own, without the cancellation or memory resource of the
+	// request which started it, and it publishes the result to the InFlight waiters. It keeps its
+	// own copies of the query and operationName in case that request stops waiting first.
+	internal::Awaitable<void> resolveInFlight(std::string key, std::shared_ptr<InFlight> inFlight,
+		peg::ast query, std::string operationName, RequestResolveParams params);
+
+	const std::shared_ptr<const Request> _service;
+
+	mutable std::mutex _mutex {};
+	std::unordered_map<std::string, std::shared_ptr<InFlight>> _inFlight;
+	size_t _resolved = 0;
+	size_t _coalesced = 0;
+
+	std::mutex _deadlineMutex {};
+	std::condition_variable_any _deadlineCondition {};
+	Deadlines _deadlines {};
+
+	// The timer thread starts with the first deadline. It's declared last, so it stops before
+	// anything it uses is destroyed.
+	std::jthread _deadlineThread {};
 };
 
 } // namespace service
@@ -0,0 +1,106 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#ifndef GRAPHQLTRACING_H
+#define GRAPHQLTRACING_H
+
+#include "graphqlservice/GraphQLService.h"
+
+#include <array>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace graphql::service {
+
+// Latency histogram for a single field. Each bucket counts the resolver calls which took less
+// than 2^i microseconds, and the last bucket counts everything slower than that.
+struct [[nodiscard("unnecessary construction")]] FieldLatency
+{
+	static constexpr size_t c_bucketCount = 24;
+
+	size_t count = 0;
+	std::chrono::nanoseconds total {};
+	std::chrono::nanoseconds min = std::chrono::nanoseconds::max();
+	std::chrono::nanoseconds max {};
+	std::array<size_t, c_bucketCount> buckets {};
+
+	// Estimate a percentile between 0 and 1 from the upper bound of the bucket which contains it.
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] std::chrono::nanoseconds percentile(
+		double fraction) const noexcept;
+};
+
+// Aggregate the latency of every field resolver by type and field name. Share a single instance
+// between all of the TracingInstrumentation objects for a service, it's safe to record latencies
+// from multiple threads at the same time.
+class [[nodiscard("unnecessary construction")]] FieldLatencyHistogram
+{
+public:
+	using FieldLatencies = std::map<std::string,
+		std::map<std::string, FieldLatency, std::less<>>, std::less<>>;
+
+	GRAPHQLSERVICE_EXPORT void record(std::string_view typeName, std::string_view fieldName,
+		std::chrono::steady_clock::duration duration);
+
+	// Copy the latencies which have been recorded so far.
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] FieldLatencies getLatencies() const;
+
+private:
+	mutable std::mutex _mutex {};
+	FieldLatencies _latencies;
+};
+
+// Bundled RequestInstrumentation which records the latency of each field in a shared
+// FieldLatencyHistogram, and optionally adds an Apollo tracing style extensions.tracing member to
+// the response. Construct a new one for each request before parsing the query, so the offsets
+// start at the beginning of the request.
+class [[nodiscard("unnecessary construction")]] TracingInstrumentation : public RequestInstrumentation
+{
+public:
+	GRAPHQLSERVICE_EXPORT explicit TracingInstrumentation(
+		std::shared_ptr<FieldLatencyHistogram> histogram, bool tracing = false);
+
+	GRAPHQLSERVICE_EXPORT void endPhase(RequestPhase phase,
+		std::chrono::steady_clock::duration duration) final;
+	GRAPHQLSERVICE_EXPORT void endField(std::string_view typeName, std::string_view fieldName,
+		const error_path& path, std::chrono::steady_clock::duration duration) final;
+
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] response::Value getExtensions() final;
+
+private:
+	struct [[nodiscard("unnecessary construction")]] Timing
+	{
+		std::chrono::steady_clock::duration startOffset {};
+		std::chrono::steady_clock::duration duration {};
+	};
+
+	struct [[nodiscard("unnecessary construction")]] ResolverTiming : Timing
+	{
+		response::Value path;
+		std::string parentType;
+		std::string fieldName;
+	};
+
+	[[nodiscard("unnecessary call")]] Timing getTiming(
+		std::chrono::steady_clock::duration duration) const noexcept;
+
+	const std::shared_ptr<FieldLatencyHistogram> _histogram;
+	const bool _tracing;
+	const std::chrono::system_clock::time_point _startTime;
+	const std::chrono::steady_clock::time_point _start;
+
+	std::mutex _mutex {};
+	std::array<std::optional<Timing>, 3> _phases {};
+	std::vector<ResolverTiming> _resolvers;
+};
+
+} // namespace graphql::service
+
+#endif // GRAPHQLTRACING_H
@@ -20,12 +20,42 @@
 
 #include "graphqlservice/GraphQLResponse.h"
 
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
 namespace graphql::response {
 
 JSONRESPONSE_EXPORT [[nodiscard("unnecessary conversion")]] std::string toJSON(Value&& response);
 
-JSONRESPONSE_EXPORT [[nodiscard("unnecessary conversion")]] Value parseJSON(
-	const std::string& json);
+// Malformed JSON is reported with the offset in bytes where parsing stopped.
+class [[nodiscard("unnecessary construction")]] json_exception : public std::runtime_error
+{
+public:
+	JSONRESPONSE_EXPORT explicit json_exception(std::string_view message, size_t offset);
+
+	JSONRESPONSE_EXPORT [[nodiscard("unnecessary call")]] size_t offset() const noexcept;
+
+private:
+	[[nodiscard("unnecessary call")]] static std::string getMessage(
+		std::string_view message, size_t offset);
+
+	size_t _offset;
+};
+
+// Parse a complete JSON document, or throw a json_exception if it is malformed.
+JSONRESPONSE_EXPORT [[nodiscard("unnecessary conversion")]] Value parseJSON(std::string_view json);
+
+// Same as parseJSON, but it unescapes strings in place and overwrites the contents of json, which
+// saves copying them to a temporary buffer first.
+JSONRESPONSE_EXPORT [[nodiscard("unnecessary conversion")]] Value parseJSONInSitu(
+	std::string& json);
+
+// Serialize directly to an output stream without buffering the whole document in a string. The
+// stream must outlive the Writer.
+JSONRESPONSE_EXPORT [[nodiscard("unnecessary construction")]] Writer makeJSONWriter(
+	std::ostream& stream);
 
 } // namespace graphql::response
 
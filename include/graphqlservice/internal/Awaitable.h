@@ -16,145 +16,543 @@
 #endif
 // clang-format on
 
-#include <future>
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
 #include <type_traits>
+#include <utility>
+#include <variant>
 
 namespace graphql::internal {
 
+// Coroutine frames for Awaitable results are allocated from the std::pmr::memory_resource named by
+// one of the coroutine's parameters, or from the global heap if there is none. Each frame remembers
+// where it came from, so it can be destroyed on any thread.
 template <typename T>
-class [[nodiscard("unnecessary construction")]] Awaitable;
+concept FrameResourceParam = requires(const T& param) {
+	{
+		param.frameResource()
+	} noexcept -> std::same_as<std::pmr::memory_resource*>;
+};
 
-template <>
-class [[nodiscard("unnecessary construction")]] Awaitable<void>
+// The coroutine starts eagerly, so sibling fields which hop to another thread still resolve in
+// parallel, but the result is stored inline in the coroutine frame instead of a std::promise and
+// std::future shared state. The frame is destroyed by the last of the Awaitable or the completed
+// coroutine, and a coroutine which is awaiting the result is resumed with symmetric transfer.
+class [[nodiscard("unnecessary construction")]] AwaitablePromiseBase
 {
 public:
-	Awaitable(std::future<void> value)
-		: _value { std::move(value) }
+	AwaitablePromiseBase() noexcept = default;
+	AwaitablePromiseBase(const AwaitablePromiseBase&) = delete;
+	AwaitablePromiseBase& operator=(const AwaitablePromiseBase&) = delete;
+
+	[[nodiscard("unnecessary call")]] static void* operator new(size_t size)
 	{
+		return allocateFrame(size, nullptr);
 	}
 
-	void get()
+	// The coroutine's parameters are passed to this overload first. Only the executor creates
+	// coroutines with a FrameResourceParam, e.g. the ResolverParams for each field, so any other
+	// coroutine which the field getters create is allocated from the heap and may outlive the
+	// request's memory resource.
+	template <typename... Args>
+	[[nodiscard("unnecessary call")]] static void* operator new(size_t size, const Args&... args)
 	{
-		_value.get();
+		std::pmr::memory_resource* resource = nullptr;
+
+		static_cast<void>((... || (resource = frameResource(args))));
+
+		return allocateFrame(size, resource);
 	}
 
-	struct promise_type
+	static void operator delete(void* ptr, size_t size) noexcept
 	{
-		[[nodiscard("unnecessary construction")]] Awaitable get_return_object() noexcept
+		const auto frame = static_cast<std::byte*>(ptr) - c_frameHeader;
+		const auto resource = *reinterpret_cast<std::pmr::memory_resource**>(frame);
+
+		if (resource)
+		{
+			resource->deallocate(frame, size + c_frameHeader, c_frameAlignment);
+		}
+		else
+		{
+			::operator delete(frame);
+		}
+	}
+
+	struct [[nodiscard("unnecessary construction")]] final_awaiter
+	{
+		[[nodiscard("unexpected call")]] constexpr bool await_ready() const noexcept
+		{
+			return false;
+		}
+
+		template <typename Promise>
+		[[nodiscard("unexpected call")]] coro::coroutine_handle<> await_suspend(
+			coro::coroutine_handle<Promise> h) const noexcept
+		{
+			return static_cast<AwaitablePromiseBase&>(h.promise()).complete(h);
+		}
+
+		constexpr void await_resume() const noexcept
+		{
+		}
+	};
+
+	[[nodiscard("unnecessary construction")]] coro::suspend_never initial_suspend() const noexcept
+	{
+		return {};
+	}
+
+	[[nodiscard("unnecessary construction")]] final_awaiter final_suspend() const noexcept
+	{
+		return {};
+	}
+
+	void unhandled_exception() noexcept
+	{
+		_exception = std::current_exception();
+	}
+
+	[[nodiscard("unexpected call")]] bool is_ready() const noexcept
+	{
+		return _state.load(std::memory_order_acquire) == c_completed;
+	}
+
+	// Returns false if the coroutine has already completed and the caller should not suspend.
+	[[nodiscard("unexpected call")]] bool set_continuation(coro::coroutine_handle<> h) noexcept
+	{
+		auto expected = c_running;
+
+		return _state.compare_exchange_strong(expected,
+			reinterpret_cast<std::uintptr_t>(h.address()),
+			std::memory_order_acq_rel,
+			std::memory_order_acquire);
+	}
+
+	// Returns true if the coroutine has already completed and the caller should destroy it,
+	// otherwise it will destroy itself when it completes.
+	[[nodiscard("unexpected call")]] bool abandon() noexcept
+	{
+		return _state.exchange(c_abandoned, std::memory_order_acq_rel) == c_completed;
+	}
+
+	// Block the calling thread until the coroutine has completed.
+	void wait()
+	{
+		if (is_ready())
+		{
+			return;
+		}
+
+		std::mutex mutex;
+		std::condition_variable cv;
+		bool done = false;
+
+		signal_when_ready(*this, mutex, cv, done);
+
+		std::unique_lock lock { mutex };
+
+		cv.wait(lock, [&done]() noexcept {
+			return done;
+		});
+	}
+
+protected:
+	void rethrow_exception() const
+	{
+		if (_exception)
 		{
-			return { _promise.get_future() };
+			std::rethrow_exception(_exception);
 		}
+	}
 
-		coro::suspend_never initial_suspend() const noexcept
+private:
+	static constexpr std::uintptr_t c_running = 0;
+	static constexpr std::uintptr_t c_completed = 1;
+	static constexpr std::uintptr_t c_abandoned = 2;
+
+	// Keep the frame aligned after the header which points back to the memory resource.
+	static constexpr size_t c_frameAlignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+	static constexpr size_t c_frameHeader = std::max(sizeof(std::pmr::memory_resource*),
+		c_frameAlignment);
+
+	template <typename Arg>
+	[[nodiscard("unnecessary call")]] static std::pmr::memory_resource* frameResource(
+		const Arg& arg) noexcept
+	{
+		if constexpr (FrameResourceParam<Arg>)
+		{
+			return arg.frameResource();
+		}
+		else
 		{
-			return {};
+			return nullptr;
 		}
+	}
+
+	[[nodiscard("unnecessary call")]] static void* allocateFrame(
+		size_t size, std::pmr::memory_resource* resource)
+	{
+		const auto frame = resource ? resource->allocate(size + c_frameHeader, c_frameAlignment)
+									: ::operator new(size + c_frameHeader);
+
+		*static_cast<std::pmr::memory_resource**>(frame) = resource;
+
+		return static_cast<std::byte*>(frame) + c_frameHeader;
+	}
 
-		coro::suspend_never final_suspend() const noexcept
+	[[nodiscard("unexpected call")]] coro::coroutine_handle<> complete(
+		coro::coroutine_handle<> h) noexcept
+	{
+		const auto previous = _state.exchange(c_completed, std::memory_order_acq_rel);
+
+		switch (previous)
 		{
-			return {};
+			case c_running:
+				break;
+
+			case c_abandoned:
+				h.destroy();
+				break;
+
+			default:
+				return coro::coroutine_handle<>::from_address(reinterpret_cast<void*>(previous));
 		}
 
-		void return_void() noexcept
+		return coro::noop_coroutine();
+	}
+
+	struct blocking_wait
+	{
+		struct promise_type
+		{
+			[[nodiscard("unnecessary construction")]] blocking_wait get_return_object() noexcept
+			{
+				return {};
+			}
+
+			[[nodiscard("unnecessary construction")]] coro::suspend_never initial_suspend()
+				const noexcept
+			{
+				return {};
+			}
+
+			[[nodiscard("unnecessary construction")]] coro::suspend_never final_suspend()
+				const noexcept
+			{
+				return {};
+			}
+
+			void return_void() const noexcept
+			{
+			}
+
+			void unhandled_exception() const noexcept
+			{
+				std::terminate();
+			}
+		};
+	};
+
+	struct [[nodiscard("unnecessary construction")]] ready_awaiter
+	{
+		AwaitablePromiseBase& promise;
+
+		[[nodiscard("unexpected call")]] bool await_ready() const noexcept
 		{
-			_promise.set_value();
+			return promise.is_ready();
 		}
 
-		void unhandled_exception() noexcept
+		[[nodiscard("unexpected call")]] bool await_suspend(
+			coro::coroutine_handle<> h) const noexcept
 		{
-			_promise.set_exception(std::current_exception());
+			return promise.set_continuation(h);
 		}
 
-	private:
-		std::promise<void> _promise;
+		constexpr void await_resume() const noexcept
+		{
+		}
 	};
 
-	[[nodiscard("unexpected call")]] constexpr bool await_ready() const noexcept
+	static blocking_wait signal_when_ready(
+		AwaitablePromiseBase& promise, std::mutex& mutex, std::condition_variable& cv, bool& done)
+	{
+		co_await ready_awaiter { promise };
+
+		// Notify while holding the lock, the waiting thread owns these and it may return as soon
+		// as it can re-acquire the mutex.
+		std::lock_guard lock { mutex };
+
+		done = true;
+		cv.notify_one();
+	}
+
+	std::atomic<std::uintptr_t> _state { c_running };
+	std::exception_ptr _exception {};
+};
+
+template <typename T>
+class [[nodiscard("unnecessary construction")]] AwaitablePromise : public AwaitablePromiseBase
+{
+public:
+	void return_value(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)
 	{
-		return true;
+		_value.emplace(value);
 	}
 
-	void await_suspend(coro::coroutine_handle<> h) const
+	void return_value(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>)
 	{
-		h.resume();
+		_value.emplace(std::move(value));
 	}
 
-	void await_resume()
+	[[nodiscard("unnecessary construction")]] T result()
 	{
-		_value.get();
+		rethrow_exception();
+
+		return std::move(*_value);
 	}
 
 private:
-	std::future<void> _value;
+	std::optional<T> _value {};
+};
+
+template <>
+class [[nodiscard("unnecessary construction")]] AwaitablePromise<void> : public AwaitablePromiseBase
+{
+public:
+	void return_void() const noexcept
+	{
+	}
+
+	void result() const
+	{
+		rethrow_exception();
+	}
 };
 
+// Ownership of a running coroutine frame, shared by Awaitable and the field accessor awaitables
+// in GraphQLService.h which also accept values and std::future results.
 template <typename T>
-class [[nodiscard("unnecessary construction")]] Awaitable
+class [[nodiscard("unnecessary construction")]] AwaitableHandle
 {
 public:
-	Awaitable(std::future<T> value)
-		: _value { std::move(value) }
+	explicit AwaitableHandle(coro::coroutine_handle<> handle, AwaitablePromise<T>& promise) noexcept
+		: _handle { handle }
+		, _promise { &promise }
 	{
 	}
 
+	AwaitableHandle(AwaitableHandle&& other) noexcept
+		: _handle { std::exchange(other._handle, {}) }
+		, _promise { std::exchange(other._promise, nullptr) }
+	{
+	}
+
+	AwaitableHandle& operator=(AwaitableHandle&& other) noexcept
+	{
+		if (this != &other)
+		{
+			release();
+			_handle = std::exchange(other._handle, {});
+			_promise = std::exchange(other._promise, nullptr);
+		}
+
+		return *this;
+	}
+
+	AwaitableHandle(const AwaitableHandle&) = delete;
+	AwaitableHandle& operator=(const AwaitableHandle&) = delete;
+
+	~AwaitableHandle()
+	{
+		release();
+	}
+
+	[[nodiscard("unexpected call")]] bool await_ready() const noexcept
+	{
+		return _promise->is_ready();
+	}
+
+	[[nodiscard("unexpected call")]] bool await_suspend(coro::coroutine_handle<> h) const noexcept
+	{
+		return _promise->set_continuation(h);
+	}
+
+	[[nodiscard("unnecessary construction")]] T await_resume()
+	{
+		return _promise->result();
+	}
+
 	[[nodiscard("unnecessary construction")]] T get()
 	{
-		return _value.get();
+		_promise->wait();
+
+		return _promise->result();
 	}
 
-	struct promise_type
+private:
+	void release() noexcept
 	{
-		[[nodiscard("unnecessary construction")]] Awaitable get_return_object() noexcept
+		if (_promise && _promise->abandon())
 		{
-			return { _promise.get_future() };
+			_handle.destroy();
 		}
 
-		coro::suspend_never initial_suspend() const noexcept
+		_handle = {};
+		_promise = nullptr;
+	}
+
+	coro::coroutine_handle<> _handle;
+	AwaitablePromise<T>* _promise;
+};
+
+template <typename T>
+class [[nodiscard("unnecessary construction")]] Awaitable;
+
+template <>
+class [[nodiscard("unnecessary construction")]] Awaitable<void>
+{
+public:
+	Awaitable() noexcept = default;
+
+	Awaitable(std::exception_ptr exception) noexcept
+		: _exception { std::move(exception) }
+	{
+	}
+
+	Awaitable(AwaitableHandle<void> handle) noexcept
+		: _handle { std::move(handle) }
+	{
+	}
+
+	void get()
+	{
+		if (_handle)
 		{
-			return {};
+			_handle->get();
+			return;
 		}
 
-		coro::suspend_never final_suspend() const noexcept
+		rethrow_exception();
+	}
+
+	struct promise_type : AwaitablePromise<void>
+	{
+		[[nodiscard("unnecessary construction")]] Awaitable get_return_object() noexcept
 		{
-			return {};
+			return { AwaitableHandle<void> { coro::coroutine_handle<promise_type>::from_promise(
+												 *this),
+				*this } };
 		}
+	};
+
+	[[nodiscard("unexpected call")]] bool await_ready() const noexcept
+	{
+		return !_handle || _handle->await_ready();
+	}
 
-		void return_value(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)
+	[[nodiscard("unexpected call")]] bool await_suspend(coro::coroutine_handle<> h) const noexcept
+	{
+		return _handle->await_suspend(h);
+	}
+
+	void await_resume()
+	{
+		if (_handle)
 		{
-			_promise.set_value(value);
+			_handle->await_resume();
+			return;
 		}
 
-		void return_value(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>)
+		rethrow_exception();
+	}
+
+private:
+	void rethrow_exception() const
+	{
+		if (_exception)
 		{
-			_promise.set_value(std::move(value));
+			std::rethrow_exception(_exception);
 		}
+	}
 
-		void unhandled_exception() noexcept
+	std::optional<AwaitableHandle<void>> _handle {};
+	std::exception_ptr _exception {};
+};
+
+template <typename T>
+class [[nodiscard("unnecessary construction")]] Awaitable
+{
+public:
+	Awaitable(T value) noexcept(std::is_nothrow_move_constructible_v<T>)
+		: _value { std::in_place_index<0>, std::move(value) }
+	{
+	}
+
+	Awaitable(std::exception_ptr exception) noexcept
+		: _value { std::in_place_index<1>, std::move(exception) }
+	{
+	}
+
+	Awaitable(AwaitableHandle<T> handle) noexcept
+		: _value { std::in_place_index<2>, std::move(handle) }
+	{
+	}
+
+	[[nodiscard("unnecessary construction")]] T get()
+	{
+		if (_value.index() == 2)
 		{
-			_promise.set_exception(std::current_exception());
+			return std::get<2>(_value).get();
 		}
 
-	private:
-		std::promise<T> _promise;
+		return await_resume();
+	}
+
+	struct promise_type : AwaitablePromise<T>
+	{
+		[[nodiscard("unnecessary construction")]] Awaitable get_return_object() noexcept
+		{
+			return { AwaitableHandle<T> { coro::coroutine_handle<promise_type>::from_promise(*this),
+				*this } };
+		}
 	};
 
-	[[nodiscard("unexpected call")]] constexpr bool await_ready() const noexcept
+	[[nodiscard("unexpected call")]] bool await_ready() const noexcept
 	{
-		return true;
+		return _value.index() != 2 || std::get<2>(_value).await_ready();
 	}
 
-	void await_suspend(coro::coroutine_handle<> h) const
+	[[nodiscard("unexpected call")]] bool await_suspend(coro::coroutine_handle<> h) const noexcept
 	{
-		h.resume();
+		return std::get<2>(_value).await_suspend(h);
 	}
 
 	[[nodiscard("unnecessary construction")]] T await_resume()
 	{
-		return _value.get();
+		switch (_value.index())
+		{
+			case 0:
+				return std::move(std::get<0>(_value));
+
+			case 1:
+				std::rethrow_exception(std::get<1>(_value));
+
+			default:
+				return std::get<2>(_value).await_resume();
+		}
 	}
 
 private:
-	std::future<T> _value;
+	std::variant<T, std::exception_ptr, AwaitableHandle<T>> _value;
 };
 
 } // namespace graphql::internal
@@ -10,8 +10,11 @@
 
 #include "graphqlservice/internal/Schema.h"
 
+#include <unordered_map>
+
 namespace graphql::introspection {
 
+class ObjectCache;
 class Schema;
 class Directive;
 class Type;
@@ -41,6 +44,7 @@ public:
 
 private:
 	const std::shared_ptr<schema::Schema> _schema;
+	const std::shared_ptr<const ObjectCache> _cache;
 };
 
 class [[nodiscard("unnecessary construction")]] Type
@@ -76,7 +80,19 @@ public:
 	getSpecifiedByURL() const;
 
 private:
+	friend class ObjectCache;
+
 	const std::shared_ptr<const schema::BaseType> _type;
+
+	// An ObjectCache fills these in once after it wraps every type. The references to other types
+	// are weak because the types may refer to each other, and the ObjectCache owns all of them.
+	bool _cached = false;
+	std::vector<std::shared_ptr<object::Field>> _fields;
+	std::vector<std::weak_ptr<object::Type>> _interfaces;
+	std::vector<std::weak_ptr<object::Type>> _possibleTypes;
+	std::vector<std::shared_ptr<object::EnumValue>> _enumValues;
+	std::vector<std::shared_ptr<object::InputValue>> _inputFields;
+	std::weak_ptr<object::Type> _ofType;
 };
 
 class [[nodiscard("unnecessary construction")]] Field
@@ -98,7 +114,13 @@ public:
 	getDeprecationReason() const;
 
 private:
+	friend class ObjectCache;
+
 	const std::shared_ptr<const schema::Field> _field;
+
+	bool _cached = false;
+	std::vector<std::shared_ptr<object::InputValue>> _args;
+	std::weak_ptr<object::Type> _typeObject;
 };
 
 class [[nodiscard("unnecessary construction")]] InputValue
@@ -117,7 +139,11 @@ public:
 	getDefaultValue() const;
 
 private:
+	friend class ObjectCache;
+
 	const std::shared_ptr<const schema::InputValue> _inputValue;
+
+	std::weak_ptr<object::Type> _typeObject;
 };
 
 class [[nodiscard("unnecessary construction")]] EnumValue
@@ -156,7 +182,51 @@ public:
 	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] bool getIsRepeatable() const;
 
 private:
+	friend class ObjectCache;
+
 	const std::shared_ptr<const schema::Directive> _directive;
+
+	bool _cached = false;
+	std::vector<std::shared_ptr<object::InputValue>> _args;
+};
+
+// ObjectCache wraps every type and directive in a schema::Schema once, so each request which
+// introspects the schema shares the same object graph instead of allocating its own. The
+// schema::Schema owns the cache and builds it again if the schema changes.
+class [[nodiscard("unnecessary construction")]] ObjectCache
+{
+public:
+	GRAPHQLSERVICE_EXPORT explicit ObjectCache(const schema::Schema& schema);
+
+	// Get the cache for this schema, building it on first use or after the revision changes.
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] static std::shared_ptr<
+		const ObjectCache>
+	get(schema::Schema& schema);
+
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] size_t revision() const noexcept;
+	GRAPHQLSERVICE_EXPORT
+	[[nodiscard("unnecessary call")]] const std::vector<std::shared_ptr<object::Type>>& types()
+		const noexcept;
+	GRAPHQLSERVICE_EXPORT
+	[[nodiscard("unnecessary call")]] const std::vector<std::shared_ptr<object::Directive>>&
+	directives() const noexcept;
+
+	// Find the shared wrapper for a type, or wrap it separately if it's not part of the schema.
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] std::shared_ptr<object::Type> lookupType(
+		const std::shared_ptr<const schema::BaseType>& type) const;
+
+private:
+	[[nodiscard("unnecessary call")]] std::shared_ptr<object::Type> wrapType(
+		const std::shared_ptr<const schema::BaseType>& type);
+	[[nodiscard("unnecessary call")]] std::vector<std::shared_ptr<object::InputValue>>
+	wrapInputValues(const std::vector<std::shared_ptr<const schema::InputValue>>& inputValues);
+	void fillType(Type& type);
+
+	const size_t _revision;
+	std::unordered_map<const schema::BaseType*, std::shared_ptr<object::Type>> _objects;
+	std::vector<std::shared_ptr<Type>> _unfilled;
+	std::vector<std::shared_ptr<object::Type>> _types;
+	std::vector<std::shared_ptr<object::Directive>> _directives;
 };
 
 } // namespace graphql::introspection
@@ -8,6 +8,8 @@
 
 #include "graphqlservice/GraphQLService.h"
 
+#include <atomic>
+#include <mutex>
 #include <shared_mutex>
 
 namespace graphql {
@@ -16,6 +18,8 @@ namespace introspection {
 enum class [[nodiscard("unnecessary conversion")]] TypeKind;
 enum class [[nodiscard("unnecessary conversion")]] DirectiveLocation;
 
+class ObjectCache;
+
 } // namespace introspection
 
 namespace schema {
@@ -72,7 +76,13 @@ public:
 	[[nodiscard("unnecessary call")]] const std::vector<std::shared_ptr<const Directive>>&
 	directives() const noexcept;
 
+	// Each of the Add* methods increments the revision, so anything which is derived from the
+	// whole schema can tell when it needs to be rebuilt.
+	GRAPHQLSERVICE_EXPORT [[nodiscard("unnecessary call")]] size_t revision() const noexcept;
+
 private:
+	friend class introspection::ObjectCache;
+
 	const bool _noIntrospection = false;
 	const std::string_view _description;
 
@@ -88,6 +98,9 @@ private:
 	std::shared_mutex _listWrappersMutex;
 	internal::sorted_map<std::shared_ptr<const BaseType>, std::shared_ptr<const BaseType>>
 		_listWrappers;
+	std::atomic<size_t> _revision = 0;
+	std::shared_mutex _introspectionMutex;
+	std::shared_ptr<const introspection::ObjectCache> _introspectionCache;
 };
 
 class [[nodiscard("unnecessary construction")]] BaseType
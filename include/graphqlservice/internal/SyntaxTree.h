@@ -13,9 +13,12 @@
 #include <tao/pegtl.hpp>
 #include <tao/pegtl/contrib/parse_tree.hpp>
 
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
 #include <string>
 #include <string_view>
-#include <variant>
 #include <vector>
 
 namespace graphql::peg {
@@ -23,9 +26,67 @@ namespace graphql::peg {
 using namespace tao::graphqlpeg;
 namespace peginternal = tao::graphqlpeg::internal;
 
-class [[nodiscard("unnecessary construction")]] ast_node : public parse_tree::basic_node<ast_node>
+// This has the same interface as parse_tree::basic_node<ast_node>, which the parse tree selectors
+// expect, but the children are stored in a std::pmr::vector so they can come from the same arena
+// as the nodes, and the source is a view of the input instead of a copy in every node.
+class [[nodiscard("unnecessary construction")]] ast_node
 {
 public:
+	using node_t = ast_node;
+	using children_t = std::pmr::vector<std::unique_ptr<ast_node>>;
+
+	// Nodes which are created while parsing a document are allocated from an arena owned by the
+	// root of that document, so they do not need to be freed one at a time. Their children are
+	// allocated from the same arena.
+	[[nodiscard("unnecessary allocation")]] GRAPHQLPEG_EXPORT static void* operator new(
+		std::size_t size);
+	GRAPHQLPEG_EXPORT static void operator delete(void* ptr) noexcept;
+
+	GRAPHQLPEG_EXPORT ast_node() noexcept;
+
+	ast_node(const ast_node&) = delete;
+	ast_node(ast_node&&) = delete;
+	~ast_node() = default;
+
+	ast_node& operator=(const ast_node&) = delete;
+	ast_node& operator=(ast_node&&) = delete;
+
+	children_t children;
+	std::string_view source;
+
+	peginternal::iterator m_begin;
+	peginternal::iterator m_end;
+
+	[[nodiscard("unnecessary call")]] bool is_root() const noexcept
+	{
+		return _type_name.empty();
+	}
+
+	[[nodiscard("unnecessary call")]] position begin() const
+	{
+		return position(m_begin, std::string { source });
+	}
+
+	[[nodiscard("unnecessary call")]] position end() const
+	{
+		return position(m_end, std::string { source });
+	}
+
+	[[nodiscard("unnecessary call")]] bool has_content() const noexcept
+	{
+		return m_end.data != nullptr;
+	}
+
+	[[nodiscard("unnecessary call")]] std::string_view string_view() const noexcept
+	{
+		return { m_begin.data, static_cast<std::size_t>(m_end.data - m_begin.data) };
+	}
+
+	[[nodiscard("unnecessary call")]] std::string string() const
+	{
+		return std::string { string_view() };
+	}
+
 	GRAPHQLPEG_EXPORT void remove_content() noexcept;
 
 	GRAPHQLPEG_EXPORT void unescaped_view(std::string_view unescaped) noexcept;
@@ -45,14 +106,35 @@ public:
 			&& (_type_name.data() == u.data() || (_type_hash == type_hash<U>() && _type_name == u));
 	}
 
-	using basic_node_t = parse_tree::basic_node<ast_node>;
-
-	template <typename Rule, typename ParseInput>
-	void success(const ParseInput& in)
+	template <typename Rule, typename ParseInput, typename... States>
+	void start(const ParseInput& in, States&&... /*unused*/)
 	{
-		basic_node_t::template success<Rule>(in);
 		_type_name = type_name<Rule>();
 		_type_hash = type_hash<Rule>();
+		source = in.source();
+		m_begin = peginternal::iterator(in.iterator());
+	}
+
+	template <typename Rule, typename ParseInput, typename... States>
+	void success(const ParseInput& in, States&&... /*unused*/) noexcept
+	{
+		m_end = peginternal::iterator(in.iterator());
+	}
+
+	template <typename Rule, typename ParseInput, typename... States>
+	void failure(const ParseInput& /*unused*/, States&&... /*unused*/) noexcept
+	{
+	}
+
+	template <typename Rule, typename ParseInput, typename... States>
+	void unwind(const ParseInput& /*unused*/, States&&... /*unused*/) noexcept
+	{
+	}
+
+	template <typename... States>
+	void emplace_back(std::unique_ptr<ast_node>&& child, States&&... /*unused*/)
+	{
+		children.emplace_back(std::move(child));
 	}
 
 private:
@@ -81,9 +163,10 @@ private:
 	std::string_view _type_name;
 	size_t _type_hash = 0;
 
-	using unescaped_t = std::variant<std::string_view, std::string>;
-
-	mutable std::unique_ptr<unescaped_t> _unescaped;
+	// Most unescaped values are a view of the input or a string literal, only the values which need
+	// to be joined or decoded allocate a separate string.
+	mutable std::optional<std::string_view> _unescaped;
+	mutable std::unique_ptr<std::string> _unescapedValue;
 };
 
 } // namespace graphql::peg
@@ -75,8 +75,8 @@ private:
 
 	const std::unique_ptr<const Concept> _pimpl;
 
-	[[nodiscard("unnecessary call")]] service::TypeNames getTypeNames() const noexcept;
-	[[nodiscard("unnecessary call")]] service::ResolverMap getResolvers() const noexcept;
+	[[nodiscard("unnecessary call")]] static const service::TypeNames& getTypeNames() noexcept;
+	[[nodiscard("unnecessary call")]] static const service::ResolverTable& getResolvers() noexcept;
 
 public:
 	GRAPHQLSERVICE_EXPORT explicit Directive(std::shared_ptr<introspection::Directive> pimpl) noexcept;
@@ -110,8 +110,8 @@ private:
 
 	const std::unique_ptr<const Concept> _pimpl;
 
-	[[nodiscard("unnecessary call")]] service::TypeNames getTypeNames() const noexcept;
-	[[nodiscard("unnecessary call")]] service::ResolverMap getResolvers() const noexcept;
+	[[nodiscard("unnecessary call")]] static const service::TypeNames& getTypeNames() noexcept;
+	[[nodiscard("unnecessary call")]] static const service::ResolverTable& getResolvers() noexcept;
 
 public:
 	GRAPHQLSERVICE_EXPORT explicit Type(std::shared_ptr<introspection::Type> pimpl) noexcept;
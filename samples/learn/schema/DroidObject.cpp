@@ -22,29 +22,33 @@ namespace graphql::learn {
 namespace object {
 
 Droid::Droid(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(Droid)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames Droid::getTypeNames() const noexcept
+const service::TypeNames& Droid::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(Character)gql"sv,
 		R"gql(Droid)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Droid::getResolvers() const noexcept
+const service::ResolverTable& Droid::getResolvers() noexcept
 {
-	return {
-		{ R"gql(id)gql"sv, [this](service::ResolverParams&& params) { return resolveId(std::move(params)); } },
-		{ R"gql(name)gql"sv, [this](service::ResolverParams&& params) { return resolveName(std::move(params)); } },
-		{ R"gql(friends)gql"sv, [this](service::ResolverParams&& params) { return resolveFriends(std::move(params)); } },
-		{ R"gql(appearsIn)gql"sv, [this](service::ResolverParams&& params) { return resolveAppearsIn(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(primaryFunction)gql"sv, [this](service::ResolverParams&& params) { return resolvePrimaryFunction(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(id)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Droid&>(object).resolveId(std::move(params)); } },
+		{ R"gql(name)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Droid&>(object).resolveName(std::move(params)); } },
+		{ R"gql(friends)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Droid&>(object).resolveFriends(std::move(params)); } },
+		{ R"gql(appearsIn)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Droid&>(object).resolveAppearsIn(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Droid&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(primaryFunction)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Droid&>(object).resolvePrimaryFunction(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void Droid::beginSelectionSet(const service::SelectionSetParams& params) const
@@ -225,8 +225,8 @@ private:
 		return implements::HumanIs<I>;
 	}
 
-	[[nodiscard("unnecessary call")]] service::TypeNames getTypeNames() const noexcept;
-	[[nodiscard("unnecessary call")]] service::ResolverMap getResolvers() const noexcept;
+	[[nodiscard("unnecessary call")]] static const service::TypeNames& getTypeNames() noexcept;
+	[[nodiscard("unnecessary call")]] static const service::ResolverTable& getResolvers() noexcept;
 
 	void beginSelectionSet(const service::SelectionSetParams& params) const override;
 	void endSelectionSet(const service::SelectionSetParams& params) const override;
@@ -21,25 +21,29 @@ namespace graphql::learn {
 namespace object {
 
 Review::Review(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(Review)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames Review::getTypeNames() const noexcept
+const service::TypeNames& Review::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(Review)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Review::getResolvers() const noexcept
+const service::ResolverTable& Review::getResolvers() noexcept
 {
-	return {
-		{ R"gql(stars)gql"sv, [this](service::ResolverParams&& params) { return resolveStars(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(commentary)gql"sv, [this](service::ResolverParams&& params) { return resolveCommentary(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(stars)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Review&>(object).resolveStars(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Review&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(commentary)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Review&>(object).resolveCommentary(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void Review::beginSelectionSet(const service::SelectionSetParams& params) const
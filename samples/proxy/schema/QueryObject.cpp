@@ -22,27 +22,31 @@ namespace graphql::proxy {
 namespace object {
 
 Query::Query(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(Query)gql"sv }
 	, _schema { GetSchema() }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames Query::getTypeNames() const noexcept
+const service::TypeNames& Query::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(Query)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Query::getResolvers() const noexcept
+const service::ResolverTable& Query::getResolvers() noexcept
 {
-	return {
-		{ R"gql(relay)gql"sv, [this](service::ResolverParams&& params) { return resolveRelay(std::move(params)); } },
-		{ R"gql(__type)gql"sv, [this](service::ResolverParams&& params) { return resolve_type(std::move(params)); } },
-		{ R"gql(__schema)gql"sv, [this](service::ResolverParams&& params) { return resolve_schema(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(relay)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Query&>(object).resolveRelay(std::move(params)); } },
+		{ R"gql(__type)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Query&>(object).resolve_type(std::move(params)); } },
+		{ R"gql(__schema)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Query&>(object).resolve_schema(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Query&>(object).resolve_typename(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void Query::beginSelectionSet(const service::SelectionSetParams& params) const
@@ -83,7 +87,7 @@ service::AwaitableResolver Query::resolve_type(service::ResolverParams&& params)
 {
 	auto argName = service::ModifiedArgument<std::string>::require("name", params.arguments);
 	const auto& baseType = _schema->LookupType(argName);
-	std::shared_ptr<introspection::object::Type> result { baseType ? std::make_shared<introspection::object::Type>(std::make_shared<introspection::Type>(baseType)) : nullptr };
+	std::shared_ptr<introspection::object::Type> result { baseType ? introspection::ObjectCache::get(*_schema)->lookupType(baseType) : nullptr };
 
 	return service::ModifiedResult<introspection::object::Type>::convert<service::TypeModifier::Nullable>(result, std::move(params));
 }
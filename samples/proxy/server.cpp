@@ -27,7 +27,6 @@
 #include <iostream>
 #include <iterator>
 #include <memory>
-#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -118,11 +117,7 @@ int main()
 									}
 									else
 									{
-										std::ostringstream oss;
-
-										oss << req.body();
-
-										auto payload = response::parseJSON(oss.str());
+										auto payload = response::parseJSONInSitu(req.body());
 
 										if (payload.type() != response::Type::Map)
 										{
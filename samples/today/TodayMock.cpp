@@ -845,9 +845,9 @@ std::shared_ptr<object::Node> Subscription::getNodeChange(const response::IdType
 	throw std::runtime_error("Unexpected call to getNodeChange");
 }
 
-size_t NextAppointmentChange::_notifySubscribeCount = 0;
-size_t NextAppointmentChange::_subscriptionCount = 0;
-size_t NextAppointmentChange::_notifyUnsubscribeCount = 0;
+std::atomic_size_t NextAppointmentChange::_notifySubscribeCount = 0;
+std::atomic_size_t NextAppointmentChange::_subscriptionCount = 0;
+std::atomic_size_t NextAppointmentChange::_notifyUnsubscribeCount = 0;
 
 NextAppointmentChange::NextAppointmentChange(nextAppointmentChange&& changeNextAppointment)
 	: _changeNextAppointment(std::move(changeNextAppointment))
@@ -929,15 +929,15 @@ NestedType::NestedType(service::FieldParams&& params, int depth)
 	: depth(depth)
 {
 	_capturedParams.push({ { params.operationDirectives },
-		params.fragmentDefinitionDirectives->empty()
+		params.fragmentDefinitionDirectives.empty()
 			? service::Directives {}
-			: service::Directives { params.fragmentDefinitionDirectives->front().get() },
-		params.fragmentSpreadDirectives->empty()
+			: service::Directives { params.fragmentDefinitionDirectives.front().get() },
+		params.fragmentSpreadDirectives.empty()
 			? service::Directives {}
-			: service::Directives { params.fragmentSpreadDirectives->front() },
-		params.inlineFragmentDirectives->empty()
+			: service::Directives { params.fragmentSpreadDirectives.front() },
+		params.inlineFragmentDirectives.empty()
 			? service::Directives {}
-			: service::Directives { params.inlineFragmentDirectives->front() },
+			: service::Directives { params.inlineFragmentDirectives.front() },
 		std::move(params.fieldDirectives) });
 }
 
@@ -0,0 +1,96 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "graphqlservice/internal/Base64.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace graphql;
+
+using namespace std::literals;
+
+void outputDuration(std::string_view name, size_t size, size_t iterations,
+	const std::chrono::steady_clock::duration& totalDuration) noexcept
+{
+	std::cout << name << " " << size << " bytes: "
+			  << (std::chrono::duration_cast<std::chrono::nanoseconds>(totalDuration).count()
+					 / static_cast<long long>(iterations))
+			  << " nanoseconds per ID" << std::endl;
+}
+
+template <typename Convert>
+void measure(std::string_view name, size_t size, size_t iterations, Convert&& convert)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	for (size_t i = 0; i < iterations; ++i)
+	{
+		convert();
+	}
+
+	outputDuration(name, size, iterations, std::chrono::steady_clock::now() - start);
+}
+
+int main(int argc, char** argv)
+{
+	const auto parseArg = [](const char* arg, size_t defaultValue) noexcept -> size_t {
+		if (arg)
+		{
+			const int parsed = std::atoi(arg);
+
+			if (parsed > 0)
+			{
+				return static_cast<size_t>(parsed);
+			}
+		}
+
+		return defaultValue;
+	};
+
+	// Default to 1000000 iterations for each size of ID.
+	const size_t iterations = parseArg((argc > 1) ? argv[1] : nullptr, 1000000);
+
+	std::cout << "Iterations: " << iterations << std::endl;
+
+	try
+	{
+		for (const size_t size : { 12, 32, 48, 64, 256 })
+		{
+			std::vector<std::uint8_t> bytes(size);
+
+			for (size_t i = 0; i < size; ++i)
+			{
+				bytes[i] = static_cast<std::uint8_t>((i * 131) + 17);
+			}
+
+			const auto encoded = internal::Base64::toBase64(bytes);
+
+			if (internal::Base64::fromBase64(encoded) != bytes)
+			{
+				std::cerr << "Failed to decode the encoded ID!" << std::endl;
+				return 1;
+			}
+
+			measure("toBase64"sv, size, iterations, [&bytes]() {
+				static_cast<void>(internal::Base64::toBase64(bytes));
+			});
+
+			measure("fromBase64"sv, size, iterations, [&encoded]() {
+				static_cast<void>(internal::Base64::fromBase64(encoded));
+			});
+		}
+	}
+	catch (const std::logic_error& ex)
+	{
+		std::cerr << ex.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -9,6 +9,7 @@
 #include <iostream>
 #include <iterator>
 #include <numeric>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -61,6 +62,10 @@ void outputSegment(
 
 int main(int argc, char** argv)
 {
+	// Pass --cached as the first argument to look up the parsed and validated query in a
+	// DocumentCache instead of parsing and validating it on every iteration.
+	const bool cached = (argc > 1 && argv[1] == "--cached"sv);
+	const int argIterations = cached ? 2 : 1;
 	const size_t iterations = [](const char* arg) noexcept -> size_t {
 		if (arg)
 		{
@@ -74,12 +79,20 @@ int main(int argc, char** argv)
 
 		// Default to 100 iterations
 		return 100;
-	}((argc > 1) ? argv[1] : nullptr);
+	}((argc > argIterations) ? argv[argIterations] : nullptr);
 
 	std::cout << "Iterations: " << iterations << std::endl;
 
 	const auto mockService = today::mock_service();
 	const auto& service = mockService->service;
+	std::optional<service::DocumentCache> documentCache;
+
+	if (cached)
+	{
+		std::cout << "Using the DocumentCache" << std::endl;
+		documentCache.emplace(service);
+	}
+
 	std::vector<std::chrono::steady_clock::duration> durationParse(iterations);
 	std::vector<std::chrono::steady_clock::duration> durationValidate(iterations);
 	std::vector<std::chrono::steady_clock::duration> durationResolve(iterations);
@@ -91,7 +104,7 @@ int main(int argc, char** argv)
 		for (size_t i = 0; i < iterations; ++i)
 		{
 			const auto startParse = std::chrono::steady_clock::now();
-			auto query = peg::parseString(R"gql(query {
+			constexpr auto queryText = R"gql(query {
 				appointments {
 					pageInfo { hasNextPage }
 					edges {
@@ -103,7 +116,21 @@ int main(int argc, char** argv)
 						}
 					}
 				}
-			})gql"sv);
+			})gql"sv;
+			std::shared_ptr<const service::FragmentMap> fragments;
+			auto query = [&]() {
+				if (documentCache)
+				{
+					// A hit skips both parsing and validation, so those are both attributed to
+					// the Parse segment.
+					auto document = documentCache->getDocument(queryText);
+
+					fragments = document->fragments;
+					return document->query;
+				}
+
+				return peg::parseString(queryText);
+			}();
 			const auto startValidate = std::chrono::steady_clock::now();
 
 			if (!service->validate(query).empty())
@@ -113,7 +140,7 @@ int main(int argc, char** argv)
 			}
 
 			const auto startResolve = std::chrono::steady_clock::now();
-			auto response = service->resolve({ query }).get();
+			auto response = service->resolve({ query, {}, {}, {}, {}, std::move(fragments) }).get();
 			const auto startToJson = std::chrono::steady_clock::now();
 
 			if (response::toJSON(std::move(response)).empty())
@@ -146,5 +173,13 @@ int main(int argc, char** argv)
 	outputSegment("Resolve"sv, durationResolve);
 	outputSegment("ToJSON"sv, durationToJson);
 
+	if (documentCache)
+	{
+		const auto stats = documentCache->getStats();
+
+		std::cout << "DocumentCache: " << stats.hits << " hits, " << stats.misses << " misses, "
+				  << stats.evictions << " evictions, " << stats.size << " entries" << std::endl;
+	}
+
 	return 0;
 }
@@ -23,25 +23,29 @@ namespace graphql::today {
 namespace object {
 
 AppointmentConnection::AppointmentConnection(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(AppointmentConnection)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames AppointmentConnection::getTypeNames() const noexcept
+const service::TypeNames& AppointmentConnection::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(AppointmentConnection)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap AppointmentConnection::getResolvers() const noexcept
+const service::ResolverTable& AppointmentConnection::getResolvers() noexcept
 {
-	return {
-		{ R"gql(edges)gql"sv, [this](service::ResolverParams&& params) { return resolveEdges(std::move(params)); } },
-		{ R"gql(pageInfo)gql"sv, [this](service::ResolverParams&& params) { return resolvePageInfo(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(edges)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const AppointmentConnection&>(object).resolveEdges(std::move(params)); } },
+		{ R"gql(pageInfo)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const AppointmentConnection&>(object).resolvePageInfo(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const AppointmentConnection&>(object).resolve_typename(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void AppointmentConnection::beginSelectionSet(const service::SelectionSetParams& params) const
@@ -22,25 +22,29 @@ namespace graphql::today {
 namespace object {
 
 AppointmentEdge::AppointmentEdge(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(AppointmentEdge)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames AppointmentEdge::getTypeNames() const noexcept
+const service::TypeNames& AppointmentEdge::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(AppointmentEdge)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap AppointmentEdge::getResolvers() const noexcept
+const service::ResolverTable& AppointmentEdge::getResolvers() noexcept
 {
-	return {
-		{ R"gql(node)gql"sv, [this](service::ResolverParams&& params) { return resolveNode(std::move(params)); } },
-		{ R"gql(cursor)gql"sv, [this](service::ResolverParams&& params) { return resolveCursor(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(node)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const AppointmentEdge&>(object).resolveNode(std::move(params)); } },
+		{ R"gql(cursor)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const AppointmentEdge&>(object).resolveCursor(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const AppointmentEdge&>(object).resolve_typename(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void AppointmentEdge::beginSelectionSet(const service::SelectionSetParams& params) const
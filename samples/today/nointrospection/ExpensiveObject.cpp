@@ -21,24 +21,28 @@ namespace graphql::today {
 namespace object {
 
 Expensive::Expensive(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(Expensive)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames Expensive::getTypeNames() const noexcept
+const service::TypeNames& Expensive::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(Expensive)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Expensive::getResolvers() const noexcept
+const service::ResolverTable& Expensive::getResolvers() noexcept
 {
-	return {
-		{ R"gql(order)gql"sv, [this](service::ResolverParams&& params) { return resolveOrder(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(order)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Expensive&>(object).resolveOrder(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Expensive&>(object).resolve_typename(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void Expensive::beginSelectionSet(const service::SelectionSetParams& params) const
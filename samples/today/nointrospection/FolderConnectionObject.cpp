@@ -23,25 +23,29 @@ namespace graphql::today {
 namespace object {
 
 FolderConnection::FolderConnection(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(FolderConnection)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames FolderConnection::getTypeNames() const noexcept
+const service::TypeNames& FolderConnection::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(FolderConnection)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap FolderConnection::getResolvers() const noexcept
+const service::ResolverTable& FolderConnection::getResolvers() noexcept
 {
-	return {
-		{ R"gql(edges)gql"sv, [this](service::ResolverParams&& params) { return resolveEdges(std::move(params)); } },
-		{ R"gql(pageInfo)gql"sv, [this](service::ResolverParams&& params) { return resolvePageInfo(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(edges)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const FolderConnection&>(object).resolveEdges(std::move(params)); } },
+		{ R"gql(pageInfo)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const FolderConnection&>(object).resolvePageInfo(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const FolderConnection&>(object).resolve_typename(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void FolderConnection::beginSelectionSet(const service::SelectionSetParams& params) const
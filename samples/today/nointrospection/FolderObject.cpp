@@ -21,28 +21,32 @@ namespace graphql::today {
 namespace object {
 
 Folder::Folder(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(Folder)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames Folder::getTypeNames() const noexcept
+const service::TypeNames& Folder::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(Node)gql"sv,
 		R"gql(UnionType)gql"sv,
 		R"gql(Folder)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Folder::getResolvers() const noexcept
+const service::ResolverTable& Folder::getResolvers() noexcept
 {
-	return {
-		{ R"gql(id)gql"sv, [this](service::ResolverParams&& params) { return resolveId(std::move(params)); } },
-		{ R"gql(name)gql"sv, [this](service::ResolverParams&& params) { return resolveName(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(unreadCount)gql"sv, [this](service::ResolverParams&& params) { return resolveUnreadCount(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(id)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Folder&>(object).resolveId(std::move(params)); } },
+		{ R"gql(name)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Folder&>(object).resolveName(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Folder&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(unreadCount)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Folder&>(object).resolveUnreadCount(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void Folder::beginSelectionSet(const service::SelectionSetParams& params) const
@@ -22,25 +22,29 @@ namespace graphql::today {
 namespace object {
 
 NestedType::NestedType(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(NestedType)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames NestedType::getTypeNames() const noexcept
+const service::TypeNames& NestedType::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(NestedType)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap NestedType::getResolvers() const noexcept
+const service::ResolverTable& NestedType::getResolvers() noexcept
 {
-	return {
-		{ R"gql(depth)gql"sv, [this](service::ResolverParams&& params) { return resolveDepth(std::move(params)); } },
-		{ R"gql(nested)gql"sv, [this](service::ResolverParams&& params) { return resolveNested(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(depth)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const NestedType&>(object).resolveDepth(std::move(params)); } },
+		{ R"gql(nested)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const NestedType&>(object).resolveNested(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const NestedType&>(object).resolve_typename(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void NestedType::beginSelectionSet(const service::SelectionSetParams& params) const
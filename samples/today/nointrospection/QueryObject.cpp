@@ -31,36 +31,40 @@ namespace graphql::today {
 namespace object {
 
 Query::Query(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(Query)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames Query::getTypeNames() const noexcept
+const service::TypeNames& Query::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(Query)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Query::getResolvers() const noexcept
+const service::ResolverTable& Query::getResolvers() noexcept
 {
-	return {
-		{ R"gql(node)gql"sv, [this](service::ResolverParams&& params) { return resolveNode(std::move(params)); } },
-		{ R"gql(tasks)gql"sv, [this](service::ResolverParams&& params) { return resolveTasks(std::move(params)); } },
-		{ R"gql(nested)gql"sv, [this](service::ResolverParams&& params) { return resolveNested(std::move(params)); } },
-		{ R"gql(anyType)gql"sv, [this](service::ResolverParams&& params) { return resolveAnyType(std::move(params)); } },
-		{ R"gql(default)gql"sv, [this](service::ResolverParams&& params) { return resolveDefault(std::move(params)); } },
-		{ R"gql(expensive)gql"sv, [this](service::ResolverParams&& params) { return resolveExpensive(std::move(params)); } },
-		{ R"gql(tasksById)gql"sv, [this](service::ResolverParams&& params) { return resolveTasksById(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(appointments)gql"sv, [this](service::ResolverParams&& params) { return resolveAppointments(std::move(params)); } },
-		{ R"gql(unreadCounts)gql"sv, [this](service::ResolverParams&& params) { return resolveUnreadCounts(std::move(params)); } },
-		{ R"gql(testTaskState)gql"sv, [this](service::ResolverParams&& params) { return resolveTestTaskState(std::move(params)); } },
-		{ R"gql(unimplemented)gql"sv, [this](service::ResolverParams&& params) { return resolveUnimplemented(std::move(params)); } },
-		{ R"gql(appointmentsById)gql"sv, [this](service::ResolverParams&& params) { return resolveAppointmentsById(std::move(params)); } },
-		{ R"gql(unreadCountsById)gql"sv, [this](service::ResolverParams&& params) { return resolveUnreadCountsById(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(node)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Query&>(object).resolveNode(std::move(params)); } },
+		{ R"gql(tasks)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Query&>(object).resolveTasks(std::move(params)); } },
+		{ R"gql(nested)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Query&>(object).resolveNested(std::move(params)); } },
+		{ R"gql(anyType)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Query&>(object).resolveAnyType(std::move(params)); } },
+		{ R"gql(default)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Query&>(object).resolveDefault(std::move(params)); } },
+		{ R"gql(expensive)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Query&>(object).resolveExpensive(std::move(params)); } },
+		{ R"gql(tasksById)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Query&>(object).resolveTasksById(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Query&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(appointments)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Query&>(object).resolveAppointments(std::move(params)); } },
+		{ R"gql(unreadCounts)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Query&>(object).resolveUnreadCounts(std::move(params)); } },
+		{ R"gql(testTaskState)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Query&>(object).resolveTestTaskState(std::move(params)); } },
+		{ R"gql(unimplemented)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Query&>(object).resolveUnimplemented(std::move(params)); } },
+		{ R"gql(appointmentsById)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Query&>(object).resolveAppointmentsById(std::move(params)); } },
+		{ R"gql(unreadCountsById)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Query&>(object).resolveUnreadCountsById(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void Query::beginSelectionSet(const service::SelectionSetParams& params) const
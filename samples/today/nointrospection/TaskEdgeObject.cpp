@@ -22,25 +22,29 @@ namespace graphql::today {
 namespace object {
 
 TaskEdge::TaskEdge(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(TaskEdge)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames TaskEdge::getTypeNames() const noexcept
+const service::TypeNames& TaskEdge::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(TaskEdge)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap TaskEdge::getResolvers() const noexcept
+const service::ResolverTable& TaskEdge::getResolvers() noexcept
 {
-	return {
-		{ R"gql(node)gql"sv, [this](service::ResolverParams&& params) { return resolveNode(std::move(params)); } },
-		{ R"gql(cursor)gql"sv, [this](service::ResolverParams&& params) { return resolveCursor(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(node)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const TaskEdge&>(object).resolveNode(std::move(params)); } },
+		{ R"gql(cursor)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const TaskEdge&>(object).resolveCursor(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const TaskEdge&>(object).resolve_typename(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void TaskEdge::beginSelectionSet(const service::SelectionSetParams& params) const
@@ -0,0 +1,141 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "graphqlservice/GraphQLParse.h"
+
+#include "graphqlservice/internal/Grammar.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+using namespace graphql;
+
+using namespace std::literals;
+
+constexpr auto c_operation = R"gql(
+query Operation%1 {
+	appointments { edges { node { id when subject isNow } } }
+	tasks { edges { node { id title isComplete } } }
+	unreadCounts { edges { node { id name unreadCount } } }
+}
+)gql"sv;
+
+std::string repeatOperations(size_t count)
+{
+	std::string document;
+
+	document.reserve(count * (c_operation.size() + 8));
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		std::string operation { c_operation };
+		const auto suffix = operation.find("%1"sv);
+
+		operation.replace(suffix, 2, std::to_string(i));
+		document.append(operation);
+	}
+
+	return document;
+}
+
+void outputDuration(std::string_view name, size_t iterations,
+	const std::chrono::steady_clock::duration& totalDuration) noexcept
+{
+	std::cout << name << ": "
+			  << (std::chrono::duration_cast<std::chrono::microseconds>(totalDuration).count()
+					 / static_cast<long long>(iterations))
+			  << " microseconds per document" << std::endl;
+}
+
+template <typename Parse>
+void measure(std::string_view name, size_t iterations, Parse&& parse)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	for (size_t i = 0; i < iterations; ++i)
+	{
+		try
+		{
+			parse();
+		}
+		catch (const peg::parse_error&)
+		{
+			// The malformed documents are expected to fail.
+		}
+	}
+
+	outputDuration(name, iterations, std::chrono::steady_clock::now() - start);
+}
+
+int main(int argc, char** argv)
+{
+	const auto parseArg = [](const char* arg, size_t defaultValue) noexcept -> size_t {
+		if (arg)
+		{
+			const int parsed = std::atoi(arg);
+
+			if (parsed > 0)
+			{
+				return static_cast<size_t>(parsed);
+			}
+		}
+
+		return defaultValue;
+	};
+
+	// Default to 100 iterations of documents with 100 operations each.
+	const size_t iterations = parseArg((argc > 1) ? argv[1] : nullptr, 100);
+	const size_t operations = parseArg((argc > 2) ? argv[2] : nullptr, 100);
+
+	std::cout << "Iterations: " << iterations << " Operations per document: " << operations
+			  << std::endl;
+
+	const auto valid = repeatOperations(operations);
+	const auto mixed = valid + "type Unexpected { id: ID! }\n"s;
+	const auto malformed = valid + "query Malformed { unterminated "s;
+
+	try
+	{
+		measure("Valid parseString"sv, iterations, [&valid]() {
+			static_cast<void>(peg::parseString(valid));
+		});
+
+		for (const auto& [name, document] : {
+				 std::make_pair("Mixed"sv, std::string_view { mixed }),
+				 std::make_pair("Malformed"sv, std::string_view { malformed }),
+			 })
+		{
+			measure(std::string { name } + " parseString"s, iterations, [document]() {
+				static_cast<void>(peg::parseString(document));
+			});
+
+			// Emulate trying the executable grammar first and parsing the document again with the
+			// mixed grammar when that fails. The first pass does not build a parse tree, so this
+			// is a lower bound on the cost of parsing it twice.
+			measure(std::string { name } + " two-pass"s, iterations, [document]() {
+				try
+				{
+					peg::memory_input<> in(document.data(), document.size(), "GraphQL"s);
+
+					static_cast<void>(peg::parse<peg::executable_document>(in));
+				}
+				catch (const peg::parse_error&)
+				{
+				}
+
+				static_cast<void>(peg::parseString(document));
+			});
+		}
+	}
+	catch (const std::runtime_error& ex)
+	{
+		std::cerr << ex.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
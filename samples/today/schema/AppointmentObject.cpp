@@ -21,30 +21,34 @@ namespace graphql::today {
 namespace object {
 
 Appointment::Appointment(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(Appointment)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames Appointment::getTypeNames() const noexcept
+const service::TypeNames& Appointment::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(Node)gql"sv,
 		R"gql(UnionType)gql"sv,
 		R"gql(Appointment)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Appointment::getResolvers() const noexcept
+const service::ResolverTable& Appointment::getResolvers() noexcept
 {
-	return {
-		{ R"gql(id)gql"sv, [this](service::ResolverParams&& params) { return resolveId(std::move(params)); } },
-		{ R"gql(when)gql"sv, [this](service::ResolverParams&& params) { return resolveWhen(std::move(params)); } },
-		{ R"gql(isNow)gql"sv, [this](service::ResolverParams&& params) { return resolveIsNow(std::move(params)); } },
-		{ R"gql(subject)gql"sv, [this](service::ResolverParams&& params) { return resolveSubject(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(forceError)gql"sv, [this](service::ResolverParams&& params) { return resolveForceError(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(id)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Appointment&>(object).resolveId(std::move(params)); } },
+		{ R"gql(when)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Appointment&>(object).resolveWhen(std::move(params)); } },
+		{ R"gql(isNow)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Appointment&>(object).resolveIsNow(std::move(params)); } },
+		{ R"gql(subject)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Appointment&>(object).resolveSubject(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Appointment&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(forceError)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Appointment&>(object).resolveForceError(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void Appointment::beginSelectionSet(const service::SelectionSetParams& params) const
@@ -22,25 +22,29 @@ namespace graphql::today {
 namespace object {
 
 CompleteTaskPayload::CompleteTaskPayload(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(CompleteTaskPayload)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames CompleteTaskPayload::getTypeNames() const noexcept
+const service::TypeNames& CompleteTaskPayload::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(CompleteTaskPayload)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap CompleteTaskPayload::getResolvers() const noexcept
+const service::ResolverTable& CompleteTaskPayload::getResolvers() noexcept
 {
-	return {
-		{ R"gql(task)gql"sv, [this](service::ResolverParams&& params) { return resolveTask(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(clientMutationId)gql"sv, [this](service::ResolverParams&& params) { return resolveClientMutationId(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(task)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const CompleteTaskPayload&>(object).resolveTask(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const CompleteTaskPayload&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(clientMutationId)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const CompleteTaskPayload&>(object).resolveClientMutationId(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void CompleteTaskPayload::beginSelectionSet(const service::SelectionSetParams& params) const
@@ -22,25 +22,29 @@ namespace graphql::today {
 namespace object {
 
 FolderEdge::FolderEdge(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(FolderEdge)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames FolderEdge::getTypeNames() const noexcept
+const service::TypeNames& FolderEdge::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(FolderEdge)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap FolderEdge::getResolvers() const noexcept
+const service::ResolverTable& FolderEdge::getResolvers() noexcept
 {
-	return {
-		{ R"gql(node)gql"sv, [this](service::ResolverParams&& params) { return resolveNode(std::move(params)); } },
-		{ R"gql(cursor)gql"sv, [this](service::ResolverParams&& params) { return resolveCursor(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(node)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const FolderEdge&>(object).resolveNode(std::move(params)); } },
+		{ R"gql(cursor)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const FolderEdge&>(object).resolveCursor(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const FolderEdge&>(object).resolve_typename(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void FolderEdge::beginSelectionSet(const service::SelectionSetParams& params) const
@@ -21,25 +21,29 @@ namespace graphql::today {
 namespace object {
 
 PageInfo::PageInfo(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(PageInfo)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames PageInfo::getTypeNames() const noexcept
+const service::TypeNames& PageInfo::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(PageInfo)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap PageInfo::getResolvers() const noexcept
+const service::ResolverTable& PageInfo::getResolvers() noexcept
 {
-	return {
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(hasNextPage)gql"sv, [this](service::ResolverParams&& params) { return resolveHasNextPage(std::move(params)); } },
-		{ R"gql(hasPreviousPage)gql"sv, [this](service::ResolverParams&& params) { return resolveHasPreviousPage(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const PageInfo&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(hasNextPage)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const PageInfo&>(object).resolveHasNextPage(std::move(params)); } },
+		{ R"gql(hasPreviousPage)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const PageInfo&>(object).resolveHasPreviousPage(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void PageInfo::beginSelectionSet(const service::SelectionSetParams& params) const
@@ -21,28 +21,32 @@ namespace graphql::today {
 namespace object {
 
 Task::Task(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(Task)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames Task::getTypeNames() const noexcept
+const service::TypeNames& Task::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(Node)gql"sv,
 		R"gql(UnionType)gql"sv,
 		R"gql(Task)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Task::getResolvers() const noexcept
+const service::ResolverTable& Task::getResolvers() noexcept
 {
-	return {
-		{ R"gql(id)gql"sv, [this](service::ResolverParams&& params) { return resolveId(std::move(params)); } },
-		{ R"gql(title)gql"sv, [this](service::ResolverParams&& params) { return resolveTitle(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(isComplete)gql"sv, [this](service::ResolverParams&& params) { return resolveIsComplete(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(id)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Task&>(object).resolveId(std::move(params)); } },
+		{ R"gql(title)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Task&>(object).resolveTitle(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Task&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(isComplete)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Task&>(object).resolveIsComplete(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void Task::beginSelectionSet(const service::SelectionSetParams& params) const
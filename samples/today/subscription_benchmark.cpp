@@ -0,0 +1,171 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "TodayMock.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace graphql;
+
+using namespace std::literals;
+
+constexpr auto c_subscriptionQuery = R"gql(subscription {
+	nextAppointmentChange {
+		id
+		when
+		subject
+		isNow
+	}
+})gql"sv;
+
+void outputRate(std::string_view name, size_t count,
+	const std::chrono::steady_clock::duration& totalDuration) noexcept
+{
+	const auto perSecond =
+		((static_cast<double>(count)
+			 * static_cast<double>(
+				 std::chrono::duration_cast<std::chrono::steady_clock::duration>(1s).count()))
+			/ static_cast<double>(totalDuration.count()));
+
+	std::cout << name << ": " << count << " in "
+			  << std::chrono::duration_cast<std::chrono::microseconds>(totalDuration).count()
+			  << " microseconds, " << perSecond << "/second" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	const auto parseArg = [](const char* arg, size_t defaultValue) noexcept -> size_t {
+		if (arg)
+		{
+			const int parsed = std::atoi(arg);
+
+			if (parsed > 0)
+			{
+				return static_cast<size_t>(parsed);
+			}
+		}
+
+		return defaultValue;
+	};
+
+	// Default to 10000 live subscriptions, 2 threads subscribing and unsubscribing, and 20
+	// deliveries to every subscription.
+	const size_t subscriptionCount = parseArg((argc > 1) ? argv[1] : nullptr, 10000);
+	const size_t churnThreads = parseArg((argc > 2) ? argv[2] : nullptr, 2);
+	const size_t deliveries = parseArg((argc > 3) ? argv[3] : nullptr, 20);
+
+	std::cout << "Subscriptions: " << subscriptionCount << " Churn threads: " << churnThreads
+			  << " Deliveries: " << deliveries << std::endl;
+
+	const auto mockService = today::mock_service();
+	const auto& service = mockService->service;
+	std::atomic_size_t delivered = 0;
+	const auto subscribe = [&service, &delivered](const peg::ast& query) {
+		return service
+			->subscribe({ [&delivered](response::Value&&) noexcept {
+							 delivered.fetch_add(1, std::memory_order_relaxed);
+						 },
+				peg::ast { query } })
+			.get();
+	};
+
+	try
+	{
+		// Share a single validated AST between all of the subscriptions.
+		auto query = peg::parseString(c_subscriptionQuery);
+
+		if (!service->validate(query).empty())
+		{
+			std::cerr << "Failed to validate the query!" << std::endl;
+			return 1;
+		}
+
+		std::vector<service::SubscriptionKey> keys(subscriptionCount);
+		const auto startSubscribe = std::chrono::steady_clock::now();
+
+		std::generate(keys.begin(), keys.end(), [&subscribe, &query]() {
+			return subscribe(query);
+		});
+
+		outputRate("Subscribe"sv,
+			subscriptionCount,
+			std::chrono::steady_clock::now() - startSubscribe);
+
+		std::atomic_bool stopChurn = false;
+		std::atomic_size_t churned = 0;
+		std::vector<std::thread> threads;
+
+		threads.reserve(churnThreads);
+
+		for (size_t i = 0; i < churnThreads; ++i)
+		{
+			threads.emplace_back([&service, &subscribe, &query, &stopChurn, &churned]() {
+				while (!stopChurn)
+				{
+					const auto key = subscribe(query);
+
+					service->unsubscribe({ key }).get();
+					churned.fetch_add(1, std::memory_order_relaxed);
+				}
+			});
+		}
+
+		std::vector<std::chrono::steady_clock::duration> durations(deliveries);
+		const auto startDeliver = std::chrono::steady_clock::now();
+
+		for (auto& duration : durations)
+		{
+			const auto start = std::chrono::steady_clock::now();
+
+			service->deliver({ "nextAppointmentChange"sv }).get();
+			duration = std::chrono::steady_clock::now() - start;
+		}
+
+		const auto deliverDuration = std::chrono::steady_clock::now() - startDeliver;
+
+		stopChurn = true;
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		outputRate("Subscribe + unsubscribe during delivery"sv, churned, deliverDuration);
+		outputRate("Delivered events"sv, delivered, deliverDuration);
+
+		std::sort(durations.begin(), durations.end());
+
+		std::cout << "Deliver (microseconds): "
+				  << std::chrono::duration_cast<std::chrono::microseconds>(
+						 durations[durations.size() / 2])
+						 .count()
+				  << " median, "
+				  << std::chrono::duration_cast<std::chrono::microseconds>(durations.back()).count()
+				  << " maximum" << std::endl;
+
+		const auto startUnsubscribe = std::chrono::steady_clock::now();
+
+		for (const auto key : keys)
+		{
+			service->unsubscribe({ key }).get();
+		}
+
+		outputRate("Unsubscribe"sv,
+			subscriptionCount,
+			std::chrono::steady_clock::now() - startUnsubscribe);
+	}
+	catch (const std::runtime_error& ex)
+	{
+		std::cerr << ex.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,119 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// WARNING! Do not edit this file manually, your changes will be overwritten.
+
+#include "AppointmentConnectionObject.h"
+#include "PageInfoObject.h"
+#include "AppointmentEdgeObject.h"
+
+#include "graphqlservice/internal/Schema.h"
+
+#include "graphqlservice/introspection/IntrospectionSchema.h"
+
+#include <algorithm>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace std::literals;
+
+namespace graphql::today {
+namespace object {
+
+AppointmentConnection::AppointmentConnection(std::unique_ptr<const Concept> pimpl) noexcept
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(AppointmentConnection)gql"sv }
+	, _pimpl { std::move(pimpl) }
+	, _threadSafe { _pimpl->isThreadSafe() }
+{
+}
+
+const service::TypeNames& AppointmentConnection::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
+		R"gql(AppointmentConnection)gql"sv
+	};
+
+	return s_typeNames;
+}
+
+const service::ResolverTable& AppointmentConnection::getResolvers() noexcept
+{
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(edges)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const AppointmentConnection&>(object).resolveEdges(std::move(params)); } },
+		{ R"gql(pageInfo)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const AppointmentConnection&>(object).resolvePageInfo(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const AppointmentConnection&>(object).resolve_typename(std::move(params)); } }
+	};
+
+	return s_resolvers;
+}
+
+void AppointmentConnection::beginSelectionSet(const service::SelectionSetParams& params) const
+{
+	_pimpl->beginSelectionSet(params);
+}
+
+void AppointmentConnection::endSelectionSet(const service::SelectionSetParams& params) const
+{
+	_pimpl->endSelectionSet(params);
+}
+
+service::AwaitableResolver AppointmentConnection::resolvePageInfo(service::ResolverParams&& params) const
+{
+	std::unique_lock resolverLock(_resolverMutex, std::defer_lock);
+
+	if (!_threadSafe)
+	{
+		resolverLock.lock();
+	}
+
+	service::SelectionSetParams selectionSetParams { static_cast<const service::SelectionSetParams&>(params) };
+	auto directives = std::move(params.fieldDirectives);
+	auto result = _pimpl->getPageInfo(service::FieldParams { std::move(selectionSetParams), std::move(directives) });
+
+	if (resolverLock.owns_lock())
+	{
+		resolverLock.unlock();
+	}
+
+	return service::ModifiedResult<PageInfo>::convert(std::move(result), std::move(params));
+}
+
+service::AwaitableResolver AppointmentConnection::resolveEdges(service::ResolverParams&& params) const
+{
+	std::unique_lock resolverLock(_resolverMutex, std::defer_lock);
+
+	if (!_threadSafe)
+	{
+		resolverLock.lock();
+	}
+
+	service::SelectionSetParams selectionSetParams { static_cast<const service::SelectionSetParams&>(params) };
+	auto directives = std::move(params.fieldDirectives);
+	auto result = _pimpl->getEdges(service::FieldParams { std::move(selectionSetParams), std::move(directives) });
+
+	if (resolverLock.owns_lock())
+	{
+		resolverLock.unlock();
+	}
+
+	return service::ModifiedResult<AppointmentEdge>::convert<service::TypeModifier::Nullable, service::TypeModifier::List, service::TypeModifier::Nullable>(std::move(result), std::move(params));
+}
+
+service::AwaitableResolver AppointmentConnection::resolve_typename(service::ResolverParams&& params) const
+{
+	return service::Result<std::string>::convert(std::string{ R"gql(AppointmentConnection)gql" }, std::move(params));
+}
+
+} // namespace object
+
+void AddAppointmentConnectionDetails(const std::shared_ptr<schema::ObjectType>& typeAppointmentConnection, const std::shared_ptr<schema::Schema>& schema)
+{
+	typeAppointmentConnection->AddFields({
+		schema::Field::Make(R"gql(pageInfo)gql"sv, R"md()md"sv, std::nullopt, schema->WrapType(introspection::TypeKind::NON_NULL, schema->LookupType(R"gql(PageInfo)gql"sv))),
+		schema::Field::Make(R"gql(edges)gql"sv, R"md()md"sv, std::nullopt, schema->WrapType(introspection::TypeKind::LIST, schema->LookupType(R"gql(AppointmentEdge)gql"sv)))
+	});
+}
+
+} // namespace graphql::today
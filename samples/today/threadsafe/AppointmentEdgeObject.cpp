@@ -0,0 +1,118 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// WARNING! Do not edit this file manually, your changes will be overwritten.
+
+#include "AppointmentEdgeObject.h"
+#include "AppointmentObject.h"
+
+#include "graphqlservice/internal/Schema.h"
+
+#include "graphqlservice/introspection/IntrospectionSchema.h"
+
+#include <algorithm>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace std::literals;
+
+namespace graphql::today {
+namespace object {
+
+AppointmentEdge::AppointmentEdge(std::unique_ptr<const Concept> pimpl) noexcept
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(AppointmentEdge)gql"sv }
+	, _pimpl { std::move(pimpl) }
+	, _threadSafe { _pimpl->isThreadSafe() }
+{
+}
+
+const service::TypeNames& AppointmentEdge::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
+		R"gql(AppointmentEdge)gql"sv
+	};
+
+	return s_typeNames;
+}
+
+const service::ResolverTable& AppointmentEdge::getResolvers() noexcept
+{
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(node)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const AppointmentEdge&>(object).resolveNode(std::move(params)); } },
+		{ R"gql(cursor)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const AppointmentEdge&>(object).resolveCursor(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const AppointmentEdge&>(object).resolve_typename(std::move(params)); } }
+	};
+
+	return s_resolvers;
+}
+
+void AppointmentEdge::beginSelectionSet(const service::SelectionSetParams& params) const
+{
+	_pimpl->beginSelectionSet(params);
+}
+
+void AppointmentEdge::endSelectionSet(const service::SelectionSetParams& params) const
+{
+	_pimpl->endSelectionSet(params);
+}
+
+service::AwaitableResolver AppointmentEdge::resolveNode(service::ResolverParams&& params) const
+{
+	std::unique_lock resolverLock(_resolverMutex, std::defer_lock);
+
+	if (!_threadSafe)
+	{
+		resolverLock.lock();
+	}
+
+	service::SelectionSetParams selectionSetParams { static_cast<const service::SelectionSetParams&>(params) };
+	auto directives = std::move(params.fieldDirectives);
+	auto result = _pimpl->getNode(service::FieldParams { std::move(selectionSetParams), std::move(directives) });
+
+	if (resolverLock.owns_lock())
+	{
+		resolverLock.unlock();
+	}
+
+	return service::ModifiedResult<Appointment>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
+}
+
+service::AwaitableResolver AppointmentEdge::resolveCursor(service::ResolverParams&& params) const
+{
+	std::unique_lock resolverLock(_resolverMutex, std::defer_lock);
+
+	if (!_threadSafe)
+	{
+		resolverLock.lock();
+	}
+
+	service::SelectionSetParams selectionSetParams { static_cast<const service::SelectionSetParams&>(params) };
+	auto directives = std::move(params.fieldDirectives);
+	auto result = _pimpl->getCursor(service::FieldParams { std::move(selectionSetParams), std::move(directives) });
+
+	if (resolverLock.owns_lock())
+	{
+		resolverLock.unlock();
+	}
+
+	return service::ModifiedResult<response::Value>::convert(std::move(result), std::move(params));
+}
+
+service::AwaitableResolver AppointmentEdge::resolve_typename(service::ResolverParams&& params) const
+{
+	return service::Result<std::string>::convert(std::string{ R"gql(AppointmentEdge)gql" }, std::move(params));
+}
+
+} // namespace object
+
+void AddAppointmentEdgeDetails(const std::shared_ptr<schema::ObjectType>& typeAppointmentEdge, const std::shared_ptr<schema::Schema>& schema)
+{
+	typeAppointmentEdge->AddFields({
+		schema::Field::Make(R"gql(node)gql"sv, R"md()md"sv, std::nullopt, schema->LookupType(R"gql(Appointment)gql"sv)),
+		schema::Field::Make(R"gql(cursor)gql"sv, R"md()md"sv, std::nullopt, schema->WrapType(introspection::TypeKind::NON_NULL, schema->LookupType(R"gql(ItemCursor)gql"sv)))
+	});
+}
+
+} // namespace graphql::today
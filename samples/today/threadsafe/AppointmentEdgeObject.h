@@ -0,0 +1,168 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// WARNING! Do not edit this file manually, your changes will be overwritten.
+
+#pragma once
+
+#ifndef APPOINTMENTEDGEOBJECT_H
+#define APPOINTMENTEDGEOBJECT_H
+
+#include "TodaySchema.h"
+
+namespace graphql::today::object {
+namespace methods::AppointmentEdgeHas {
+
+template <class TImpl>
+concept getNodeWithParams = requires (TImpl impl, service::FieldParams params)
+{
+	{ service::AwaitableObject<std::shared_ptr<Appointment>> { impl.getNode(std::move(params)) } };
+};
+
+template <class TImpl>
+concept getNode = requires (TImpl impl)
+{
+	{ service::AwaitableObject<std::shared_ptr<Appointment>> { impl.getNode() } };
+};
+
+template <class TImpl>
+concept getCursorWithParams = requires (TImpl impl, service::FieldParams params)
+{
+	{ service::AwaitableScalar<response::Value> { impl.getCursor(std::move(params)) } };
+};
+
+template <class TImpl>
+concept getCursor = requires (TImpl impl)
+{
+	{ service::AwaitableScalar<response::Value> { impl.getCursor() } };
+};
+
+template <class TImpl>
+concept beginSelectionSet = requires (TImpl impl, const service::SelectionSetParams params)
+{
+	{ impl.beginSelectionSet(params) };
+};
+
+template <class TImpl>
+concept endSelectionSet = requires (TImpl impl, const service::SelectionSetParams params)
+{
+	{ impl.endSelectionSet(params) };
+};
+
+} // namespace methods::AppointmentEdgeHas
+
+class [[nodiscard("unnecessary construction")]] AppointmentEdge final
+	: public service::Object
+{
+private:
+	[[nodiscard("unnecessary call")]] service::AwaitableResolver resolveNode(service::ResolverParams&& params) const;
+	[[nodiscard("unnecessary call")]] service::AwaitableResolver resolveCursor(service::ResolverParams&& params) const;
+
+	[[nodiscard("unnecessary call")]] service::AwaitableResolver resolve_typename(service::ResolverParams&& params) const;
+
+	struct [[nodiscard("unnecessary construction")]] Concept
+	{
+		virtual ~Concept() = default;
+
+		virtual void beginSelectionSet(const service::SelectionSetParams& params) const = 0;
+		virtual void endSelectionSet(const service::SelectionSetParams& params) const = 0;
+
+		[[nodiscard("unnecessary call")]] virtual bool isThreadSafe() const noexcept = 0;
+
+		[[nodiscard("unnecessary call")]] virtual service::AwaitableObject<std::shared_ptr<Appointment>> getNode(service::FieldParams&& params) const = 0;
+		[[nodiscard("unnecessary call")]] virtual service::AwaitableScalar<response::Value> getCursor(service::FieldParams&& params) const = 0;
+	};
+
+	template <class T>
+	struct [[nodiscard("unnecessary construction")]] Model final
+		: Concept
+	{
+		explicit Model(std::shared_ptr<T> pimpl) noexcept
+			: _pimpl { std::move(pimpl) }
+		{
+		}
+
+		[[nodiscard("unnecessary call")]] service::AwaitableObject<std::shared_ptr<Appointment>> getNode(service::FieldParams&& params) const override
+		{
+			if constexpr (methods::AppointmentEdgeHas::getNodeWithParams<T>)
+			{
+				return { _pimpl->getNode(std::move(params)) };
+			}
+			else if constexpr (methods::AppointmentEdgeHas::getNode<T>)
+			{
+				return { _pimpl->getNode() };
+			}
+			else
+			{
+				throw service::unimplemented_method(R"ex(AppointmentEdge::getNode)ex");
+			}
+		}
+
+		[[nodiscard("unnecessary call")]] service::AwaitableScalar<response::Value> getCursor(service::FieldParams&& params) const override
+		{
+			if constexpr (methods::AppointmentEdgeHas::getCursorWithParams<T>)
+			{
+				return { _pimpl->getCursor(std::move(params)) };
+			}
+			else if constexpr (methods::AppointmentEdgeHas::getCursor<T>)
+			{
+				return { _pimpl->getCursor() };
+			}
+			else
+			{
+				throw service::unimplemented_method(R"ex(AppointmentEdge::getCursor)ex");
+			}
+		}
+
+		void beginSelectionSet(const service::SelectionSetParams& params) const override
+		{
+			if constexpr (methods::AppointmentEdgeHas::beginSelectionSet<T>)
+			{
+				_pimpl->beginSelectionSet(params);
+			}
+		}
+
+		void endSelectionSet(const service::SelectionSetParams& params) const override
+		{
+			if constexpr (methods::AppointmentEdgeHas::endSelectionSet<T>)
+			{
+				_pimpl->endSelectionSet(params);
+			}
+		}
+
+		[[nodiscard("unnecessary call")]] bool isThreadSafe() const noexcept override
+		{
+			return service::ThreadSafeResolvers<T>;
+		}
+
+	private:
+		const std::shared_ptr<T> _pimpl;
+	};
+
+	explicit AppointmentEdge(std::unique_ptr<const Concept> pimpl) noexcept;
+
+	[[nodiscard("unnecessary call")]] static const service::TypeNames& getTypeNames() noexcept;
+	[[nodiscard("unnecessary call")]] static const service::ResolverTable& getResolvers() noexcept;
+
+	void beginSelectionSet(const service::SelectionSetParams& params) const override;
+	void endSelectionSet(const service::SelectionSetParams& params) const override;
+
+	const std::unique_ptr<const Concept> _pimpl;
+	const bool _threadSafe;
+
+public:
+	template <class T>
+	explicit AppointmentEdge(std::shared_ptr<T> pimpl) noexcept
+		: AppointmentEdge { std::unique_ptr<const Concept> { std::make_unique<Model<T>>(std::move(pimpl)) } }
+	{
+	}
+
+	[[nodiscard("unnecessary call")]] static constexpr std::string_view getObjectType() noexcept
+	{
+		return { R"gql(AppointmentEdge)gql" };
+	}
+};
+
+} // namespace graphql::today::object
+
+#endif // APPOINTMENTEDGEOBJECT_H
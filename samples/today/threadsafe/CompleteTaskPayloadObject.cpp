@@ -0,0 +1,118 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// WARNING! Do not edit this file manually, your changes will be overwritten.
+
+#include "CompleteTaskPayloadObject.h"
+#include "TaskObject.h"
+
+#include "graphqlservice/internal/Schema.h"
+
+#include "graphqlservice/introspection/IntrospectionSchema.h"
+
+#include <algorithm>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace std::literals;
+
+namespace graphql::today {
+namespace object {
+
+CompleteTaskPayload::CompleteTaskPayload(std::unique_ptr<const Concept> pimpl) noexcept
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(CompleteTaskPayload)gql"sv }
+	, _pimpl { std::move(pimpl) }
+	, _threadSafe { _pimpl->isThreadSafe() }
+{
+}
+
+const service::TypeNames& CompleteTaskPayload::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
+		R"gql(CompleteTaskPayload)gql"sv
+	};
+
+	return s_typeNames;
+}
+
+const service::ResolverTable& CompleteTaskPayload::getResolvers() noexcept
+{
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(task)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const CompleteTaskPayload&>(object).resolveTask(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const CompleteTaskPayload&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(clientMutationId)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const CompleteTaskPayload&>(object).resolveClientMutationId(std::move(params)); } }
+	};
+
+	return s_resolvers;
+}
+
+void CompleteTaskPayload::beginSelectionSet(const service::SelectionSetParams& params) const
+{
+	_pimpl->beginSelectionSet(params);
+}
+
+void CompleteTaskPayload::endSelectionSet(const service::SelectionSetParams& params) const
+{
+	_pimpl->endSelectionSet(params);
+}
+
+service::AwaitableResolver CompleteTaskPayload::resolveTask(service::ResolverParams&& params) const
+{
+	std::unique_lock resolverLock(_resolverMutex, std::defer_lock);
+
+	if (!_threadSafe)
+	{
+		resolverLock.lock();
+	}
+
+	service::SelectionSetParams selectionSetParams { static_cast<const service::SelectionSetParams&>(params) };
+	auto directives = std::move(params.fieldDirectives);
+	auto result = _pimpl->getTask(service::FieldParams { std::move(selectionSetParams), std::move(directives) });
+
+	if (resolverLock.owns_lock())
+	{
+		resolverLock.unlock();
+	}
+
+	return service::ModifiedResult<Task>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
+}
+
+service::AwaitableResolver CompleteTaskPayload::resolveClientMutationId(service::ResolverParams&& params) const
+{
+	std::unique_lock resolverLock(_resolverMutex, std::defer_lock);
+
+	if (!_threadSafe)
+	{
+		resolverLock.lock();
+	}
+
+	service::SelectionSetParams selectionSetParams { static_cast<const service::SelectionSetParams&>(params) };
+	auto directives = std::move(params.fieldDirectives);
+	auto result = _pimpl->getClientMutationId(service::FieldParams { std::move(selectionSetParams), std::move(directives) });
+
+	if (resolverLock.owns_lock())
+	{
+		resolverLock.unlock();
+	}
+
+	return service::ModifiedResult<std::string>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
+}
+
+service::AwaitableResolver CompleteTaskPayload::resolve_typename(service::ResolverParams&& params) const
+{
+	return service::Result<std::string>::convert(std::string{ R"gql(CompleteTaskPayload)gql" }, std::move(params));
+}
+
+} // namespace object
+
+void AddCompleteTaskPayloadDetails(const std::shared_ptr<schema::ObjectType>& typeCompleteTaskPayload, const std::shared_ptr<schema::Schema>& schema)
+{
+	typeCompleteTaskPayload->AddFields({
+		schema::Field::Make(R"gql(task)gql"sv, R"md()md"sv, std::nullopt, schema->LookupType(R"gql(Task)gql"sv)),
+		schema::Field::Make(R"gql(clientMutationId)gql"sv, R"md()md"sv, std::nullopt, schema->LookupType(R"gql(String)gql"sv))
+	});
+}
+
+} // namespace graphql::today
@@ -0,0 +1,168 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// WARNING! Do not edit this file manually, your changes will be overwritten.
+
+#pragma once
+
+#ifndef COMPLETETASKPAYLOADOBJECT_H
+#define COMPLETETASKPAYLOADOBJECT_H
+
+#include "TodaySchema.h"
+
+namespace graphql::today::object {
+namespace methods::CompleteTaskPayloadHas {
+
+template <class TImpl>
+concept getTaskWithParams = requires (TImpl impl, service::FieldParams params)
+{
+	{ service::AwaitableObject<std::shared_ptr<Task>> { impl.getTask(std::move(params)) } };
+};
+
+template <class TImpl>
+concept getTask = requires (TImpl impl)
+{
+	{ service::AwaitableObject<std::shared_ptr<Task>> { impl.getTask() } };
+};
+
+template <class TImpl>
+concept getClientMutationIdWithParams = requires (TImpl impl, service::FieldParams params)
+{
+	{ service::AwaitableScalar<std::optional<std::string>> { impl.getClientMutationId(std::move(params)) } };
+};
+
+template <class TImpl>
+concept getClientMutationId = requires (TImpl impl)
+{
+	{ service::AwaitableScalar<std::optional<std::string>> { impl.getClientMutationId() } };
+};
+
+template <class TImpl>
+concept beginSelectionSet = requires (TImpl impl, const service::SelectionSetParams params)
+{
+	{ impl.beginSelectionSet(params) };
+};
+
+template <class TImpl>
+concept endSelectionSet = requires (TImpl impl, const service::SelectionSetParams params)
+{
+	{ impl.endSelectionSet(params) };
+};
+
+} // namespace methods::CompleteTaskPayloadHas
+
+class [[nodiscard("unnecessary construction")]] CompleteTaskPayload final
+	: public service::Object
+{
+private:
+	[[nodiscard("unnecessary call")]] service::AwaitableResolver resolveTask(service::ResolverParams&& params) const;
+	[[nodiscard("unnecessary call")]] service::AwaitableResolver resolveClientMutationId(service::ResolverParams&& params) const;
+
+	[[nodiscard("unnecessary call")]] service::AwaitableResolver resolve_typename(service::ResolverParams&& params) const;
+
+	struct [[nodiscard("unnecessary construction")]] Concept
+	{
+		virtual ~Concept() = default;
+
+		virtual void beginSelectionSet(const service::SelectionSetParams& params) const = 0;
+		virtual void endSelectionSet(const service::SelectionSetParams& params) const = 0;
+
+		[[nodiscard("unnecessary call")]] virtual bool isThreadSafe() const noexcept = 0;
+
+		[[nodiscard("unnecessary call")]] virtual service::AwaitableObject<std::shared_ptr<Task>> getTask(service::FieldParams&& params) const = 0;
+		[[nodiscard("unnecessary call")]] virtual service::AwaitableScalar<std::optional<std::string>> getClientMutationId(service::FieldParams&& params) const = 0;
+	};
+
+	template <class T>
+	struct [[nodiscard("unnecessary construction")]] Model final
+		: Concept
+	{
+		explicit Model(std::shared_ptr<T> pimpl) noexcept
+			: _pimpl { std::move(pimpl) }
+		{
+		}
+
+		[[nodiscard("unnecessary call")]] service::AwaitableObject<std::shared_ptr<Task>> getTask(service::FieldParams&& params) const override
+		{
+			if constexpr (methods::CompleteTaskPayloadHas::getTaskWithParams<T>)
+			{
+				return { _pimpl->getTask(std::move(params)) };
+			}
+			else if constexpr (methods::CompleteTaskPayloadHas::getTask<T>)
+			{
+				return { _pimpl->getTask() };
+			}
+			else
+			{
+				throw service::unimplemented_method(R"ex(CompleteTaskPayload::getTask)ex");
+			}
+		}
+
+		[[nodiscard("unnecessary call")]] service::AwaitableScalar<std::optional<std::string>> getClientMutationId(service::FieldParams&& params) const override
+		{
+			if constexpr (methods::CompleteTaskPayloadHas::getClientMutationIdWithParams<T>)
+			{
+				return { _pimpl->getClientMutationId(std::move(params)) };
+			}
+			else if constexpr (methods::CompleteTaskPayloadHas::getClientMutationId<T>)
+			{
+				return { _pimpl->getClientMutationId() };
+			}
+			else
+			{
+				throw service::unimplemented_method(R"ex(CompleteTaskPayload::getClientMutationId)ex");
+			}
+		}
+
+		void beginSelectionSet(const service::SelectionSetParams& params) const override
+		{
+			if constexpr (methods::CompleteTaskPayloadHas::beginSelectionSet<T>)
+			{
+				_pimpl->beginSelectionSet(params);
+			}
+		}
+
+		void endSelectionSet(const service::SelectionSetParams& params) const override
+		{
+			if constexpr (methods::CompleteTaskPayloadHas::endSelectionSet<T>)
+			{
+				_pimpl->endSelectionSet(params);
+			}
+		}
+
+		[[nodiscard("unnecessary call")]] bool isThreadSafe() const noexcept override
+		{
+			return service::ThreadSafeResolvers<T>;
+		}
+
+	private:
+		const std::shared_ptr<T> _pimpl;
+	};
+
+	explicit CompleteTaskPayload(std::unique_ptr<const Concept> pimpl) noexcept;
+
+	[[nodiscard("unnecessary call")]] static const service::TypeNames& getTypeNames() noexcept;
+	[[nodiscard("unnecessary call")]] static const service::ResolverTable& getResolvers() noexcept;
+
+	void beginSelectionSet(const service::SelectionSetParams& params) const override;
+	void endSelectionSet(const service::SelectionSetParams& params) const override;
+
+	const std::unique_ptr<const Concept> _pimpl;
+	const bool _threadSafe;
+
+public:
+	template <class T>
+	explicit CompleteTaskPayload(std::shared_ptr<T> pimpl) noexcept
+		: CompleteTaskPayload { std::unique_ptr<const Concept> { std::make_unique<Model<T>>(std::move(pimpl)) } }
+	{
+	}
+
+	[[nodiscard("unnecessary call")]] static constexpr std::string_view getObjectType() noexcept
+	{
+		return { R"gql(CompleteTaskPayload)gql" };
+	}
+};
+
+} // namespace graphql::today::object
+
+#endif // COMPLETETASKPAYLOADOBJECT_H
@@ -0,0 +1,94 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// WARNING! Do not edit this file manually, your changes will be overwritten.
+
+#include "ExpensiveObject.h"
+
+#include "graphqlservice/internal/Schema.h"
+
+#include "graphqlservice/introspection/IntrospectionSchema.h"
+
+#include <algorithm>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace std::literals;
+
+namespace graphql::today {
+namespace object {
+
+Expensive::Expensive(std::unique_ptr<const Concept> pimpl) noexcept
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(Expensive)gql"sv }
+	, _pimpl { std::move(pimpl) }
+	, _threadSafe { _pimpl->isThreadSafe() }
+{
+}
+
+const service::TypeNames& Expensive::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
+		R"gql(Expensive)gql"sv
+	};
+
+	return s_typeNames;
+}
+
+const service::ResolverTable& Expensive::getResolvers() noexcept
+{
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(order)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Expensive&>(object).resolveOrder(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Expensive&>(object).resolve_typename(std::move(params)); } }
+	};
+
+	return s_resolvers;
+}
+
+void Expensive::beginSelectionSet(const service::SelectionSetParams& params) const
+{
+	_pimpl->beginSelectionSet(params);
+}
+
+void Expensive::endSelectionSet(const service::SelectionSetParams& params) const
+{
+	_pimpl->endSelectionSet(params);
+}
+
+service::AwaitableResolver Expensive::resolveOrder(service::ResolverParams&& params) const
+{
+	std::unique_lock resolverLock(_resolverMutex, std::defer_lock);
+
+	if (!_threadSafe)
+	{
+		resolverLock.lock();
+	}
+
+	service::SelectionSetParams selectionSetParams { static_cast<const service::SelectionSetParams&>(params) };
+	auto directives = std::move(params.fieldDirectives);
+	auto result = _pimpl->getOrder(service::FieldParams { std::move(selectionSetParams), std::move(directives) });
+
+	if (resolverLock.owns_lock())
+	{
+		resolverLock.unlock();
+	}
+
+	return service::ModifiedResult<int>::convert(std::move(result), std::move(params));
+}
+
+service::AwaitableResolver Expensive::resolve_typename(service::ResolverParams&& params) const
+{
+	return service::Result<std::string>::convert(std::string{ R"gql(Expensive)gql" }, std::move(params));
+}
+
+} // namespace object
+
+void AddExpensiveDetails(const std::shared_ptr<schema::ObjectType>& typeExpensive, const std::shared_ptr<schema::Schema>& schema)
+{
+	typeExpensive->AddFields({
+		schema::Field::Make(R"gql(order)gql"sv, R"md()md"sv, std::nullopt, schema->WrapType(introspection::TypeKind::NON_NULL, schema->LookupType(R"gql(Int)gql"sv)))
+	});
+}
+
+} // namespace graphql::today
@@ -0,0 +1,138 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// WARNING! Do not edit this file manually, your changes will be overwritten.
+
+#pragma once
+
+#ifndef EXPENSIVEOBJECT_H
+#define EXPENSIVEOBJECT_H
+
+#include "TodaySchema.h"
+
+namespace graphql::today::object {
+namespace methods::ExpensiveHas {
+
+template <class TImpl>
+concept getOrderWithParams = requires (TImpl impl, service::FieldParams params)
+{
+	{ service::AwaitableScalar<int> { impl.getOrder(std::move(params)) } };
+};
+
+template <class TImpl>
+concept getOrder = requires (TImpl impl)
+{
+	{ service::AwaitableScalar<int> { impl.getOrder() } };
+};
+
+template <class TImpl>
+concept beginSelectionSet = requires (TImpl impl, const service::SelectionSetParams params)
+{
+	{ impl.beginSelectionSet(params) };
+};
+
+template <class TImpl>
+concept endSelectionSet = requires (TImpl impl, const service::SelectionSetParams params)
+{
+	{ impl.endSelectionSet(params) };
+};
+
+} // namespace methods::ExpensiveHas
+
+class [[nodiscard("unnecessary construction")]] Expensive final
+	: public service::Object
+{
+private:
+	[[nodiscard("unnecessary call")]] service::AwaitableResolver resolveOrder(service::ResolverParams&& params) const;
+
+	[[nodiscard("unnecessary call")]] service::AwaitableResolver resolve_typename(service::ResolverParams&& params) const;
+
+	struct [[nodiscard("unnecessary construction")]] Concept
+	{
+		virtual ~Concept() = default;
+
+		virtual void beginSelectionSet(const service::SelectionSetParams& params) const = 0;
+		virtual void endSelectionSet(const service::SelectionSetParams& params) const = 0;
+
+		[[nodiscard("unnecessary call")]] virtual bool isThreadSafe() const noexcept = 0;
+
+		[[nodiscard("unnecessary call")]] virtual service::AwaitableScalar<int> getOrder(service::FieldParams&& params) const = 0;
+	};
+
+	template <class T>
+	struct [[nodiscard("unnecessary construction")]] Model final
+		: Concept
+	{
+		explicit Model(std::shared_ptr<T> pimpl) noexcept
+			: _pimpl { std::move(pimpl) }
+		{
+		}
+
+		[[nodiscard("unnecessary call")]] service::AwaitableScalar<int> getOrder(service::FieldParams&& params) const override
+		{
+			if constexpr (methods::ExpensiveHas::getOrderWithParams<T>)
+			{
+				return { _pimpl->getOrder(std::move(params)) };
+			}
+			else if constexpr (methods::ExpensiveHas::getOrder<T>)
+			{
+				return { _pimpl->getOrder() };
+			}
+			else
+			{
+				throw service::unimplemented_method(R"ex(Expensive::getOrder)ex");
+			}
+		}
+
+		void beginSelectionSet(const service::SelectionSetParams& params) const override
+		{
+			if constexpr (methods::ExpensiveHas::beginSelectionSet<T>)
+			{
+				_pimpl->beginSelectionSet(params);
+			}
+		}
+
+		void endSelectionSet(const service::SelectionSetParams& params) const override
+		{
+			if constexpr (methods::ExpensiveHas::endSelectionSet<T>)
+			{
+				_pimpl->endSelectionSet(params);
+			}
+		}
+
+		[[nodiscard("unnecessary call")]] bool isThreadSafe() const noexcept override
+		{
+			return service::ThreadSafeResolvers<T>;
+		}
+
+	private:
+		const std::shared_ptr<T> _pimpl;
+	};
+
+	explicit Expensive(std::unique_ptr<const Concept> pimpl) noexcept;
+
+	[[nodiscard("unnecessary call")]] static const service::TypeNames& getTypeNames() noexcept;
+	[[nodiscard("unnecessary call")]] static const service::ResolverTable& getResolvers() noexcept;
+
+	void beginSelectionSet(const service::SelectionSetParams& params) const override;
+	void endSelectionSet(const service::SelectionSetParams& params) const override;
+
+	const std::unique_ptr<const Concept> _pimpl;
+	const bool _threadSafe;
+
+public:
+	template <class T>
+	explicit Expensive(std::shared_ptr<T> pimpl) noexcept
+		: Expensive { std::unique_ptr<const Concept> { std::make_unique<Model<T>>(std::move(pimpl)) } }
+	{
+	}
+
+	[[nodiscard("unnecessary call")]] static constexpr std::string_view getObjectType() noexcept
+	{
+		return { R"gql(Expensive)gql" };
+	}
+};
+
+} // namespace graphql::today::object
+
+#endif // EXPENSIVEOBJECT_H
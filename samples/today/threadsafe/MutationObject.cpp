@@ -0,0 +1,124 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// WARNING! Do not edit this file manually, your changes will be overwritten.
+
+#include "MutationObject.h"
+#include "CompleteTaskPayloadObject.h"
+
+#include "graphqlservice/internal/Schema.h"
+
+#include "graphqlservice/introspection/IntrospectionSchema.h"
+
+#include <algorithm>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace std::literals;
+
+namespace graphql::today {
+namespace object {
+
+Mutation::Mutation(std::unique_ptr<const Concept> pimpl) noexcept
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(Mutation)gql"sv }
+	, _pimpl { std::move(pimpl) }
+	, _threadSafe { _pimpl->isThreadSafe() }
+{
+}
+
+const service::TypeNames& Mutation::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
+		R"gql(Mutation)gql"sv
+	};
+
+	return s_typeNames;
+}
+
+const service::ResolverTable& Mutation::getResolvers() noexcept
+{
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(setFloat)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Mutation&>(object).resolveSetFloat(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Mutation&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(completeTask)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Mutation&>(object).resolveCompleteTask(std::move(params)); } }
+	};
+
+	return s_resolvers;
+}
+
+void Mutation::beginSelectionSet(const service::SelectionSetParams& params) const
+{
+	_pimpl->beginSelectionSet(params);
+}
+
+void Mutation::endSelectionSet(const service::SelectionSetParams& params) const
+{
+	_pimpl->endSelectionSet(params);
+}
+
+service::AwaitableResolver Mutation::resolveCompleteTask(service::ResolverParams&& params) const
+{
+	auto argInput = service::ModifiedArgument<today::CompleteTaskInput>::require("input", params.arguments);
+	std::unique_lock resolverLock(_resolverMutex, std::defer_lock);
+
+	if (!_threadSafe)
+	{
+		resolverLock.lock();
+	}
+
+	service::SelectionSetParams selectionSetParams { static_cast<const service::SelectionSetParams&>(params) };
+	auto directives = std::move(params.fieldDirectives);
+	auto result = _pimpl->applyCompleteTask(service::FieldParams { std::move(selectionSetParams), std::move(directives) }, std::move(argInput));
+
+	if (resolverLock.owns_lock())
+	{
+		resolverLock.unlock();
+	}
+
+	return service::ModifiedResult<CompleteTaskPayload>::convert(std::move(result), std::move(params));
+}
+
+service::AwaitableResolver Mutation::resolveSetFloat(service::ResolverParams&& params) const
+{
+	auto argValue = service::ModifiedArgument<double>::require("value", params.arguments);
+	std::unique_lock resolverLock(_resolverMutex, std::defer_lock);
+
+	if (!_threadSafe)
+	{
+		resolverLock.lock();
+	}
+
+	service::SelectionSetParams selectionSetParams { static_cast<const service::SelectionSetParams&>(params) };
+	auto directives = std::move(params.fieldDirectives);
+	auto result = _pimpl->applySetFloat(service::FieldParams { std::move(selectionSetParams), std::move(directives) }, std::move(argValue));
+
+	if (resolverLock.owns_lock())
+	{
+		resolverLock.unlock();
+	}
+
+	return service::ModifiedResult<double>::convert(std::move(result), std::move(params));
+}
+
+service::AwaitableResolver Mutation::resolve_typename(service::ResolverParams&& params) const
+{
+	return service::Result<std::string>::convert(std::string{ R"gql(Mutation)gql" }, std::move(params));
+}
+
+} // namespace object
+
+void AddMutationDetails(const std::shared_ptr<schema::ObjectType>& typeMutation, const std::shared_ptr<schema::Schema>& schema)
+{
+	typeMutation->AddFields({
+		schema::Field::Make(R"gql(completeTask)gql"sv, R"md()md"sv, std::nullopt, schema->WrapType(introspection::TypeKind::NON_NULL, schema->LookupType(R"gql(CompleteTaskPayload)gql"sv)), {
+			schema::InputValue::Make(R"gql(input)gql"sv, R"md()md"sv, schema->WrapType(introspection::TypeKind::NON_NULL, schema->LookupType(R"gql(CompleteTaskInput)gql"sv)), R"gql()gql"sv)
+		}),
+		schema::Field::Make(R"gql(setFloat)gql"sv, R"md()md"sv, std::nullopt, schema->WrapType(introspection::TypeKind::NON_NULL, schema->LookupType(R"gql(Float)gql"sv)), {
+			schema::InputValue::Make(R"gql(value)gql"sv, R"md()md"sv, schema->WrapType(introspection::TypeKind::NON_NULL, schema->LookupType(R"gql(Float)gql"sv)), R"gql()gql"sv)
+		})
+	});
+}
+
+} // namespace graphql::today
@@ -0,0 +1,87 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// WARNING! Do not edit this file manually, your changes will be overwritten.
+
+#pragma once
+
+#ifndef NODEOBJECT_H
+#define NODEOBJECT_H
+
+#include "TodaySchema.h"
+
+namespace graphql::today::object {
+
+class [[nodiscard("unnecessary construction")]] Node final
+	: public service::Object
+{
+private:
+	struct [[nodiscard("unnecessary construction")]] Concept
+	{
+		virtual ~Concept() = default;
+
+		[[nodiscard("unnecessary call")]] virtual const service::TypeNames& getTypeNames() const noexcept = 0;
+		[[nodiscard("unnecessary call")]] virtual const service::ResolverTable& getResolvers() const noexcept = 0;
+		[[nodiscard("unnecessary call")]] virtual const service::Object& getObject() const noexcept = 0;
+
+		virtual void beginSelectionSet(const service::SelectionSetParams& params) const = 0;
+		virtual void endSelectionSet(const service::SelectionSetParams& params) const = 0;
+	};
+
+	template <class T>
+	struct [[nodiscard("unnecessary construction")]] Model final
+		: Concept
+	{
+		explicit Model(std::shared_ptr<T> pimpl) noexcept
+			: _pimpl { std::move(pimpl) }
+		{
+		}
+
+		[[nodiscard("unnecessary call")]] const service::TypeNames& getTypeNames() const noexcept override
+		{
+			return T::getTypeNames();
+		}
+
+		[[nodiscard("unnecessary call")]] const service::ResolverTable& getResolvers() const noexcept override
+		{
+			return T::getResolvers();
+		}
+
+		[[nodiscard("unnecessary call")]] const service::Object& getObject() const noexcept override
+		{
+			return *_pimpl;
+		}
+
+		void beginSelectionSet(const service::SelectionSetParams& params) const override
+		{
+			_pimpl->beginSelectionSet(params);
+		}
+
+		void endSelectionSet(const service::SelectionSetParams& params) const override
+		{
+			_pimpl->endSelectionSet(params);
+		}
+
+	private:
+		const std::shared_ptr<T> _pimpl;
+	};
+
+	explicit Node(std::unique_ptr<const Concept> pimpl) noexcept;
+
+	void beginSelectionSet(const service::SelectionSetParams& params) const override;
+	void endSelectionSet(const service::SelectionSetParams& params) const override;
+
+	const std::unique_ptr<const Concept> _pimpl;
+
+public:
+	template <class T>
+	explicit Node(std::shared_ptr<T> pimpl) noexcept
+		: Node { std::unique_ptr<const Concept> { std::make_unique<Model<T>>(std::move(pimpl)) } }
+	{
+		static_assert(T::template implements<Node>(), "Node is not implemented");
+	}
+};
+
+} // namespace graphql::today::object
+
+#endif // NODEOBJECT_H
@@ -0,0 +1,161 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "TodayMock.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace graphql;
+
+using namespace std::literals;
+
+constexpr auto c_benchmarkQuery = R"gql(query {
+	appointments {
+		pageInfo { hasNextPage }
+		edges {
+			node {
+				id
+				when
+				subject
+				isNow
+			}
+		}
+	}
+	tasks {
+		edges {
+			node {
+				...TaskFields
+			}
+		}
+	}
+	unreadCounts {
+		edges {
+			node {
+				id
+				name
+				unreadCount
+			}
+		}
+	}
+}
+
+fragment TaskFields on Task {
+	id
+	title
+	isComplete
+})gql"sv;
+
+void outputThroughput(size_t threadCount, size_t iterations,
+	const std::chrono::steady_clock::duration& totalDuration) noexcept
+{
+	const auto validationsPerSecond =
+		((static_cast<double>(threadCount * iterations)
+			 * static_cast<double>(
+				 std::chrono::duration_cast<std::chrono::steady_clock::duration>(1s).count()))
+			/ static_cast<double>(totalDuration.count()));
+
+	std::cout << "Threads: " << threadCount << " Throughput: " << validationsPerSecond
+			  << " validations/second Total (microseconds): "
+			  << std::chrono::duration_cast<std::chrono::microseconds>(totalDuration).count()
+			  << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	const auto parseArg = [](const char* arg, size_t defaultValue) noexcept -> size_t {
+		if (arg)
+		{
+			const int parsed = std::atoi(arg);
+
+			if (parsed > 0)
+			{
+				return static_cast<size_t>(parsed);
+			}
+		}
+
+		return defaultValue;
+	};
+
+	// Default to 1000 iterations per thread, and up to the number of hardware threads.
+	const size_t iterations = parseArg((argc > 1) ? argv[1] : nullptr, 1000);
+	const size_t maxThreads = parseArg((argc > 2) ? argv[2] : nullptr,
+		std::max(size_t { 1 }, static_cast<size_t>(std::thread::hardware_concurrency())));
+
+	std::cout << "Iterations per thread: " << iterations << std::endl;
+
+	const auto mockService = today::mock_service();
+	const auto& service = mockService->service;
+
+	// Double the number of threads each time, and always finish with the maximum.
+	std::vector<size_t> threadCounts;
+
+	for (size_t threadCount = 1; threadCount < maxThreads; threadCount *= 2)
+	{
+		threadCounts.push_back(threadCount);
+	}
+
+	threadCounts.push_back(maxThreads);
+
+	try
+	{
+		for (const auto threadCount : threadCounts)
+		{
+			std::vector<peg::ast> queries(threadCount);
+
+			std::generate(queries.begin(), queries.end(), []() {
+				return peg::parseString(c_benchmarkQuery);
+			});
+
+			std::atomic_bool failed = false;
+			std::vector<std::thread> threads;
+			const auto startTime = std::chrono::steady_clock::now();
+
+			threads.reserve(threadCount);
+
+			for (auto& query : queries)
+			{
+				threads.emplace_back([&service, &query, &failed, iterations]() noexcept {
+					for (size_t i = 0; i < iterations && !failed; ++i)
+					{
+						// Force the query to be validated again on every iteration.
+						query.validated = false;
+
+						if (!service->validate(query).empty())
+						{
+							failed = true;
+						}
+					}
+				});
+			}
+
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+
+			const auto endTime = std::chrono::steady_clock::now();
+
+			if (failed)
+			{
+				std::cerr << "Failed to validate the query!" << std::endl;
+				return 1;
+			}
+
+			outputThroughput(threadCount, iterations, endTime - startTime);
+		}
+	}
+	catch (const std::runtime_error& ex)
+	{
+		std::cerr << ex.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,99 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "TodayMock.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string_view>
+
+using namespace graphql;
+
+using namespace std::literals;
+
+constexpr auto c_everythingQuery = R"gql(query Everything {
+	appointments { edges { node { id subject when isNow } } }
+	tasks { edges { node { id title isComplete } } }
+	unreadCounts { edges { node { id name unreadCount } } }
+})gql"sv;
+
+int main(int argc, char** argv)
+{
+	const auto parseArg = [](const char* arg, size_t defaultValue) noexcept -> size_t {
+		if (arg)
+		{
+			const int parsed = std::atoi(arg);
+
+			if (parsed > 0)
+			{
+				return static_cast<size_t>(parsed);
+			}
+		}
+
+		return defaultValue;
+	};
+
+	// Default to 100 queries with each launch policy, and 4 threads in the await_worker_pool.
+	const size_t iterations = parseArg((argc > 1) ? argv[1] : nullptr, 100);
+	const size_t poolThreads = parseArg((argc > 2) ? argv[2] : nullptr, 4);
+
+	std::cout << "Iterations: " << iterations << " Pool threads: " << poolThreads << std::endl;
+
+	const auto mockService = today::mock_service();
+	const auto& service = mockService->service;
+
+	try
+	{
+		// Share a single validated AST between all of the queries.
+		auto query = peg::parseString(c_everythingQuery);
+
+		if (!service->validate(query).empty())
+		{
+			std::cerr << "Failed to validate the query!" << std::endl;
+			return 1;
+		}
+
+		const auto measure = [&service, &query, iterations](std::string_view name,
+								 service::await_async launch) {
+			const auto start = std::chrono::steady_clock::now();
+
+			for (size_t i = 0; i < iterations; ++i)
+			{
+				auto result = service
+								  ->resolve({ query,
+									  "Everything"sv,
+									  response::Value(response::Type::Map),
+									  launch,
+									  std::make_shared<today::RequestState>(i) })
+								  .get();
+
+				if (result.find("errors") != result.get<response::MapType>().cend())
+				{
+					throw std::runtime_error { "The query failed!" };
+				}
+			}
+
+			const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+				std::chrono::steady_clock::now() - start);
+
+			std::cout << name << ": " << (duration.count() / iterations)
+					  << " microseconds per query" << std::endl;
+		};
+
+		measure("await_worker_thread"sv,
+			service::await_async { std::make_shared<service::await_worker_thread>() });
+		measure("await_worker_queue"sv,
+			service::await_async { std::make_shared<service::await_worker_queue>() });
+		measure("await_worker_pool"sv,
+			service::await_async { std::make_shared<service::await_worker_pool>(poolThreads) });
+	}
+	catch (const std::runtime_error& ex)
+	{
+		std::cerr << ex.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
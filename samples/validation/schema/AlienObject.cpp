@@ -21,27 +21,31 @@ namespace graphql::validation {
 namespace object {
 
 Alien::Alien(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(Alien)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames Alien::getTypeNames() const noexcept
+const service::TypeNames& Alien::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(Sentient)gql"sv,
 		R"gql(HumanOrAlien)gql"sv,
 		R"gql(Alien)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Alien::getResolvers() const noexcept
+const service::ResolverTable& Alien::getResolvers() noexcept
 {
-	return {
-		{ R"gql(name)gql"sv, [this](service::ResolverParams&& params) { return resolveName(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(homePlanet)gql"sv, [this](service::ResolverParams&& params) { return resolveHomePlanet(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(name)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Alien&>(object).resolveName(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Alien&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(homePlanet)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Alien&>(object).resolveHomePlanet(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void Alien::beginSelectionSet(const service::SelectionSetParams& params) const
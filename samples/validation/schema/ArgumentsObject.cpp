@@ -21,31 +21,35 @@ namespace graphql::validation {
 namespace object {
 
 Arguments::Arguments(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(Arguments)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames Arguments::getTypeNames() const noexcept
+const service::TypeNames& Arguments::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(Arguments)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Arguments::getResolvers() const noexcept
+const service::ResolverTable& Arguments::getResolvers() noexcept
 {
-	return {
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(intArgField)gql"sv, [this](service::ResolverParams&& params) { return resolveIntArgField(std::move(params)); } },
-		{ R"gql(multipleReqs)gql"sv, [this](service::ResolverParams&& params) { return resolveMultipleReqs(std::move(params)); } },
-		{ R"gql(floatArgField)gql"sv, [this](service::ResolverParams&& params) { return resolveFloatArgField(std::move(params)); } },
-		{ R"gql(booleanArgField)gql"sv, [this](service::ResolverParams&& params) { return resolveBooleanArgField(std::move(params)); } },
-		{ R"gql(booleanListArgField)gql"sv, [this](service::ResolverParams&& params) { return resolveBooleanListArgField(std::move(params)); } },
-		{ R"gql(nonNullBooleanArgField)gql"sv, [this](service::ResolverParams&& params) { return resolveNonNullBooleanArgField(std::move(params)); } },
-		{ R"gql(nonNullBooleanListField)gql"sv, [this](service::ResolverParams&& params) { return resolveNonNullBooleanListField(std::move(params)); } },
-		{ R"gql(optionalNonNullBooleanArgField)gql"sv, [this](service::ResolverParams&& params) { return resolveOptionalNonNullBooleanArgField(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Arguments&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(intArgField)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Arguments&>(object).resolveIntArgField(std::move(params)); } },
+		{ R"gql(multipleReqs)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Arguments&>(object).resolveMultipleReqs(std::move(params)); } },
+		{ R"gql(floatArgField)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Arguments&>(object).resolveFloatArgField(std::move(params)); } },
+		{ R"gql(booleanArgField)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Arguments&>(object).resolveBooleanArgField(std::move(params)); } },
+		{ R"gql(booleanListArgField)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Arguments&>(object).resolveBooleanListArgField(std::move(params)); } },
+		{ R"gql(nonNullBooleanArgField)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Arguments&>(object).resolveNonNullBooleanArgField(std::move(params)); } },
+		{ R"gql(nonNullBooleanListField)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Arguments&>(object).resolveNonNullBooleanListField(std::move(params)); } },
+		{ R"gql(optionalNonNullBooleanArgField)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Arguments&>(object).resolveOptionalNonNullBooleanArgField(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void Arguments::beginSelectionSet(const service::SelectionSetParams& params) const
@@ -21,29 +21,33 @@ namespace graphql::validation {
 namespace object {
 
 Cat::Cat(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(Cat)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames Cat::getTypeNames() const noexcept
+const service::TypeNames& Cat::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(Pet)gql"sv,
 		R"gql(CatOrDog)gql"sv,
 		R"gql(Cat)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Cat::getResolvers() const noexcept
+const service::ResolverTable& Cat::getResolvers() noexcept
 {
-	return {
-		{ R"gql(name)gql"sv, [this](service::ResolverParams&& params) { return resolveName(std::move(params)); } },
-		{ R"gql(nickname)gql"sv, [this](service::ResolverParams&& params) { return resolveNickname(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(meowVolume)gql"sv, [this](service::ResolverParams&& params) { return resolveMeowVolume(std::move(params)); } },
-		{ R"gql(doesKnowCommand)gql"sv, [this](service::ResolverParams&& params) { return resolveDoesKnowCommand(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(name)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Cat&>(object).resolveName(std::move(params)); } },
+		{ R"gql(nickname)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Cat&>(object).resolveNickname(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Cat&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(meowVolume)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Cat&>(object).resolveMeowVolume(std::move(params)); } },
+		{ R"gql(doesKnowCommand)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Cat&>(object).resolveDoesKnowCommand(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void Cat::beginSelectionSet(const service::SelectionSetParams& params) const
@@ -22,32 +22,36 @@ namespace graphql::validation {
 namespace object {
 
 Dog::Dog(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(Dog)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames Dog::getTypeNames() const noexcept
+const service::TypeNames& Dog::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(Pet)gql"sv,
 		R"gql(CatOrDog)gql"sv,
 		R"gql(DogOrHuman)gql"sv,
 		R"gql(Dog)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Dog::getResolvers() const noexcept
+const service::ResolverTable& Dog::getResolvers() noexcept
 {
-	return {
-		{ R"gql(name)gql"sv, [this](service::ResolverParams&& params) { return resolveName(std::move(params)); } },
-		{ R"gql(owner)gql"sv, [this](service::ResolverParams&& params) { return resolveOwner(std::move(params)); } },
-		{ R"gql(nickname)gql"sv, [this](service::ResolverParams&& params) { return resolveNickname(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(barkVolume)gql"sv, [this](service::ResolverParams&& params) { return resolveBarkVolume(std::move(params)); } },
-		{ R"gql(isHousetrained)gql"sv, [this](service::ResolverParams&& params) { return resolveIsHousetrained(std::move(params)); } },
-		{ R"gql(doesKnowCommand)gql"sv, [this](service::ResolverParams&& params) { return resolveDoesKnowCommand(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(name)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Dog&>(object).resolveName(std::move(params)); } },
+		{ R"gql(owner)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Dog&>(object).resolveOwner(std::move(params)); } },
+		{ R"gql(nickname)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Dog&>(object).resolveNickname(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Dog&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(barkVolume)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Dog&>(object).resolveBarkVolume(std::move(params)); } },
+		{ R"gql(isHousetrained)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Dog&>(object).resolveIsHousetrained(std::move(params)); } },
+		{ R"gql(doesKnowCommand)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Dog&>(object).resolveDoesKnowCommand(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void Dog::beginSelectionSet(const service::SelectionSetParams& params) const
@@ -22,28 +22,32 @@ namespace graphql::validation {
 namespace object {
 
 Human::Human(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(Human)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames Human::getTypeNames() const noexcept
+const service::TypeNames& Human::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(Sentient)gql"sv,
 		R"gql(DogOrHuman)gql"sv,
 		R"gql(HumanOrAlien)gql"sv,
 		R"gql(Human)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Human::getResolvers() const noexcept
+const service::ResolverTable& Human::getResolvers() noexcept
 {
-	return {
-		{ R"gql(name)gql"sv, [this](service::ResolverParams&& params) { return resolveName(std::move(params)); } },
-		{ R"gql(pets)gql"sv, [this](service::ResolverParams&& params) { return resolvePets(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(name)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Human&>(object).resolveName(std::move(params)); } },
+		{ R"gql(pets)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Human&>(object).resolvePets(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Human&>(object).resolve_typename(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void Human::beginSelectionSet(const service::SelectionSetParams& params) const
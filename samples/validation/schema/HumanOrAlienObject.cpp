@@ -15,7 +15,7 @@ namespace graphql::validation {
 namespace object {
 
 HumanOrAlien::HumanOrAlien(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object { pimpl->getTypeNames(), pimpl->getResolvers() }
+	: service::Object { pimpl->getTypeNames(), pimpl->getResolvers(), &pimpl->getObject() }
 	, _pimpl { std::move(pimpl) }
 {
 }
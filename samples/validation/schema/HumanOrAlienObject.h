@@ -20,8 +20,9 @@ private:
 	{
 		virtual ~Concept() = default;
 
-		[[nodiscard("unnecessary call")]] virtual service::TypeNames getTypeNames() const noexcept = 0;
-		[[nodiscard("unnecessary call")]] virtual service::ResolverMap getResolvers() const noexcept = 0;
+		[[nodiscard("unnecessary call")]] virtual const service::TypeNames& getTypeNames() const noexcept = 0;
+		[[nodiscard("unnecessary call")]] virtual const service::ResolverTable& getResolvers() const noexcept = 0;
+		[[nodiscard("unnecessary call")]] virtual const service::Object& getObject() const noexcept = 0;
 
 		virtual void beginSelectionSet(const service::SelectionSetParams& params) const = 0;
 		virtual void endSelectionSet(const service::SelectionSetParams& params) const = 0;
@@ -36,14 +37,19 @@ private:
 		{
 		}
 
-		[[nodiscard("unnecessary call")]] service::TypeNames getTypeNames() const noexcept override
+		[[nodiscard("unnecessary call")]] const service::TypeNames& getTypeNames() const noexcept override
 		{
-			return _pimpl->getTypeNames();
+			return T::getTypeNames();
 		}
 
-		[[nodiscard("unnecessary call")]] service::ResolverMap getResolvers() const noexcept override
+		[[nodiscard("unnecessary call")]] const service::ResolverTable& getResolvers() const noexcept override
 		{
-			return _pimpl->getResolvers();
+			return T::getResolvers();
+		}
+
+		[[nodiscard("unnecessary call")]] const service::Object& getObject() const noexcept override
+		{
+			return *_pimpl;
 		}
 
 		void beginSelectionSet(const service::SelectionSetParams& params) const override
@@ -21,25 +21,29 @@ namespace graphql::validation {
 namespace object {
 
 Message::Message(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(Message)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames Message::getTypeNames() const noexcept
+const service::TypeNames& Message::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(Message)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Message::getResolvers() const noexcept
+const service::ResolverTable& Message::getResolvers() noexcept
 {
-	return {
-		{ R"gql(body)gql"sv, [this](service::ResolverParams&& params) { return resolveBody(std::move(params)); } },
-		{ R"gql(sender)gql"sv, [this](service::ResolverParams&& params) { return resolveSender(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(body)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Message&>(object).resolveBody(std::move(params)); } },
+		{ R"gql(sender)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Message&>(object).resolveSender(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Message&>(object).resolve_typename(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void Message::beginSelectionSet(const service::SelectionSetParams& params) const
@@ -21,24 +21,28 @@ namespace graphql::validation {
 namespace object {
 
 MutateDogResult::MutateDogResult(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(MutateDogResult)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames MutateDogResult::getTypeNames() const noexcept
+const service::TypeNames& MutateDogResult::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(MutateDogResult)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap MutateDogResult::getResolvers() const noexcept
+const service::ResolverTable& MutateDogResult::getResolvers() noexcept
 {
-	return {
-		{ R"gql(id)gql"sv, [this](service::ResolverParams&& params) { return resolveId(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(id)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const MutateDogResult&>(object).resolveId(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const MutateDogResult&>(object).resolve_typename(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void MutateDogResult::beginSelectionSet(const service::SelectionSetParams& params) const
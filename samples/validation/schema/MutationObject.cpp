@@ -22,24 +22,28 @@ namespace graphql::validation {
 namespace object {
 
 Mutation::Mutation(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(Mutation)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames Mutation::getTypeNames() const noexcept
+const service::TypeNames& Mutation::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(Mutation)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Mutation::getResolvers() const noexcept
+const service::ResolverTable& Mutation::getResolvers() noexcept
 {
-	return {
-		{ R"gql(mutateDog)gql"sv, [this](service::ResolverParams&& params) { return resolveMutateDog(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(mutateDog)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Mutation&>(object).resolveMutateDog(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Mutation&>(object).resolve_typename(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void Mutation::beginSelectionSet(const service::SelectionSetParams& params) const
@@ -22,25 +22,29 @@ namespace graphql::validation {
 namespace object {
 
 Subscription::Subscription(std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(Subscription)gql"sv }
 	, _pimpl { std::move(pimpl) }
 {
 }
 
-service::TypeNames Subscription::getTypeNames() const noexcept
+const service::TypeNames& Subscription::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(Subscription)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Subscription::getResolvers() const noexcept
+const service::ResolverTable& Subscription::getResolvers() noexcept
 {
-	return {
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(newMessage)gql"sv, [this](service::ResolverParams&& params) { return resolveNewMessage(std::move(params)); } },
-		{ R"gql(disallowedSecondRootField)gql"sv, [this](service::ResolverParams&& params) { return resolveDisallowedSecondRootField(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Subscription&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(newMessage)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Subscription&>(object).resolveNewMessage(std::move(params)); } },
+		{ R"gql(disallowedSecondRootField)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Subscription&>(object).resolveDisallowedSecondRootField(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 void Subscription::beginSelectionSet(const service::SelectionSetParams& params) const
@@ -6,11 +6,162 @@
 #include <array>
 #include <stdexcept>
 
+// clang-format off
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+	#define GRAPHQL_BASE64_SSSE3
+
+	#include <tmmintrin.h>
+
+	#ifdef _MSC_VER
+		#include <intrin.h>
+
+		#define GRAPHQL_TARGET_SSSE3
+	#else // !_MSC_VER
+		#define GRAPHQL_TARGET_SSSE3 __attribute__((target("ssse3")))
+	#endif // !_MSC_VER
+#endif // __x86_64__ || _M_X64 || __i386__ || _M_IX86
+// clang-format on
+
 namespace graphql::internal {
 
+// Look up every char at once instead of testing each range in Base64::fromBase64(char).
+constexpr auto c_fromBase64 = []() noexcept {
+	std::array<std::uint8_t, 256> table {};
+
+	for (size_t i = 0; i < table.size(); ++i)
+	{
+		table[i] = Base64::fromBase64(static_cast<char>(i));
+	}
+
+	return table;
+}();
+
+constexpr std::string_view c_toBase64 {
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+};
+
+constexpr std::uint8_t fromBase64Table(char ch) noexcept
+{
+	return c_fromBase64[static_cast<unsigned char>(ch)];
+}
+
+#ifdef GRAPHQL_BASE64_SSSE3
+
+bool hasSSSE3() noexcept
+{
+	#ifdef _MSC_VER
+	std::array<int, 4> info {};
+
+	__cpuid(info.data(), 1);
+
+	return (info[2] & (1 << 9)) != 0;
+	#else  // !_MSC_VER
+	return __builtin_cpu_supports("ssse3");
+	#endif // !_MSC_VER
+}
+
+bool useSSSE3() noexcept
+{
+	static const bool s_hasSSSE3 = hasSSSE3();
+
+	return s_hasSSSE3;
+}
+
+// Decode 16 characters into 12 bytes at a time, until there are fewer than 16 characters left or
+// the next 16 include padding or an invalid character, and return the number of characters which
+// were decoded. Each iteration stores 16 bytes, so there must be 4 bytes of extra space at the end
+// of decoded. See http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html for the details.
+GRAPHQL_TARGET_SSSE3 size_t decodeSSSE3(
+	const char* encoded, size_t count, std::uint8_t* decoded) noexcept
+{
+	// clang-format off
+	const __m128i lutLo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+	const __m128i lutHi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+	const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+		0, 0, 0, 0, 0, 0, 0, 0);
+	const __m128i reorder = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+		-1, -1, -1, -1);
+	// clang-format on
+	const __m128i mask2F = _mm_set1_epi8(0x2F);
+	const __m128i packBits = _mm_set1_epi32(0x01400140);
+	const __m128i packBytes = _mm_set1_epi32(0x00011000);
+	size_t decodedCount = 0;
+
+	while (count - decodedCount >= 16)
+	{
+		__m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(encoded + decodedCount));
+		const __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(chars, 4), mask2F);
+		const __m128i loNibbles = _mm_and_si128(chars, mask2F);
+		const __m128i hi = _mm_shuffle_epi8(lutHi, hiNibbles);
+		const __m128i lo = _mm_shuffle_epi8(lutLo, loNibbles);
+
+		if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0)
+		{
+			// Let the scalar decoder handle padding or report the invalid character.
+			break;
+		}
+
+		const __m128i roll =
+			_mm_shuffle_epi8(lutRoll, _mm_add_epi8(_mm_cmpeq_epi8(chars, mask2F), hiNibbles));
+
+		chars = _mm_add_epi8(chars, roll);
+		chars = _mm_madd_epi16(_mm_maddubs_epi16(chars, packBits), packBytes);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(decoded), _mm_shuffle_epi8(chars, reorder));
+
+		decodedCount += 16;
+		decoded += 12;
+	}
+
+	return decodedCount;
+}
+
+// Encode 12 bytes into 16 characters at a time, until there are fewer than 16 bytes left to read,
+// and return the number of bytes which were encoded. See
+// http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html for the details.
+GRAPHQL_TARGET_SSSE3 size_t encodeSSSE3(
+	const std::uint8_t* bytes, size_t count, char* encoded) noexcept
+{
+	// clang-format off
+	const __m128i shuffle = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+	const __m128i lutOffsets = _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4,
+		-4, -4, -4, -4, -19, -16, 0, 0);
+	// clang-format on
+	const __m128i maskAC = _mm_set1_epi32(0x0FC0FC00);
+	const __m128i shiftAC = _mm_set1_epi32(0x04000040);
+	const __m128i maskBD = _mm_set1_epi32(0x003F03F0);
+	const __m128i shiftBD = _mm_set1_epi32(0x01000010);
+	const __m128i range51 = _mm_set1_epi8(51);
+	const __m128i range25 = _mm_set1_epi8(25);
+	size_t encodedCount = 0;
+
+	while (count - encodedCount >= 16)
+	{
+		const __m128i input = _mm_shuffle_epi8(
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + encodedCount)),
+			shuffle);
+		const __m128i indices =
+			_mm_or_si128(_mm_mulhi_epu16(_mm_and_si128(input, maskAC), shiftAC),
+				_mm_mullo_epi16(_mm_and_si128(input, maskBD), shiftBD));
+		const __m128i offsets = _mm_sub_epi8(_mm_subs_epu8(indices, range51),
+			_mm_cmpgt_epi8(indices, range25));
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(encoded),
+			_mm_add_epi8(indices, _mm_shuffle_epi8(lutOffsets, offsets)));
+
+		encodedCount += 12;
+		encoded += 16;
+	}
+
+	return encodedCount;
+}
+
+#endif // GRAPHQL_BASE64_SSSE3
+
 std::uint8_t Base64::verifyFromBase64(char ch)
 {
-	const std::uint8_t result = fromBase64(ch);
+	const std::uint8_t result = fromBase64Table(ch);
 
 	if ((result & 0xC0) != 0)
 	{
@@ -29,19 +180,42 @@ std::vector<std::uint8_t> Base64::fromBase64(std::string_view encoded)
 		return result;
 	}
 
-	result.reserve((encoded.size() + (encoded.size() % 4)) * 3 / 4);
+	// Leave room for the 4 extra bytes the SIMD decoder stores past the end of its output.
+	result.resize((encoded.size() / 4) * 3 + 4);
+
+	std::uint8_t* decoded = result.data();
+
+#ifdef GRAPHQL_BASE64_SSSE3
+	if (useSSSE3())
+	{
+		const size_t count = decodeSSSE3(encoded.data(), encoded.size(), decoded);
+
+		decoded += (count / 4) * 3;
+		encoded = encoded.substr(count);
+	}
+#endif // GRAPHQL_BASE64_SSSE3
 
-	// First decode all of the full unpadded segments 24 bits at a time
+	// Decode all of the remaining full unpadded segments 24 bits at a time
 	while (encoded.size() >= 4 && encoded[3] != padding)
 	{
-		const uint32_t segment = (static_cast<uint32_t>(verifyFromBase64(encoded[0])) << 18)
-			| (static_cast<uint32_t>(verifyFromBase64(encoded[1])) << 12)
-			| (static_cast<uint32_t>(verifyFromBase64(encoded[2])) << 6)
-			| static_cast<uint32_t>(verifyFromBase64(encoded[3]));
+		const auto a = fromBase64Table(encoded[0]);
+		const auto b = fromBase64Table(encoded[1]);
+		const auto c = fromBase64Table(encoded[2]);
+		const auto d = fromBase64Table(encoded[3]);
+
+		if (((a | b | c | d) & 0xC0) != 0)
+		{
+			throw std::logic_error { "invalid character in base64 encoded string" };
+		}
 
-		result.emplace_back(static_cast<std::uint8_t>((segment & 0xFF0000) >> 16));
-		result.emplace_back(static_cast<std::uint8_t>((segment & 0xFF00) >> 8));
-		result.emplace_back(static_cast<std::uint8_t>(segment & 0xFF));
+		const uint32_t segment = (static_cast<uint32_t>(a) << 18)
+			| (static_cast<uint32_t>(b) << 12) | (static_cast<uint32_t>(c) << 6)
+			| static_cast<uint32_t>(d);
+
+		decoded[0] = static_cast<std::uint8_t>((segment & 0xFF0000) >> 16);
+		decoded[1] = static_cast<std::uint8_t>((segment & 0xFF00) >> 8);
+		decoded[2] = static_cast<std::uint8_t>(segment & 0xFF);
+		decoded += 3;
 
 		encoded = encoded.substr(4);
 	}
@@ -62,8 +236,9 @@ std::vector<std::uint8_t> Base64::fromBase64(std::string_view encoded)
 				throw std::logic_error { "invalid padding at the end of a base64 encoded string" };
 			}
 
-			result.emplace_back(static_cast<std::uint8_t>((segment & 0xFF00) >> 8));
-			result.emplace_back(static_cast<std::uint8_t>(segment & 0xFF));
+			decoded[0] = static_cast<std::uint8_t>((segment & 0xFF00) >> 8);
+			decoded[1] = static_cast<std::uint8_t>(segment & 0xFF);
+			decoded += 2;
 
 			encoded = encoded.substr(3);
 		}
@@ -74,7 +249,8 @@ std::vector<std::uint8_t> Base64::fromBase64(std::string_view encoded)
 				throw std::logic_error { "invalid padding at the end of a base64 encoded string" };
 			}
 
-			result.emplace_back(static_cast<std::uint8_t>((segment & 0xFF00) >> 8));
+			decoded[0] = static_cast<std::uint8_t>((segment & 0xFF00) >> 8);
+			decoded += 1;
 
 			encoded = encoded.substr(2);
 		}
@@ -87,19 +263,19 @@ std::vector<std::uint8_t> Base64::fromBase64(std::string_view encoded)
 		throw std::logic_error { "invalid padding at the end of a base64 encoded string" };
 	}
 
+	result.resize(static_cast<size_t>(decoded - result.data()));
+
 	return result;
 }
 
 char Base64::verifyToBase64(std::uint8_t i)
 {
-	unsigned char result = toBase64(i);
-
-	if (result == padding)
+	if (i >= c_toBase64.size())
 	{
 		throw std::logic_error { "invalid 6-bit value" };
 	}
 
-	return result;
+	return c_toBase64[i];
 }
 
 std::string Base64::toBase64(const std::vector<std::uint8_t>& bytes)
@@ -114,18 +290,32 @@ std::string Base64::toBase64(const std::vector<std::uint8_t>& bytes)
 	size_t count = bytes.size();
 	const std::uint8_t* data = bytes.data();
 
-	result.reserve((count + (count % 3)) * 4 / 3);
+	result.resize(((count + 2) / 3) * 4);
+
+	char* encoded = result.data();
+
+#ifdef GRAPHQL_BASE64_SSSE3
+	if (useSSSE3())
+	{
+		const size_t encodedCount = encodeSSSE3(data, count, encoded);
+
+		data += encodedCount;
+		count -= encodedCount;
+		encoded += (encodedCount / 3) * 4;
+	}
+#endif // GRAPHQL_BASE64_SSSE3
 
-	// First encode all of the full unpadded segments 24 bits at a time
+	// Encode all of the remaining full unpadded segments 24 bits at a time
 	while (count >= 3)
 	{
 		const uint32_t segment = (static_cast<uint32_t>(data[0]) << 16)
 			| (static_cast<uint32_t>(data[1]) << 8) | static_cast<uint32_t>(data[2]);
 
-		result.append({ verifyToBase64(static_cast<std::uint8_t>((segment & 0xFC0000) >> 18)),
-			verifyToBase64(static_cast<std::uint8_t>((segment & 0x3F000) >> 12)),
-			verifyToBase64(static_cast<std::uint8_t>((segment & 0xFC0) >> 6)),
-			verifyToBase64(static_cast<std::uint8_t>(segment & 0x3F)) });
+		encoded[0] = c_toBase64[(segment & 0xFC0000) >> 18];
+		encoded[1] = c_toBase64[(segment & 0x3F000) >> 12];
+		encoded[2] = c_toBase64[(segment & 0xFC0) >> 6];
+		encoded[3] = c_toBase64[segment & 0x3F];
+		encoded += 4;
 
 		data += 3;
 		count -= 3;
@@ -137,13 +327,11 @@ std::string Base64::toBase64(const std::vector<std::uint8_t>& bytes)
 		const bool pair = (count > 1);
 		const uint16_t segment =
 			(static_cast<uint16_t>(data[0]) << 8) | (pair ? static_cast<uint16_t>(data[1]) : 0);
-		const std::array<char, 4> remainder { verifyToBase64(static_cast<std::uint8_t>(
-												  (segment & 0xFC00) >> 10)),
-			verifyToBase64(static_cast<std::uint8_t>((segment & 0x3F0) >> 4)),
-			(pair ? verifyToBase64(static_cast<std::uint8_t>((segment & 0xF) << 2)) : padding),
-			padding };
 
-		result.append(remainder.data(), remainder.size());
+		encoded[0] = c_toBase64[(segment & 0xFC00) >> 10];
+		encoded[1] = c_toBase64[(segment & 0x3F0) >> 4];
+		encoded[2] = (pair ? c_toBase64[(segment & 0xF) << 2] : padding);
+		encoded[3] = padding;
 	}
 
 	return result;
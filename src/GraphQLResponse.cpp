@@ -9,11 +9,63 @@
 #include <iterator>
 #include <map>
 #include <optional>
+#include <ostream>
 #include <stdexcept>
 #include <variant>
 
 namespace graphql::response {
 
+MapKey::MapKey() noexcept
+	: _key { std::string {} }
+{
+}
+
+MapKey::MapKey(std::string&& key) noexcept
+	: _key { std::move(key) }
+{
+}
+
+MapKey::MapKey(const char* key)
+	: _key { std::string { key } }
+{
+}
+
+MapKey::MapKey(std::string_view key)
+	: _key { std::string { key } }
+{
+}
+
+MapKey::MapKey(std::shared_ptr<const std::string> key) noexcept
+	: _key { std::string {} }
+{
+	if (key)
+	{
+		_key = std::move(key);
+	}
+}
+
+MapKey::operator const std::string&() const noexcept
+{
+	return std::holds_alternative<std::string>(_key)
+		? std::get<std::string>(_key)
+		: *std::get<std::shared_ptr<const std::string>>(_key);
+}
+
+MapKey::operator std::string_view() const noexcept
+{
+	return static_cast<const std::string&>(*this);
+}
+
+bool MapKey::operator==(std::string_view rhs) const noexcept
+{
+	return static_cast<std::string_view>(*this) == rhs;
+}
+
+std::ostream& operator<<(std::ostream& stream, const MapKey& key)
+{
+	return stream << static_cast<std::string_view>(key);
+}
+
 IdType::IdType(IdType&& other /* = IdType { ByteData {} } */) noexcept
 	: _data { std::move(other._data) }
 {
@@ -1318,7 +1370,7 @@ size_t Value::size() const
 	}
 }
 
-bool Value::emplace_back(std::string&& name, Value&& value)
+bool Value::emplace_back(MapKey&& name, Value&& value)
 {
 	if (std::holds_alternative<SharedData>(_data))
 	{
@@ -1443,18 +1495,32 @@ const Value& Value::operator[](size_t index) const
 
 void Writer::write(Value response) const
 {
-	switch (response.type())
+	writeValue(response);
+}
+
+void Writer::write(const std::shared_ptr<const Value>& value) const
+{
+	if (!value)
+	{
+		_concept->write_null();
+		return;
+	}
+
+	writeValue(*value);
+}
+
+void Writer::writeValue(const Value& value) const
+{
+	switch (value.type())
 	{
 		case Type::Map:
 		{
-			auto members = response.release<MapType>();
-
 			_concept->start_object();
 
-			for (auto& entry : members)
+			for (const auto& entry : value.get<MapType>())
 			{
 				_concept->add_member(entry.first);
-				write(std::move(entry.second));
+				writeValue(entry.second);
 			}
 
 			_concept->end_object();
@@ -1463,26 +1529,29 @@ void Writer::write(Value response) const
 
 		case Type::List:
 		{
-			auto elements = response.release<ListType>();
-
 			_concept->start_array();
 
-			for (auto& entry : elements)
+			for (const auto& entry : value.get<ListType>())
 			{
-				write(std::move(entry));
+				writeValue(entry);
 			}
 
 			_concept->end_arrary();
 			break;
 		}
 
-		case Type::String:
-		case Type::EnumValue:
 		case Type::ID:
 		{
-			auto value = response.release<StringType>();
+			IdType idType { value.get<IdType>() };
+
+			_concept->write_string(idType.release<IdType::OpaqueString>());
+			break;
+		}
 
-			_concept->write_string(value);
+		case Type::String:
+		case Type::EnumValue:
+		{
+			_concept->write_string(value.get<StringType>());
 			break;
 		}
 
@@ -1494,25 +1563,25 @@ void Writer::write(Value response) const
 
 		case Type::Boolean:
 		{
-			_concept->write_bool(response.get<BooleanType>());
+			_concept->write_bool(value.get<BooleanType>());
 			break;
 		}
 
 		case Type::Int:
 		{
-			_concept->write_int(response.get<IntType>());
+			_concept->write_int(value.get<IntType>());
 			break;
 		}
 
 		case Type::Float:
 		{
-			_concept->write_float(response.get<FloatType>());
+			_concept->write_float(value.get<FloatType>());
 			break;
 		}
 
 		case Type::Scalar:
 		{
-			write(response.release<ScalarType>());
+			writeValue(value.get<ScalarType>());
 			break;
 		}
 
@@ -1524,4 +1593,29 @@ void Writer::write(Value response) const
 	}
 }
 
+void Writer::start_object() const
+{
+	_concept->start_object();
+}
+
+void Writer::add_member(const std::string& key) const
+{
+	_concept->add_member(key);
+}
+
+void Writer::end_object() const
+{
+	_concept->end_object();
+}
+
+void Writer::start_array() const
+{
+	_concept->start_array();
+}
+
+void Writer::end_array() const
+{
+	_concept->end_arrary();
+}
+
 } // namespace graphql::response
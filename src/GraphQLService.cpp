@@ -9,8 +9,24 @@
 
 #include <algorithm>
 #include <array>
+#include <charconv>
 #include <iostream>
 
+// clang-format off
+#if defined(_WIN32)
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#elif defined(__linux__)
+	#include <pthread.h>
+	#include <sched.h>
+#endif
+// clang-format on
+
 namespace graphql::service {
 
 void addErrorMessage(std::string&& message, response::Value& error)
@@ -179,6 +195,89 @@ std::string unimplemented_method::getMessage(std::string_view methodName) noexce
 	return oss.str();
 }
 
+struct RequestState::LoaderState
+{
+	std::mutex mutex {};
+	std::vector<DataLoaderBase*> pending {};
+	std::atomic_size_t batchDepth = 0;
+};
+
+RequestState::RequestState()
+	: _loaders { std::make_unique<LoaderState>() }
+{
+}
+
+RequestState::RequestState(const RequestState& other)
+	: std::enable_shared_from_this<RequestState>(other)
+	, _loaders { std::make_unique<LoaderState>() }
+{
+}
+
+RequestState& RequestState::operator=(const RequestState& other) noexcept
+{
+	std::enable_shared_from_this<RequestState>::operator=(other);
+
+	return *this;
+}
+
+RequestState::~RequestState() = default;
+
+void RequestState::beginBatch() noexcept
+{
+	++_loaders->batchDepth;
+}
+
+void RequestState::endBatch() noexcept
+{
+	if (--_loaders->batchDepth == 0)
+	{
+		dispatchPending();
+	}
+}
+
+void RequestState::schedule(DataLoaderBase& loader)
+{
+	{
+		std::lock_guard lock { _loaders->mutex };
+
+		if (std::find(_loaders->pending.cbegin(), _loaders->pending.cend(), &loader)
+			== _loaders->pending.cend())
+		{
+			_loaders->pending.push_back(&loader);
+		}
+	}
+
+	// Check the depth after adding the loader, so a batch which closes on another thread either
+	// sees it in the pending loaders or we dispatch it here.
+	if (_loaders->batchDepth == 0)
+	{
+		dispatchPending();
+	}
+}
+
+void RequestState::unschedule(DataLoaderBase& loader) noexcept
+{
+	std::lock_guard lock { _loaders->mutex };
+
+	std::erase(_loaders->pending, &loader);
+}
+
+void RequestState::dispatchPending() noexcept
+{
+	std::vector<DataLoaderBase*> loaders;
+
+	{
+		std::lock_guard lock { _loaders->mutex };
+
+		loaders.swap(_loaders->pending);
+	}
+
+	for (auto loader : loaders)
+	{
+		loader->dispatch();
+	}
+}
+
 void await_worker_thread::await_suspend(coro::coroutine_handle<> h) const
 {
 	std::thread(
@@ -247,6 +346,158 @@ void await_worker_queue::resumePending()
 	}
 }
 
+// Remember which pool and queue the current worker thread belongs to, so coroutines which suspend
+// on a worker are queued on that worker's own queue.
+thread_local const await_worker_pool* t_workerPool = nullptr;
+thread_local size_t t_workerIndex = 0;
+
+void setWorkerAffinity([[maybe_unused]] std::thread& worker, [[maybe_unused]] size_t cpu)
+{
+#if defined(_WIN32)
+	if (cpu < sizeof(DWORD_PTR) * 8)
+	{
+		SetThreadAffinityMask(worker.native_handle(), DWORD_PTR { 1 } << cpu);
+	}
+#elif defined(__linux__)
+	cpu_set_t cpus;
+
+	CPU_ZERO(&cpus);
+	CPU_SET(cpu, &cpus);
+	pthread_setaffinity_np(worker.native_handle(), sizeof(cpus), &cpus);
+#endif
+}
+
+await_worker_pool::await_worker_pool(size_t threadCount, bool pinThreads)
+	: _queues(threadCount == 0
+			? std::max(size_t { 1 }, static_cast<size_t>(std::thread::hardware_concurrency()))
+			: threadCount)
+{
+	const auto cpuCount =
+		std::max(size_t { 1 }, static_cast<size_t>(std::thread::hardware_concurrency()));
+
+	_workers.reserve(_queues.size());
+
+	for (size_t i = 0; i < _queues.size(); ++i)
+	{
+		_workers.emplace_back([this, i]() {
+			resumePending(i);
+		});
+
+		if (pinThreads)
+		{
+			setWorkerAffinity(_workers.back(), i % cpuCount);
+		}
+	}
+}
+
+await_worker_pool::~await_worker_pool()
+{
+	std::unique_lock lock { _idleMutex };
+
+	_shutdown = true;
+	lock.unlock();
+	_idleCv.notify_all();
+
+	for (auto& worker : _workers)
+	{
+		worker.join();
+	}
+}
+
+void await_worker_pool::await_suspend(coro::coroutine_handle<> h)
+{
+	const auto index = (t_workerPool == this)
+		? t_workerIndex
+		: _nextQueue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+	auto& queue = _queues[index];
+	std::unique_lock lock { queue.mutex };
+
+	queue.pending.push_back(std::move(h));
+	++_pending;
+	lock.unlock();
+
+	// Only wake a worker if one of them might be waiting, a busy worker will find this coroutine
+	// on its own the next time it checks the queues.
+	if (_idle > 0)
+	{
+		std::lock_guard idleLock { _idleMutex };
+
+		_idleCv.notify_one();
+	}
+}
+
+size_t await_worker_pool::size() const noexcept
+{
+	return _workers.size();
+}
+
+void await_worker_pool::resumePending(size_t index)
+{
+	t_workerPool = this;
+	t_workerIndex = index;
+
+	for (;;)
+	{
+		if (auto h = takePending(index))
+		{
+			h.resume();
+			continue;
+		}
+
+		std::unique_lock lock { _idleMutex };
+
+		++_idle;
+		_idleCv.wait(lock, [this]() {
+			return _shutdown || _pending > 0;
+		});
+		--_idle;
+
+		if (_shutdown && _pending == 0)
+		{
+			break;
+		}
+	}
+}
+
+coro::coroutine_handle<> await_worker_pool::takePending(size_t index)
+{
+	coro::coroutine_handle<> h {};
+
+	// Take the newest coroutine from this worker's own queue first, it's more likely to still be
+	// in the cache.
+	{
+		auto& queue = _queues[index];
+		std::lock_guard lock { queue.mutex };
+
+		if (!queue.pending.empty())
+		{
+			h = queue.pending.back();
+			queue.pending.pop_back();
+			--_pending;
+
+			return h;
+		}
+	}
+
+	// Steal the oldest coroutine from the next worker with a non-empty queue.
+	for (size_t offset = 1; offset < _queues.size(); ++offset)
+	{
+		auto& queue = _queues[(index + offset) % _queues.size()];
+		std::lock_guard lock { queue.mutex };
+
+		if (!queue.pending.empty())
+		{
+			h = queue.pending.front();
+			queue.pending.pop_front();
+			--_pending;
+
+			return h;
+		}
+	}
+
+	return h;
+}
+
 // Default to immediate synchronous execution.
 await_async::await_async()
 	: _pimpl { std::static_pointer_cast<const Concept>(
@@ -279,6 +530,75 @@ void await_async::await_resume() const
 	_pimpl->await_resume();
 }
 
+bool RequestCancellation::stopRequested() const noexcept
+{
+	return stopToken.stop_requested()
+		|| (deadline && std::chrono::steady_clock::now() >= *deadline);
+}
+
+schema_error RequestCancellation::getError(schema_location location, error_path&& path) const
+{
+	using namespace std::literals;
+
+	return { std::string { stopToken.stop_requested() ? R"ex(Request cancelled)ex"sv
+													  : R"ex(Request deadline exceeded)ex"sv },
+		location,
+		std::move(path) };
+}
+
+RequestInstrumentation::~RequestInstrumentation()
+{
+	// The default destructor can't be inlined in the header because it's virtual.
+}
+
+void RequestInstrumentation::beginPhase(RequestPhase)
+{
+	// This virtual method may be overridden in a sub-class.
+}
+
+void RequestInstrumentation::endPhase(RequestPhase, std::chrono::steady_clock::duration)
+{
+	// This virtual method may be overridden in a sub-class.
+}
+
+void RequestInstrumentation::beginField(std::string_view, std::string_view, const error_path&)
+{
+	// This virtual method may be overridden in a sub-class.
+}
+
+void RequestInstrumentation::endField(
+	std::string_view, std::string_view, const error_path&, std::chrono::steady_clock::duration)
+{
+	// This virtual method may be overridden in a sub-class.
+}
+
+response::Value RequestInstrumentation::getExtensions()
+{
+	return {};
+}
+
+std::chrono::steady_clock::time_point beginRequestPhase(
+	RequestInstrumentation* instrumentation, RequestPhase phase)
+{
+	if (!instrumentation)
+	{
+		return {};
+	}
+
+	instrumentation->beginPhase(phase);
+
+	return std::chrono::steady_clock::now();
+}
+
+void endRequestPhase(RequestInstrumentation* instrumentation, RequestPhase phase,
+	std::chrono::steady_clock::time_point start)
+{
+	if (instrumentation)
+	{
+		instrumentation->endPhase(phase, std::chrono::steady_clock::now() - start);
+	}
+}
+
 FieldParams::FieldParams(SelectionSetParams&& selectionSetParams, Directives directives)
 	: SelectionSetParams(std::move(selectionSetParams))
 	, fieldDirectives(std::move(directives))
@@ -810,8 +1130,18 @@ AwaitableResolver Result<Object>::convert(
 	// Move the paramsArg into a local variable before the first suspension point.
 	auto params = std::move(paramsArg);
 
+	// Keep the parent's batch open across the hop, so the fields of an object which starts on
+	// another thread still add their DataLoader keys to the same batch as their siblings.
+	std::optional<DataLoaderBatch> batch { std::in_place, params.state.get() };
+
 	co_await params.launch;
 
+	// The field getter may be waiting for a DataLoader, so it can't wait for the batch.
+	if (!result.await_ready())
+	{
+		batch.reset();
+	}
+
 	auto awaitedResult = co_await std::move(result);
 
 	if (!awaitedResult)
@@ -819,12 +1149,23 @@ AwaitableResolver Result<Object>::convert(
 		co_return ResolverResult {};
 	}
 
-	auto document = co_await awaitedResult->resolve(params,
-		*params.selection,
-		params.fragments,
-		params.variables);
+	if (params.streamed)
+	{
+		// Start the fields now, but leave them for the ResolverStream to write in document order.
+		auto stream =
+			awaitedResult->stream(params, *params.selection, params.fragments, params.variables);
 
-	co_return std::move(document);
+		batch.reset();
+
+		co_return ResolverResult { {}, {}, std::move(stream) };
+	}
+
+	auto document =
+		awaitedResult->resolve(params, *params.selection, params.fragments, params.variables);
+
+	batch.reset();
+
+	co_return co_await std::move(document);
 }
 
 template <>
@@ -878,87 +1219,108 @@ void Result<response::Value>::validateScalar(const response::Value&)
 	// Any response::Value is valid for a custom scalar type.
 }
 
-// SelectionVisitor visits the AST and resolves a field or fragment, unless it's skipped by
-// a directive or type condition.
-class SelectionVisitor
+// SelectionPlan is a selection set compiled for a specific set of TypeNames. The field names and
+// aliases, fragment type conditions, and any directives or arguments which do not reference
+// variables are all evaluated once when it is compiled, so resolving the same selection set for
+// each object in a list only needs to evaluate the variable references again.
+struct SelectionPlan
 {
-public:
-	explicit SelectionVisitor(const SelectionSetParams& selectionSetParams,
-		const FragmentMap& fragments, const response::Value& variables, const TypeNames& typeNames,
-		const ResolverMap& resolvers, size_t count);
-
-	void visit(const peg::ast_node& selection);
+	enum class StepType
+	{
+		Field,
+		BeginFragmentSpread,
+		EndFragmentSpread,
+		BeginInlineFragment,
+		EndInlineFragment,
+	};
 
-	struct VisitorValue
+	struct Step
 	{
+		StepType type = StepType::Field;
+
+		// Index of the step following the matching End step, if the fragment is skipped.
+		size_t end = 0;
+
+		// The field name or the fragment name.
 		std::string_view name;
-		std::optional<schema_location> location;
-		AwaitableResolver result;
+
+		// Index of the field in the ResolverTable if the plan was compiled for one.
+		size_t fieldId = 0;
+		std::string_view alias;
+
+		// The response map key for the alias, which is shared by every object resolved with a
+		// cached plan.
+		response::MapKey key;
+		const peg::ast_node* field = nullptr;
+		const peg::ast_node* selection = nullptr;
+		schema_location location {};
+
+		// Directives and arguments which reference variables are evaluated every time the step
+		// is executed, otherwise these are evaluated once when the plan is compiled.
+		const peg::ast_node* variableDirectives = nullptr;
+		const peg::ast_node* variableArguments = nullptr;
+		Directives directives;
+		response::Value arguments { response::Type::Map };
 	};
 
-	std::vector<VisitorValue> getValues();
+	std::vector<Step> steps;
+	size_t fieldCount = 0;
+};
+
+bool hasVariables(const peg::ast_node& node) noexcept
+{
+	return node.is_type<peg::variable_value>()
+		|| std::any_of(node.children.cbegin(),
+			node.children.cend(),
+			[](const auto& child) noexcept {
+				return hasVariables(*child);
+			});
+}
+
+// SelectionPlanCompiler visits the AST and flattens a selection set into a SelectionPlan, leaving
+// out any fields or fragments which are always skipped by a directive or type condition.
+class SelectionPlanCompiler
+{
+public:
+	explicit SelectionPlanCompiler(const FragmentMap& fragments, const TypeNames& typeNames,
+		const ResolverTable* resolverTable, bool internKeys);
+
+	void visit(const peg::ast_node& selection);
+
+	SelectionPlan getPlan();
 
 private:
+	bool compileDirectives(const peg::ast_node& node, SelectionPlan::Step& step) const;
+
 	void visitField(const peg::ast_node& field);
 	void visitFragmentSpread(const peg::ast_node& fragmentSpread);
 	void visitInlineFragment(const peg::ast_node& inlineFragment);
 
-	const ResolverContext _resolverContext;
-	const std::shared_ptr<RequestState>& _state;
-	const Directives& _operationDirectives;
-	const std::optional<std::reference_wrapper<const field_path>> _path;
-	const await_async _launch;
 	const FragmentMap& _fragments;
-	const response::Value& _variables;
 	const TypeNames& _typeNames;
-	const ResolverMap& _resolvers;
+	const ResolverTable* const _resolverTable;
+	const bool _internKeys;
 
-	std::shared_ptr<FragmentDefinitionDirectiveStack> _fragmentDefinitionDirectives;
-	std::shared_ptr<FragmentSpreadDirectiveStack> _fragmentSpreadDirectives;
-	std::shared_ptr<FragmentSpreadDirectiveStack> _inlineFragmentDirectives;
-	internal::string_view_set _names;
-	std::vector<VisitorValue> _values;
+	SelectionPlan _plan;
 };
 
-SelectionVisitor::SelectionVisitor(const SelectionSetParams& selectionSetParams,
-	const FragmentMap& fragments, const response::Value& variables, const TypeNames& typeNames,
-	const ResolverMap& resolvers, size_t count)
-	: _resolverContext(selectionSetParams.resolverContext)
-	, _state(selectionSetParams.state)
-	, _operationDirectives(selectionSetParams.operationDirectives)
-	, _path(selectionSetParams.errorPath
-			  ? std::make_optional(std::cref(*selectionSetParams.errorPath))
-			  : std::nullopt)
-	, _launch(selectionSetParams.launch)
-	, _fragments(fragments)
-	, _variables(variables)
+SelectionPlanCompiler::SelectionPlanCompiler(const FragmentMap& fragments,
+	const TypeNames& typeNames, const ResolverTable* resolverTable, bool internKeys)
+	: _fragments(fragments)
 	, _typeNames(typeNames)
-	, _resolvers(resolvers)
-	, _fragmentDefinitionDirectives { selectionSetParams.fragmentDefinitionDirectives }
-	, _fragmentSpreadDirectives { selectionSetParams.fragmentSpreadDirectives }
-	, _inlineFragmentDirectives { selectionSetParams.inlineFragmentDirectives }
+	, _resolverTable(resolverTable)
+	, _internKeys(internKeys)
 {
-	static const Directives s_emptyFragmentDefinitionDirectives;
-
-	// Traversing a SelectionSet from an Object type field should start tracking new fragment
-	// directives. The outer fragment directives are still there in the FragmentSpreadDirectiveStack
-	// if the field accessors want to inspect them.
-	_fragmentDefinitionDirectives->push_front(std::cref(s_emptyFragmentDefinitionDirectives));
-	_fragmentSpreadDirectives->push_front({});
-	_inlineFragmentDirectives->push_front({});
-
-	_names.reserve(count);
-	_values.reserve(count);
 }
 
-std::vector<SelectionVisitor::VisitorValue> SelectionVisitor::getValues()
+SelectionPlan SelectionPlanCompiler::getPlan()
 {
-	auto values = std::move(_values);
+	auto plan = std::move(_plan);
 
-	return values;
+	return plan;
 }
 
-void SelectionVisitor::visit(const peg::ast_node& selection)
+void SelectionPlanCompiler::visit(const peg::ast_node& selection)
 {
 	if (selection.is_type<peg::field>())
 	{
@@ -974,147 +1336,93 @@ void SelectionVisitor::visit(const peg::ast_node& selection)
 	}
 }
 
-void SelectionVisitor::visitField(const peg::ast_node& field)
+// Returns true if the directives do not reference any variables and they always skip this node.
+bool SelectionPlanCompiler::compileDirectives(
+	const peg::ast_node& node, SelectionPlan::Step& step) const
 {
-	std::string_view name;
+	bool skip = false;
 
-	peg::on_first_child<peg::field_name>(field, [&name](const peg::ast_node& child) {
-		name = child.string_view();
-	});
+	peg::on_first_child<peg::directives>(node, [&skip, &step](const peg::ast_node& child) {
+		if (hasVariables(child))
+		{
+			step.variableDirectives = &child;
+			return;
+		}
 
-	std::string_view alias;
+		static const response::Value s_noVariables(response::Type::Map);
+		DirectiveVisitor directiveVisitor(s_noVariables);
 
-	peg::on_first_child<peg::alias_name>(field, [&alias](const peg::ast_node& child) {
-		alias = child.string_view();
+		directiveVisitor.visit(child);
+		skip = directiveVisitor.shouldSkip();
+		step.directives = directiveVisitor.getDirectives();
 	});
 
-	if (alias.empty())
-	{
-		alias = name;
-	}
+	return skip;
+}
 
-	if (!_names.emplace(alias).second)
+void SelectionPlanCompiler::visitField(const peg::ast_node& field)
+{
+	SelectionPlan::Step step;
+
+	if (compileDirectives(field, step))
 	{
-		// Skip resolving fields which map to the same response name as a field we've already
-		// resolved. Validation should handle merging multiple references to the same field or
-		// to compatible fields.
 		return;
 	}
 
-	const auto itrResolver = _resolvers.find(name);
+	peg::on_first_child<peg::field_name>(field, [&step](const peg::ast_node& child) {
+		step.name = child.string_view();
+	});
 
-	if (itrResolver == _resolvers.end())
-	{
-		std::promise<ResolverResult> promise;
-		auto position = field.begin();
-		std::ostringstream error;
+	peg::on_first_child<peg::alias_name>(field, [&step](const peg::ast_node& child) {
+		step.alias = child.string_view();
+	});
 
-		error << "Unknown field name: " << name;
+	if (step.alias.empty())
+	{
+		step.alias = step.name;
+	}
 
-		promise.set_exception(
-			std::make_exception_ptr(schema_exception { { schema_error { error.str(),
-				{ position.line, position.column },
-				buildErrorPath(_path ? std::make_optional(_path->get()) : std::nullopt) } } }));
+	step.key = _internKeys ? response::MapKey { std::make_shared<const std::string>(step.alias) }
+						   : response::MapKey { step.alias };
 
-		_values.push_back({ alias, std::nullopt, promise.get_future() });
-		return;
+	if (_resolverTable)
+	{
+		// An unknown field gets an out of range id, which is reported when the step is executed.
+		step.fieldId =
+			static_cast<size_t>(_resolverTable->find(step.name) - _resolverTable->begin());
 	}
 
-	DirectiveVisitor directiveVisitor(_variables);
-
-	peg::on_first_child<peg::directives>(field, [&directiveVisitor](const peg::ast_node& child) {
-		directiveVisitor.visit(child);
-	});
-
-	if (directiveVisitor.shouldSkip())
-	{
-		return;
-	}
-
-	response::Value arguments(response::Type::Map);
+	peg::on_first_child<peg::arguments>(field, [&step](const peg::ast_node& child) {
+		if (hasVariables(child))
+		{
+			step.variableArguments = &child;
+			return;
+		}
 
-	peg::on_first_child<peg::arguments>(field, [this, &arguments](const peg::ast_node& child) {
-		ValueVisitor visitor(_variables);
+		static const response::Value s_noVariables(response::Type::Map);
+		ValueVisitor visitor(s_noVariables);
 
 		for (auto& argument : child.children)
 		{
 			visitor.visit(*argument->children.back());
 
-			arguments.emplace_back(argument->children.front()->string(), visitor.getValue());
+			step.arguments.emplace_back(argument->children.front()->string(), visitor.getValue());
 		}
 	});
 
-	const peg::ast_node* selection = nullptr;
-
-	peg::on_first_child<peg::selection_set>(field, [&selection](const peg::ast_node& child) {
-		selection = &child;
+	peg::on_first_child<peg::selection_set>(field, [&step](const peg::ast_node& child) {
+		step.selection = &child;
 	});
 
-	const SelectionSetParams selectionSetParams {
-		_resolverContext,
-		_state,
-		_operationDirectives,
-		_fragmentDefinitionDirectives,
-		_fragmentSpreadDirectives,
-		_inlineFragmentDirectives,
-		std::make_optional(field_path { _path, path_segment { alias } }),
-		_launch,
-	};
 	const auto position = field.begin();
 
-	try
-	{
-		auto result = itrResolver->second(ResolverParams(selectionSetParams,
-			field,
-			std::string(alias),
-			std::move(arguments),
-			directiveVisitor.getDirectives(),
-			selection,
-			_fragments,
-			_variables));
-		auto location = std::make_optional(schema_location { position.line, position.column });
-
-		_values.push_back({ alias, std::move(location), std::move(result) });
-	}
-	catch (schema_exception& scx)
-	{
-		std::promise<ResolverResult> promise;
-		auto messages = scx.getStructuredErrors();
-
-		for (auto& message : messages)
-		{
-			if (message.location.line == 0)
-			{
-				message.location = { position.line, position.column };
-			}
-
-			if (message.path.empty())
-			{
-				message.path = buildErrorPath(selectionSetParams.errorPath);
-			}
-		}
-
-		promise.set_exception(std::make_exception_ptr(schema_exception { std::move(messages) }));
-
-		_values.push_back({ alias, std::nullopt, promise.get_future() });
-	}
-	catch (const std::exception& ex)
-	{
-		std::promise<ResolverResult> promise;
-		std::ostringstream message;
-
-		message << "Field error name: " << alias << " unknown error: " << ex.what();
-
-		promise.set_exception(
-			std::make_exception_ptr(schema_exception { { schema_error { message.str(),
-				{ position.line, position.column },
-				buildErrorPath(selectionSetParams.errorPath) } } }));
-
-		_values.push_back({ alias, std::nullopt, promise.get_future() });
-	}
+	step.field = &field;
+	step.location = { position.line, position.column };
+	_plan.steps.push_back(std::move(step));
+	++_plan.fieldCount;
 }
 
-void SelectionVisitor::visitFragmentSpread(const peg::ast_node& fragmentSpread)
+void SelectionPlanCompiler::visitFragmentSpread(const peg::ast_node& fragmentSpread)
 {
 	const auto name = fragmentSpread.children.front()->string_view();
 	auto itr = _fragments.find(name);
@@ -1126,59 +1434,45 @@ void SelectionVisitor::visitFragmentSpread(const peg::ast_node& fragmentSpread)
 
 		error << "Unknown fragment name: " << name;
 
-		throw schema_exception { { schema_error { error.str(),
-			{ position.line, position.column },
-			buildErrorPath(_path ? std::make_optional(_path->get()) : std::nullopt) } } };
+		throw schema_exception {
+			{ schema_error { error.str(), { position.line, position.column } } }
+		};
 	}
 
-	bool skip = (_typeNames.find(itr->second.getType()) == _typeNames.end());
-	DirectiveVisitor directiveVisitor(_variables);
-
-	if (!skip)
+	if (_typeNames.find(itr->second.getType()) == _typeNames.end())
 	{
-		peg::on_first_child<peg::directives>(fragmentSpread,
-			[&directiveVisitor](const peg::ast_node& child) {
-				directiveVisitor.visit(child);
-			});
-
-		skip = directiveVisitor.shouldSkip();
+		return;
 	}
 
-	if (skip)
+	SelectionPlan::Step step;
+
+	if (compileDirectives(fragmentSpread, step))
 	{
 		return;
 	}
 
-	_fragmentDefinitionDirectives->push_front(itr->second.getDirectives());
-	_fragmentSpreadDirectives->push_front(directiveVisitor.getDirectives());
-
-	const size_t count = itr->second.getSelection().children.size();
+	const size_t begin = _plan.steps.size();
+	const auto position = fragmentSpread.begin();
 
-	if (count > 1)
-	{
-		_names.reserve(_names.capacity() + count - 1);
-		_values.reserve(_values.capacity() + count - 1);
-	}
+	step.type = SelectionPlan::StepType::BeginFragmentSpread;
+	step.name = name;
+	step.location = { position.line, position.column };
+	_plan.steps.push_back(std::move(step));
 
 	for (const auto& selection : itr->second.getSelection().children)
 	{
 		visit(*selection);
 	}
 
-	_fragmentSpreadDirectives->pop_front();
-	_fragmentDefinitionDirectives->pop_front();
+	_plan.steps.emplace_back().type = SelectionPlan::StepType::EndFragmentSpread;
+	_plan.steps[begin].end = _plan.steps.size();
 }
 
-void SelectionVisitor::visitInlineFragment(const peg::ast_node& inlineFragment)
+void SelectionPlanCompiler::visitInlineFragment(const peg::ast_node& inlineFragment)
 {
-	DirectiveVisitor directiveVisitor(_variables);
-
-	peg::on_first_child<peg::directives>(inlineFragment,
-		[&directiveVisitor](const peg::ast_node& child) {
-			directiveVisitor.visit(child);
-		});
+	SelectionPlan::Step step;
 
-	if (directiveVisitor.shouldSkip())
+	if (compileDirectives(inlineFragment, step))
 	{
 		return;
 	}
@@ -1190,1114 +1484,3113 @@ void SelectionVisitor::visitInlineFragment(const peg::ast_node& inlineFragment)
 			typeCondition = &child;
 		});
 
-	if (typeCondition == nullptr
-		|| _typeNames.find(typeCondition->children.front()->string_view()) != _typeNames.end())
+	if (typeCondition != nullptr
+		&& _typeNames.find(typeCondition->children.front()->string_view()) == _typeNames.end())
 	{
-		peg::on_first_child<peg::selection_set>(inlineFragment,
-			[this, &directiveVisitor](const peg::ast_node& child) {
-				_inlineFragmentDirectives->push_front(directiveVisitor.getDirectives());
-
-				const size_t count = child.children.size();
+		return;
+	}
 
-				if (count > 1)
-				{
-					_names.reserve(_names.capacity() + count - 1);
-					_values.reserve(_values.capacity() + count - 1);
-				}
+	peg::on_first_child<peg::selection_set>(inlineFragment,
+		[this, &step](const peg::ast_node& child) {
+			const size_t begin = _plan.steps.size();
 
-				for (const auto& selection : child.children)
-				{
-					visit(*selection);
-				}
+			step.type = SelectionPlan::StepType::BeginInlineFragment;
+			_plan.steps.push_back(std::move(step));
 
-				_inlineFragmentDirectives->pop_front();
-			});
-	}
-}
+			for (const auto& selection : child.children)
+			{
+				visit(*selection);
+			}
 
-Object::Object(TypeNames&& typeNames, ResolverMap&& resolvers) noexcept
-	: _typeNames(std::move(typeNames))
-	, _resolvers(std::move(resolvers))
-{
+			_plan.steps.emplace_back().type = SelectionPlan::StepType::EndInlineFragment;
+			_plan.steps[begin].end = _plan.steps.size();
+		});
 }
 
-AwaitableResolver Object::resolve(const SelectionSetParams& selectionSetParams,
-	const peg::ast_node& selection, const FragmentMap& fragments,
-	const response::Value& variables) const
+// ExecutionPlan caches the SelectionPlan for each selection set in a validated document and each
+// ResolverTable or set of TypeNames it has been resolved against. The plans do not depend on the
+// variables, so the same ExecutionPlan is shared by every request which resolves the same peg::ast.
+class ExecutionPlan
 {
-	SelectionVisitor visitor(selectionSetParams,
-		fragments,
-		variables,
-		_typeNames,
-		_resolvers,
-		selection.children.size());
+public:
+	std::shared_ptr<const SelectionPlan> getPlan(const peg::ast_node& selection,
+		const TypeNames& typeNames, const ResolverTable* resolverTable,
+		const FragmentMap& fragments);
 
-	beginSelectionSet(selectionSetParams);
+	// The response to an operation which only selects introspection fields depends on nothing but
+	// the schema, so the data is cached by operation along with the schema revision.
+	std::shared_ptr<const response::Value> findIntrospection(
+		const peg::ast_node& operationDefinition, size_t revision) const;
+	std::shared_ptr<const response::Value> addIntrospection(
+		const peg::ast_node& operationDefinition, size_t revision, response::Value data);
 
-	for (const auto& child : selection.children)
+private:
+	struct CachedPlan
 	{
-		visitor.visit(*child);
-	}
-
-	endSelectionSet(selectionSetParams);
+		// Each static ResolverTable belongs to a single type, so the TypeNames are only compared
+		// for objects with a ResolverMap.
+		const ResolverTable* resolverTable = nullptr;
+		std::vector<std::string> typeNames;
+		std::shared_ptr<const SelectionPlan> plan;
+	};
 
-	auto children = visitor.getValues();
-	const auto launch = selectionSetParams.launch;
-	ResolverResult document { response::Value { response::Type::Map } };
+	std::shared_ptr<const SelectionPlan> findPlan(const peg::ast_node& selection,
+		const TypeNames& typeNames, const ResolverTable* resolverTable) const;
 
-	document.data.reserve(children.size());
+	mutable std::shared_mutex _mutex;
+	std::unordered_map<const peg::ast_node*, std::vector<CachedPlan>> _plans;
+	std::unordered_map<const peg::ast_node*,
+		std::pair<size_t, std::shared_ptr<const response::Value>>>
+		_introspection;
+};
 
-	const auto parent = selectionSetParams.errorPath
-		? std::make_optional(std::cref(*selectionSetParams.errorPath))
-		: std::nullopt;
+std::shared_ptr<const SelectionPlan> compileSelectionPlan(const peg::ast_node& selection,
+	const TypeNames& typeNames, const ResolverTable* resolverTable, const FragmentMap& fragments,
+	bool internKeys = false)
+{
+	SelectionPlanCompiler compiler(fragments, typeNames, resolverTable, internKeys);
 
-	for (auto& child : children)
+	for (const auto& child : selection.children)
 	{
-		try
-		{
-			co_await launch;
-
-			auto value = co_await std::move(child.result);
+		compiler.visit(*child);
+	}
 
-			if (!document.data.emplace_back(std::string { child.name }, std::move(value.data)))
-			{
-				std::ostringstream message;
+	return std::make_shared<const SelectionPlan>(compiler.getPlan());
+}
 
-				message << "Ambiguous field error name: " << child.name;
+std::shared_ptr<const SelectionPlan> ExecutionPlan::findPlan(const peg::ast_node& selection,
+	const TypeNames& typeNames, const ResolverTable* resolverTable) const
+{
+	const auto itr = _plans.find(&selection);
 
-				field_path path { parent, path_segment { child.name } };
+	if (itr == _plans.end())
+	{
+		return nullptr;
+	}
 
-				document.errors.push_back({ message.str(),
-					child.location.value_or(schema_location {}),
-					buildErrorPath(std::make_optional(path)) });
-			}
+	const auto itrPlan = std::find_if(itr->second.cbegin(),
+		itr->second.cend(),
+		[&typeNames, resolverTable](const CachedPlan& cached) noexcept {
+			return cached.resolverTable == resolverTable
+				&& (resolverTable
+					|| std::equal(cached.typeNames.cbegin(),
+						cached.typeNames.cend(),
+						typeNames.begin(),
+						typeNames.end()));
+		});
 
-			if (!value.errors.empty())
-			{
-				document.errors.splice(document.errors.end(), value.errors);
-			}
-		}
-		catch (schema_exception& scx)
-		{
-			auto errors = scx.getStructuredErrors();
+	return (itrPlan == itr->second.cend()) ? nullptr : itrPlan->plan;
+}
 
-			if (!errors.empty())
-			{
-				std::copy(errors.begin(), errors.end(), std::back_inserter(document.errors));
-			}
+std::shared_ptr<const SelectionPlan> ExecutionPlan::getPlan(const peg::ast_node& selection,
+	const TypeNames& typeNames, const ResolverTable* resolverTable, const FragmentMap& fragments)
+{
+	{
+		std::shared_lock lock { _mutex };
 
-			document.data.emplace_back(std::string { child.name }, {});
-		}
-		catch (const std::exception& ex)
+		if (auto plan = findPlan(selection, typeNames, resolverTable))
 		{
-			std::ostringstream message;
-
-			message << "Field error name: " << child.name << " unknown error: " << ex.what();
+			return plan;
+		}
+	}
 
-			field_path path { parent, path_segment { child.name } };
+	// Compile the plan without holding the lock, if another thread got there first we'll keep the
+	// plan it added and discard this one.
+	auto plan = compileSelectionPlan(selection, typeNames, resolverTable, fragments, true);
+	std::unique_lock lock { _mutex };
 
-			document.errors.push_back({ message.str(),
-				child.location.value_or(schema_location {}),
-				buildErrorPath(std::make_optional(path)) });
-			document.data.emplace_back(std::string { child.name }, {});
-		}
+	if (auto existing = findPlan(selection, typeNames, resolverTable))
+	{
+		return existing;
 	}
 
-	co_return std::move(document);
-}
+	_plans[&selection].push_back({ resolverTable,
+		resolverTable ? std::vector<std::string> {}
+					  : std::vector<std::string> { typeNames.begin(), typeNames.end() },
+		plan });
 
-bool Object::matchesType(std::string_view typeName) const
-{
-	return _typeNames.find(typeName) != _typeNames.end();
+	return plan;
 }
 
-void Object::beginSelectionSet(const SelectionSetParams&) const
+std::shared_ptr<const response::Value> ExecutionPlan::findIntrospection(
+	const peg::ast_node& operationDefinition, size_t revision) const
 {
-	// This virtual method may be overridden in a sub-class.
-}
+	std::shared_lock lock { _mutex };
+	const auto itr = _introspection.find(&operationDefinition);
 
-void Object::endSelectionSet(const SelectionSetParams&) const
-{
-	// This virtual method may be overridden in a sub-class.
+	return (itr == _introspection.end() || itr->second.first != revision) ? nullptr
+																		   : itr->second.second;
 }
 
-OperationData::OperationData(std::shared_ptr<RequestState> state, response::Value variables,
-	Directives directives, FragmentMap fragments)
-	: state(std::move(state))
-	, variables(std::move(variables))
-	, directives(std::move(directives))
-	, fragments(std::move(fragments))
+std::shared_ptr<const response::Value> ExecutionPlan::addIntrospection(
+	const peg::ast_node& operationDefinition, size_t revision, response::Value data)
 {
+	auto cached = std::make_shared<const response::Value>(std::move(data));
+	std::unique_lock lock { _mutex };
+
+	_introspection[&operationDefinition] = { revision, cached };
+
+	return cached;
 }
 
-// FragmentDefinitionVisitor visits the AST and collects all of the fragment
-// definitions in the document.
-class FragmentDefinitionVisitor
+// A streamed field only ends once its nested selection sets have been written, so report the end
+// of the field when the ResolverStream is done instead of when it is returned.
+class InstrumentedStream final : public ResolverStream
 {
 public:
-	FragmentDefinitionVisitor(const response::Value& variables);
+	explicit InstrumentedStream(std::unique_ptr<ResolverStream> stream,
+		RequestInstrumentation& instrumentation, std::string_view typeName,
+		std::string_view fieldName, error_path&& path,
+		std::chrono::steady_clock::time_point start) noexcept;
 
-	FragmentMap getFragments();
-
-	void visit(const peg::ast_node& fragmentDefinition);
+	[[nodiscard("unnecessary call")]] internal::Awaitable<void> prepare() final;
+	[[nodiscard("unnecessary call")]] AwaitableErrors write(const response::Writer& writer) final;
 
 private:
-	const response::Value& _variables;
-
-	FragmentMap _fragments;
+	void endField() const;
+
+	const std::unique_ptr<ResolverStream> _stream;
+	RequestInstrumentation& _instrumentation;
+	const std::string_view _typeName;
+	const std::string_view _fieldName;
+	const error_path _path;
+	const std::chrono::steady_clock::time_point _start;
 };
 
-FragmentDefinitionVisitor::FragmentDefinitionVisitor(const response::Value& variables)
-	: _variables(variables)
+InstrumentedStream::InstrumentedStream(std::unique_ptr<ResolverStream> stream,
+	RequestInstrumentation& instrumentation, std::string_view typeName,
+	std::string_view fieldName, error_path&& path,
+	std::chrono::steady_clock::time_point start) noexcept
+	: _stream { std::move(stream) }
+	, _instrumentation { instrumentation }
+	, _typeName { typeName }
+	, _fieldName { fieldName }
+	, _path { std::move(path) }
+	, _start { start }
 {
 }
 
-FragmentMap FragmentDefinitionVisitor::getFragments()
+internal::Awaitable<void> InstrumentedStream::prepare()
 {
-	FragmentMap result(std::move(_fragments));
-	return result;
+	try
+	{
+		co_await _stream->prepare();
+	}
+	catch (...)
+	{
+		endField();
+		throw;
+	}
 }
 
-void FragmentDefinitionVisitor::visit(const peg::ast_node& fragmentDefinition)
+AwaitableErrors InstrumentedStream::write(const response::Writer& writer)
 {
-	_fragments.emplace(fragmentDefinition.children.front()->string_view(),
-		Fragment(fragmentDefinition, _variables));
+	auto errors = co_await _stream->write(writer);
+
+	endField();
+
+	co_return std::move(errors);
 }
 
-// OperationDefinitionVisitor visits the AST and executes the one with the specified
-// operation name.
-class OperationDefinitionVisitor
+void InstrumentedStream::endField() const
 {
-public:
-	OperationDefinitionVisitor(ResolverContext resolverContext, await_async launch,
-		std::shared_ptr<RequestState> state, const TypeMap& operations, response::Value&& variables,
-		FragmentMap&& fragments);
-
-	AwaitableResolver getValue();
+	_instrumentation.endField(_typeName,
+		_fieldName,
+		_path,
+		std::chrono::steady_clock::now() - _start);
+}
 
-	void visit(std::string_view operationType, const peg::ast_node& operationDefinition);
+// Report the end of a field which has resolved, or pass the report along with its ResolverStream.
+ResolverResult endInstrumentedField(ResolverResult value, RequestInstrumentation& instrumentation,
+	std::string_view typeName, std::string_view fieldName, error_path&& path,
+	std::chrono::steady_clock::time_point start)
+{
+	if (value.stream)
+	{
+		value.stream = std::make_unique<InstrumentedStream>(std::move(value.stream),
+			instrumentation,
+			typeName,
+			fieldName,
+			std::move(path),
+			start);
+	}
+	else
+	{
+		instrumentation.endField(typeName,
+			fieldName,
+			path,
+			std::chrono::steady_clock::now() - start);
+	}
 
-private:
-	const ResolverContext _resolverContext;
-	const await_async _launch;
-	std::shared_ptr<OperationData> _params;
-	const TypeMap& _operations;
-	std::optional<AwaitableResolver> _result;
-};
+	return value;
+}
 
-OperationDefinitionVisitor::OperationDefinitionVisitor(ResolverContext resolverContext,
-	await_async launch, std::shared_ptr<RequestState> state, const TypeMap& operations,
-	response::Value&& variables, FragmentMap&& fragments)
-	: _resolverContext(resolverContext)
-	, _launch(launch)
-	, _params(std::make_shared<OperationData>(
-		  std::move(state), std::move(variables), Directives {}, std::move(fragments)))
-	, _operations(operations)
+AwaitableResolver awaitInstrumentedField(AwaitableResolver result,
+	RequestInstrumentation& instrumentation, std::string_view typeName,
+	std::string_view fieldName, error_path path, std::chrono::steady_clock::time_point start)
 {
+	try
+	{
+		auto value = co_await std::move(result);
+
+		co_return endInstrumentedField(std::move(value),
+			instrumentation,
+			typeName,
+			fieldName,
+			std::move(path),
+			start);
+	}
+	catch (...)
+	{
+		instrumentation.endField(typeName,
+			fieldName,
+			path,
+			std::chrono::steady_clock::now() - start);
+
+		throw;
+	}
 }
 
-AwaitableResolver OperationDefinitionVisitor::getValue()
+// Report the end of a field to the RequestInstrumentation once its result is ready. Most fields
+// are already complete, so this only adds a coroutine frame for the ones which are still pending.
+AwaitableResolver instrumentField(AwaitableResolver result,
+	RequestInstrumentation& instrumentation, std::string_view typeName,
+	std::string_view fieldName, error_path&& path, std::chrono::steady_clock::time_point start)
 {
-	if (!_result)
+	if (!result.await_ready())
 	{
-		co_return ResolverResult {};
+		return awaitInstrumentedField(std::move(result),
+			instrumentation,
+			typeName,
+			fieldName,
+			std::move(path),
+			start);
 	}
 
-	auto result = std::move(*_result);
+	ResolverResult value;
 
-	co_await _launch;
-	co_return co_await result;
+	try
+	{
+		value = result.await_resume();
+	}
+	catch (...)
+	{
+		instrumentation.endField(typeName,
+			fieldName,
+			path,
+			std::chrono::steady_clock::now() - start);
+
+		return std::current_exception();
+	}
+
+	return endInstrumentedField(std::move(value),
+		instrumentation,
+		typeName,
+		fieldName,
+		std::move(path),
+		start);
 }
 
-void OperationDefinitionVisitor::visit(
-	std::string_view operationType, const peg::ast_node& operationDefinition)
+// SelectionExecutor executes a SelectionPlan and resolves each field, unless it's skipped by a
+// directive which references a variable.
+class SelectionExecutor
 {
-	auto itr = _operations.find(operationType);
+public:
+	explicit SelectionExecutor(const SelectionSetParams& selectionSetParams,
+		const FragmentMap& fragments, const response::Value& variables,
+		const ResolverMap& resolvers, const ResolverTable* resolverTable,
+		const Object* resolverObject, std::string_view typeName, size_t count);
+
+	void execute(const SelectionPlan& plan);
+
+	struct ExecutorValue
+	{
+		std::string_view name;
+		const response::MapKey* key;
+		std::optional<schema_location> location;
+		AwaitableResolver result;
+	};
+
+	std::pmr::vector<ExecutorValue> getValues();
+
+private:
+	std::optional<Directives> getDirectives(const SelectionPlan::Step& step) const;
+
+	void executeField(const SelectionPlan::Step& field);
+
+	const ResolverContext _resolverContext;
+	const std::shared_ptr<RequestState>& _state;
+	const Directives& _operationDirectives;
+	const std::optional<std::reference_wrapper<const field_path>> _path;
+	const await_async _launch;
+	ExecutionPlan* const _plan;
+	const RequestCancellation* const _cancellation;
+	RequestInstrumentation* const _instrumentation;
+	const size_t _listGrainSize;
+	std::pmr::memory_resource* const _memoryResource;
+	const FragmentMap& _fragments;
+	const response::Value& _variables;
+	const ResolverMap& _resolvers;
+	const ResolverTable* const _resolverTable;
+	const Object* const _resolverObject;
+	const std::string_view _typeName;
+
+	FragmentDefinitionDirectiveStack _fragmentDefinitionDirectives;
+	FragmentSpreadDirectiveStack _fragmentSpreadDirectives;
+	FragmentSpreadDirectiveStack _inlineFragmentDirectives;
+	internal::string_view_set _names;
+	std::pmr::vector<ExecutorValue> _values;
+};
+
+SelectionExecutor::SelectionExecutor(const SelectionSetParams& selectionSetParams,
+	const FragmentMap& fragments, const response::Value& variables, const ResolverMap& resolvers,
+	const ResolverTable* resolverTable, const Object* resolverObject, std::string_view typeName,
+	size_t count)
+	: _resolverContext(selectionSetParams.resolverContext)
+	, _state(selectionSetParams.state)
+	, _operationDirectives(selectionSetParams.operationDirectives)
+	, _path(selectionSetParams.errorPath
+			  ? std::make_optional(std::cref(*selectionSetParams.errorPath))
+			  : std::nullopt)
+	, _launch(selectionSetParams.launch)
+	, _plan(selectionSetParams.plan)
+	, _cancellation(selectionSetParams.cancellation)
+	, _instrumentation(selectionSetParams.instrumentation)
+	, _listGrainSize(selectionSetParams.listGrainSize)
+	, _memoryResource(selectionSetParams.memoryResource)
+	, _fragments(fragments)
+	, _variables(variables)
+	, _resolvers(resolvers)
+	, _resolverTable(resolverTable)
+	, _resolverObject(resolverObject)
+	, _typeName(typeName)
+	, _fragmentDefinitionDirectives { selectionSetParams.fragmentDefinitionDirectives }
+	, _fragmentSpreadDirectives { selectionSetParams.fragmentSpreadDirectives }
+	, _inlineFragmentDirectives { selectionSetParams.inlineFragmentDirectives }
+	, _values { selectionSetParams.getMemoryResource() }
+{
+	static const Directives s_emptyFragmentDefinitionDirectives;
+
+	// Traversing a SelectionSet from an Object type field should start tracking new fragment
+	// directives. The outer fragment directives are still there in the FragmentSpreadDirectiveStack
+	// if the field accessors want to inspect them.
+	_fragmentDefinitionDirectives.push_front(std::cref(s_emptyFragmentDefinitionDirectives));
+	_fragmentSpreadDirectives.push_front({});
+	_inlineFragmentDirectives.push_front({});
+
+	_names.reserve(count);
+	_values.reserve(count);
+}
+
+std::pmr::vector<SelectionExecutor::ExecutorValue> SelectionExecutor::getValues()
+{
+	auto values = std::move(_values);
+
+	return values;
+}
+
+void SelectionExecutor::execute(const SelectionPlan& plan)
+{
+	const auto& steps = plan.steps;
+
+	for (size_t i = 0; i < steps.size();)
+	{
+		const auto& step = steps[i];
+
+		switch (step.type)
+		{
+			case SelectionPlan::StepType::Field:
+				executeField(step);
+				++i;
+				break;
+
+			case SelectionPlan::StepType::BeginFragmentSpread:
+			{
+				auto itr = _fragments.find(step.name);
+
+				if (itr == _fragments.end())
+				{
+					std::ostringstream error;
+
+					error << "Unknown fragment name: " << step.name;
+
+					throw schema_exception { { schema_error { error.str(),
+						step.location,
+						buildErrorPath(_path ? std::make_optional(_path->get())
+											 : std::nullopt) } } };
+				}
+
+				auto directives = getDirectives(step);
+
+				if (!directives)
+				{
+					i = step.end;
+					break;
+				}
+
+				_fragmentDefinitionDirectives.push_front(itr->second.getDirectives());
+				_fragmentSpreadDirectives.push_front(std::move(*directives));
+				++i;
+				break;
+			}
+
+			case SelectionPlan::StepType::EndFragmentSpread:
+				_fragmentSpreadDirectives.pop_front();
+				_fragmentDefinitionDirectives.pop_front();
+				++i;
+				break;
+
+			case SelectionPlan::StepType::BeginInlineFragment:
+			{
+				auto directives = getDirectives(step);
+
+				if (!directives)
+				{
+					i = step.end;
+					break;
+				}
+
+				_inlineFragmentDirectives.push_front(std::move(*directives));
+				++i;
+				break;
+			}
+
+			case SelectionPlan::StepType::EndInlineFragment:
+				_inlineFragmentDirectives.pop_front();
+				++i;
+				break;
+		}
+	}
+}
+
+// Returns std::nullopt if the directives reference a variable which skips this step.
+std::optional<Directives> SelectionExecutor::getDirectives(const SelectionPlan::Step& step) const
+{
+	if (!step.variableDirectives)
+	{
+		return std::make_optional(step.directives);
+	}
+
+	DirectiveVisitor directiveVisitor(_variables);
+
+	directiveVisitor.visit(*step.variableDirectives);
+
+	if (directiveVisitor.shouldSkip())
+	{
+		return std::nullopt;
+	}
+
+	return std::make_optional(directiveVisitor.getDirectives());
+}
+
+void SelectionExecutor::executeField(const SelectionPlan::Step& field)
+{
+	auto directives = getDirectives(field);
+
+	if (!directives)
+	{
+		return;
+	}
+
+	const auto alias = field.alias;
+
+	if (!_names.emplace(alias).second)
+	{
+		// Skip resolving fields which map to the same response name as a field we've already
+		// resolved. Validation should handle merging multiple references to the same field or
+		// to compatible fields.
+		return;
+	}
+
+	// Generated objects dispatch by the field id, anything else looks up the field name.
+	const auto itrResolver = _resolverTable ? _resolvers.end() : _resolvers.find(field.name);
+
+	if (_resolverTable ? field.fieldId >= _resolverTable->size() : itrResolver == _resolvers.end())
+	{
+		std::ostringstream error;
+
+		error << "Unknown field name: " << field.name;
+
+		_values.push_back({ alias,
+			&field.key,
+			std::nullopt,
+			std::make_exception_ptr(schema_exception { { schema_error { error.str(),
+				field.location,
+				buildErrorPath(_path ? std::make_optional(_path->get()) : std::nullopt) } } }) });
+		return;
+	}
+
+	response::Value arguments(response::Type::Map);
+
+	if (field.variableArguments)
+	{
+		ValueVisitor visitor(_variables);
+
+		for (auto& argument : field.variableArguments->children)
+		{
+			visitor.visit(*argument->children.back());
+
+			arguments.emplace_back(argument->children.front()->string(), visitor.getValue());
+		}
+	}
+	else if (field.arguments.size() > 0)
+	{
+		arguments = response::Value { field.arguments };
+	}
+
+	const SelectionSetParams selectionSetParams {
+		_resolverContext,
+		_state,
+		_operationDirectives,
+		_fragmentDefinitionDirectives,
+		_fragmentSpreadDirectives,
+		_inlineFragmentDirectives,
+		std::make_optional(field_path { _path, path_segment { alias } }),
+		_launch,
+		_plan,
+		_cancellation,
+		_instrumentation,
+		_listGrainSize,
+		_memoryResource,
+	};
+
+	if (_cancellation && _cancellation->stopRequested())
+	{
+		// Skip the rest of the fields once the request is cancelled.
+		_values.push_back({ alias,
+			&field.key,
+			std::nullopt,
+			std::make_exception_ptr(schema_exception { { _cancellation->getError(field.location,
+				buildErrorPath(selectionSetParams.errorPath)) } }) });
+		return;
+	}
+
+	error_path instrumentedPath;
+	std::chrono::steady_clock::time_point start;
+
+	if (_instrumentation)
+	{
+		instrumentedPath = buildErrorPath(selectionSetParams.errorPath);
+		_instrumentation->beginField(_typeName, field.name, instrumentedPath);
+		start = std::chrono::steady_clock::now();
+	}
+
+	try
+	{
+		ResolverParams params(selectionSetParams,
+			*field.field,
+			std::string(alias),
+			std::move(arguments),
+			std::move(*directives),
+			field.selection,
+			_fragments,
+			_variables);
+		auto result = _resolverTable
+			? (_resolverTable->begin() + field.fieldId)->second(*_resolverObject, std::move(params))
+			: itrResolver->second(std::move(params));
+
+		_values.push_back(
+			{ alias, &field.key, std::make_optional(field.location), std::move(result) });
+	}
+	catch (schema_exception& scx)
+	{
+		auto messages = scx.getStructuredErrors();
+
+		for (auto& message : messages)
+		{
+			if (message.location.line == 0)
+			{
+				message.location = field.location;
+			}
+
+			if (message.path.empty())
+			{
+				message.path = buildErrorPath(selectionSetParams.errorPath);
+			}
+		}
+
+		_values.push_back({ alias,
+			&field.key,
+			std::nullopt,
+			std::make_exception_ptr(schema_exception { std::move(messages) }) });
+	}
+	catch (const std::exception& ex)
+	{
+		std::ostringstream message;
+
+		message << "Field error name: " << alias << " unknown error: " << ex.what();
+
+		_values.push_back({ alias,
+			&field.key,
+			std::nullopt,
+			std::make_exception_ptr(schema_exception { { schema_error { message.str(),
+				field.location,
+				buildErrorPath(selectionSetParams.errorPath) } } }) });
+	}
+
+	if (_instrumentation)
+	{
+		auto& result = _values.back().result;
+
+		result = instrumentField(std::move(result),
+			*_instrumentation,
+			_typeName,
+			field.name,
+			std::move(instrumentedPath),
+			start);
+	}
+}
+
+Object::Object(TypeNames&& typeNames, ResolverMap&& resolvers) noexcept
+	: _ownedTypeNames(std::move(typeNames))
+	, _resolvers(std::move(resolvers))
+	, _typeNames(_ownedTypeNames)
+{
+}
+
+Object::Object(const TypeNames& typeNames, const ResolverTable& resolvers,
+	const Object* resolverObject) noexcept
+	: _typeNames(typeNames)
+	, _resolverTable(&resolvers)
+	, _resolverObject(resolverObject ? resolverObject : this)
+	, _typeName(resolverObject ? resolverObject->_typeName : std::string_view {})
+{
+}
+
+Object::Object(
+	const TypeNames& typeNames, const ResolverTable& resolvers, std::string_view typeName) noexcept
+	: _typeNames(typeNames)
+	, _resolverTable(&resolvers)
+	, _resolverObject(this)
+	, _typeName(typeName)
+{
+}
+
+// The fields of a selection set which Object::resolve has started, in document order. The response
+// keys belong to the plan, so it needs to outlive the fields.
+struct SelectionFields
+{
+	std::shared_ptr<const SelectionPlan> plan;
+	std::pmr::vector<SelectionExecutor::ExecutorValue> values;
+};
+
+SelectionFields Object::startFields(const SelectionSetParams& selectionSetParams,
+	const peg::ast_node& selection, const FragmentMap& fragments,
+	const response::Value& variables) const
+{
+	auto plan = selectionSetParams.plan
+		? selectionSetParams.plan->getPlan(selection, _typeNames, _resolverTable, fragments)
+		: compileSelectionPlan(selection, _typeNames, _resolverTable, fragments);
+	SelectionExecutor executor(selectionSetParams,
+		fragments,
+		variables,
+		_resolvers,
+		_resolverTable,
+		_resolverObject,
+		_typeName,
+		plan->fieldCount);
+
+	beginSelectionSet(selectionSetParams);
+
+	{
+		// Start all of the fields before any of the DataLoader keys they request are dispatched.
+		DataLoaderBatch batch { selectionSetParams.state.get() };
+
+		executor.execute(*plan);
+	}
+
+	endSelectionSet(selectionSetParams);
+
+	return { std::move(plan), executor.getValues() };
+}
+
+// Add the errors for a field which threw an exception instead of resolving. Anything which is not
+// a std::exception is rethrown.
+void addFieldError(std::list<schema_error>& errors, const SelectionExecutor::ExecutorValue& child,
+	const std::optional<std::reference_wrapper<const field_path>>& parent,
+	std::exception_ptr exception)
+{
+	try
+	{
+		std::rethrow_exception(exception);
+	}
+	catch (schema_exception& scx)
+	{
+		auto messages = scx.getStructuredErrors();
+
+		if (!messages.empty())
+		{
+			std::copy(messages.begin(), messages.end(), std::back_inserter(errors));
+		}
+	}
+	catch (const std::exception& ex)
+	{
+		std::ostringstream message;
+
+		message << "Field error name: " << child.name << " unknown error: " << ex.what();
+
+		field_path path { parent, path_segment { child.name } };
+
+		errors.push_back({ message.str(),
+			child.location.value_or(schema_location {}),
+			buildErrorPath(std::make_optional(path)) });
+	}
+}
+
+void addAmbiguousFieldError(std::list<schema_error>& errors,
+	const SelectionExecutor::ExecutorValue& child,
+	const std::optional<std::reference_wrapper<const field_path>>& parent)
+{
+	std::ostringstream message;
+
+	message << "Ambiguous field error name: " << child.name;
+
+	field_path path { parent, path_segment { child.name } };
+
+	errors.push_back({ message.str(),
+		child.location.value_or(schema_location {}),
+		buildErrorPath(std::make_optional(path)) });
+}
+
+AwaitableResolver Object::resolve(const SelectionSetParams& selectionSetParams,
+	const peg::ast_node& selection, const FragmentMap& fragments,
+	const response::Value& variables) const
+{
+	auto fields = startFields(selectionSetParams, selection, fragments, variables);
+	const auto launch = selectionSetParams.launch;
+	ResolverResult document { response::Value { response::Type::Map } };
+
+	document.data.reserve(fields.values.size());
+
+	const auto parent = selectionSetParams.errorPath
+		? std::make_optional(std::cref(*selectionSetParams.errorPath))
+		: std::nullopt;
+
+	for (auto& child : fields.values)
+	{
+		try
+		{
+			// Only hop to the launch policy if the field still has work left to do.
+			if (!child.result.await_ready())
+			{
+				co_await launch;
+			}
+
+			auto value = co_await std::move(child.result);
+
+			if (!document.data.emplace_back(response::MapKey { *child.key }, std::move(value.data)))
+			{
+				addAmbiguousFieldError(document.errors, child, parent);
+			}
+
+			if (!value.errors.empty())
+			{
+				document.errors.splice(document.errors.end(), value.errors);
+			}
+		}
+		catch (...)
+		{
+			addFieldError(document.errors, child, parent, std::current_exception());
+			document.data.emplace_back(response::MapKey { *child.key }, {});
+		}
+	}
+
+	co_return std::move(document);
+}
+
+// Ignore everything which is written, so discardStream can finish a ResolverStream without
+// building any output.
+class DiscardWriter
+{
+public:
+	void start_object() const noexcept
+	{
+	}
+
+	void add_member(const std::string&) const noexcept
+	{
+	}
+
+	void end_object() const noexcept
+	{
+	}
+
+	void start_array() const noexcept
+	{
+	}
+
+	void end_arrary() const noexcept
+	{
+	}
+
+	void write_null() const noexcept
+	{
+	}
+
+	void write_string(const std::string&) const noexcept
+	{
+	}
+
+	void write_bool(bool) const noexcept
+	{
+	}
+
+	void write_int(int) const noexcept
+	{
+	}
+
+	void write_float(double) const noexcept
+	{
+	}
+};
+
+AwaitableErrors discardStream(std::unique_ptr<ResolverStream> stream)
+{
+	static const response::Writer writer { std::make_unique<DiscardWriter>() };
+	std::list<schema_error> errors;
+
+	try
+	{
+		co_await stream->prepare();
+		errors = co_await stream->write(writer);
+	}
+	catch (schema_exception& scx)
+	{
+		errors = scx.getStructuredErrors();
+	}
+
+	co_return std::move(errors);
+}
+
+// The fields of a streamed selection set, which write themselves in document order. The
+// SelectionSetParams are copied, since the error paths of the fields refer to them.
+class ObjectStream final : public ResolverStream
+{
+public:
+	explicit ObjectStream(
+		std::shared_ptr<const Object> object, const SelectionSetParams& selectionSetParams);
+
+	[[nodiscard("unnecessary call")]] const SelectionSetParams& getParams() const noexcept;
+	void start(SelectionFields&& fields);
+
+	// The fields of an object which has been started are null if they fail, but the object is not.
+	[[nodiscard("unnecessary call")]] internal::Awaitable<void> prepare() final;
+	[[nodiscard("unnecessary call")]] AwaitableErrors write(const response::Writer& writer) final;
+
+private:
+	const std::shared_ptr<const Object> _object;
+	SelectionSetParams _params;
+	std::optional<SelectionFields> _fields;
+};
+
+ObjectStream::ObjectStream(
+	std::shared_ptr<const Object> object, const SelectionSetParams& selectionSetParams)
+	: _object { std::move(object) }
+	, _params { selectionSetParams }
+{
+	_params.streamed = true;
+}
+
+const SelectionSetParams& ObjectStream::getParams() const noexcept
+{
+	return _params;
+}
+
+void ObjectStream::start(SelectionFields&& fields)
+{
+	_fields.emplace(std::move(fields));
+}
+
+internal::Awaitable<void> ObjectStream::prepare()
+{
+	return {};
+}
+
+AwaitableErrors ObjectStream::write(const response::Writer& writer)
+{
+	const auto launch = _params.launch;
+	std::list<schema_error> errors;
+	internal::string_view_set names;
+
+	const auto parent =
+		_params.errorPath ? std::make_optional(std::cref(*_params.errorPath)) : std::nullopt;
+
+	writer.start_object();
+
+	for (auto& child : _fields->values)
+	{
+		ResolverResult value;
+		bool resolved = false;
+
+		try
+		{
+			// Only hop to the launch policy if the field still has work left to do.
+			if (!child.result.await_ready())
+			{
+				co_await launch;
+			}
+
+			value = co_await std::move(child.result);
+			errors.splice(errors.end(), value.errors);
+
+			// A nested list which turns out to be null is an error for this field.
+			if (value.stream)
+			{
+				co_await value.stream->prepare();
+			}
+
+			resolved = true;
+		}
+		catch (...)
+		{
+			addFieldError(errors, child, parent, std::current_exception());
+			value = {};
+		}
+
+		if (!names.emplace(child.name).second)
+		{
+			if (resolved)
+			{
+				addAmbiguousFieldError(errors, child, parent);
+			}
+
+			if (value.stream)
+			{
+				auto streamErrors = co_await discardStream(std::move(value.stream));
+
+				errors.splice(errors.end(), streamErrors);
+			}
+
+			continue;
+		}
+
+		// Release each field as soon as it's written, only the errors need to outlive the loop.
+		writer.add_member(*child.key);
+
+		if (value.stream)
+		{
+			auto streamErrors = co_await value.stream->write(writer);
+
+			errors.splice(errors.end(), streamErrors);
+		}
+		else
+		{
+			writer.write(std::move(value.data));
+		}
+	}
+
+	writer.end_object();
+
+	co_return std::move(errors);
+}
+
+AwaitableErrors Object::resolve(const SelectionSetParams& selectionSetParams,
+	const peg::ast_node& selection, const FragmentMap& fragments,
+	const response::Value& variables, const response::Writer& writer) const
+{
+	const auto fields = stream(selectionSetParams, selection, fragments, variables);
+
+	co_await fields->prepare();
+
+	co_return co_await fields->write(writer);
+}
+
+std::unique_ptr<ResolverStream> Object::stream(const SelectionSetParams& selectionSetParams,
+	const peg::ast_node& selection, const FragmentMap& fragments,
+	const response::Value& variables) const
+{
+	auto result = std::make_unique<ObjectStream>(weak_from_this().lock(), selectionSetParams);
+
+	// The fields refer to the params in the stream, so they can only start once it's allocated.
+	result->start(startFields(result->getParams(), selection, fragments, variables));
+
+	return result;
+}
+
+bool Object::matchesType(std::string_view typeName) const
+{
+	return _typeNames.find(typeName) != _typeNames.end();
+}
+
+std::string_view Object::getTypeName() const noexcept
+{
+	return _typeName;
+}
+
+void Object::beginSelectionSet(const SelectionSetParams&) const
+{
+	// This virtual method may be overridden in a sub-class.
+}
+
+void Object::endSelectionSet(const SelectionSetParams&) const
+{
+	// This virtual method may be overridden in a sub-class.
+}
+
+OperationData::OperationData(std::shared_ptr<RequestState> state, response::Value variables,
+	Directives directives, std::shared_ptr<const FragmentMap> fragments)
+	: state(std::move(state))
+	, variables(std::move(variables))
+	, directives(std::move(directives))
+	, fragments(std::move(fragments))
+{
+}
+
+// FragmentDefinitionVisitor visits the AST and collects all of the fragment
+// definitions in the document.
+class FragmentDefinitionVisitor
+{
+public:
+	FragmentDefinitionVisitor(const response::Value& variables);
+
+	FragmentMap getFragments();
+
+	void visit(const peg::ast_node& fragmentDefinition);
+
+private:
+	const response::Value& _variables;
+
+	FragmentMap _fragments;
+};
+
+FragmentDefinitionVisitor::FragmentDefinitionVisitor(const response::Value& variables)
+	: _variables(variables)
+{
+}
+
+FragmentMap FragmentDefinitionVisitor::getFragments()
+{
+	FragmentMap result(std::move(_fragments));
+	return result;
+}
+
+void FragmentDefinitionVisitor::visit(const peg::ast_node& fragmentDefinition)
+{
+	_fragments.emplace(fragmentDefinition.children.front()->string_view(),
+		Fragment(fragmentDefinition, _variables));
+}
+
+// OperationDefinitionVisitor visits the AST and executes the one with the specified
+// operation name.
+class OperationDefinitionVisitor
+{
+public:
+	OperationDefinitionVisitor(ResolverContext resolverContext, await_async launch,
+		std::shared_ptr<RequestState> state, const TypeMap& operations, response::Value&& variables,
+		std::shared_ptr<const FragmentMap> fragments, std::shared_ptr<ExecutionPlan> plan,
+		RequestCancellation&& cancellation, std::shared_ptr<RequestInstrumentation> instrumentation,
+		size_t listGrainSize, std::pmr::memory_resource* memoryResource);
+
+	AwaitableResolver getValue();
+	AwaitableErrors getValue(const response::Writer& writer);
+
+	void visit(std::string_view operationType, const peg::ast_node& operationDefinition);
+
+private:
+	const ResolverContext _resolverContext;
+	const await_async _launch;
+	std::shared_ptr<OperationData> _params;
+	const TypeMap& _operations;
+	const std::shared_ptr<ExecutionPlan> _plan;
+	const RequestCancellation _cancellation;
+	const std::shared_ptr<RequestInstrumentation> _instrumentation;
+	const size_t _listGrainSize;
+	std::pmr::memory_resource* const _memoryResource;
+	std::shared_ptr<const Object> _operationObject;
+	const peg::ast_node* _selection = nullptr;
+	std::optional<SelectionSetParams> _selectionSetParams;
+};
+
+OperationDefinitionVisitor::OperationDefinitionVisitor(ResolverContext resolverContext,
+	await_async launch, std::shared_ptr<RequestState> state, const TypeMap& operations,
+	response::Value&& variables, std::shared_ptr<const FragmentMap> fragments,
+	std::shared_ptr<ExecutionPlan> plan, RequestCancellation&& cancellation,
+	std::shared_ptr<RequestInstrumentation> instrumentation, size_t listGrainSize,
+	std::pmr::memory_resource* memoryResource)
+	: _resolverContext(resolverContext)
+	, _launch(launch)
+	, _params(std::make_shared<OperationData>(
+		  std::move(state), std::move(variables), Directives {}, std::move(fragments)))
+	, _operations(operations)
+	, _plan(std::move(plan))
+	, _cancellation(std::move(cancellation))
+	, _instrumentation(std::move(instrumentation))
+	, _listGrainSize(listGrainSize)
+	, _memoryResource(memoryResource)
+{
+}
+
+AwaitableResolver OperationDefinitionVisitor::getValue()
+{
+	if (!_selectionSetParams)
+	{
+		co_return ResolverResult {};
+	}
+
+	auto result = _operationObject->resolve(*_selectionSetParams,
+		*_selection,
+		*_params->fragments,
+		_params->variables);
+
+	co_await _launch;
+	co_return co_await result;
+}
+
+AwaitableErrors OperationDefinitionVisitor::getValue(const response::Writer& writer)
+{
+	if (!_selectionSetParams)
+	{
+		writer.write(response::Value {});
+		co_return std::list<schema_error> {};
+	}
+
+	auto errors = _operationObject->resolve(*_selectionSetParams,
+		*_selection,
+		*_params->fragments,
+		_params->variables,
+		writer);
+
+	co_await _launch;
+	co_return co_await errors;
+}
+
+void OperationDefinitionVisitor::visit(
+	std::string_view operationType, const peg::ast_node& operationDefinition)
+{
+	auto itr = _operations.find(operationType);
 
 	// Filter the variable definitions down to the ones referenced in this operation
 	response::Value operationVariables(response::Type::Map);
 
-	peg::for_each_child<peg::variable>(operationDefinition,
-		[this, &operationVariables](const peg::ast_node& variable) {
-			std::string variableName;
+	peg::for_each_child<peg::variable>(operationDefinition,
+		[this, &operationVariables](const peg::ast_node& variable) {
+			std::string variableName;
+
+			peg::on_first_child<peg::variable_name>(variable,
+				[&variableName](const peg::ast_node& name) {
+					// Skip the $ prefix
+					variableName = name.string_view().substr(1);
+				});
+
+			auto itrVar = _params->variables.find(variableName);
+			response::Value valueVar;
+
+			if (itrVar != _params->variables.get<response::MapType>().cend())
+			{
+				valueVar = response::Value(itrVar->second);
+			}
+			else
+			{
+				peg::on_first_child<peg::default_value>(variable,
+					[this, &valueVar](const peg::ast_node& defaultValue) {
+						ValueVisitor visitor(_params->variables);
+
+						visitor.visit(*defaultValue.children.front());
+						valueVar = visitor.getValue();
+					});
+			}
+
+			operationVariables.emplace_back(std::move(variableName), std::move(valueVar));
+		});
+
+	_params->variables = std::move(operationVariables);
+
+	Directives operationDirectives;
+
+	peg::on_first_child<peg::directives>(operationDefinition,
+		[this, &operationDirectives](const peg::ast_node& child) {
+			DirectiveVisitor directiveVisitor(_params->variables);
+
+			directiveVisitor.visit(child);
+			operationDirectives = directiveVisitor.getDirectives();
+		});
+
+	_params->directives = std::move(operationDirectives);
+
+	// The operation is resolved in getValue, either to a response::Value or a response::Writer.
+	_operationObject = itr->second;
+	_selection = operationDefinition.children.back().get();
+	_selectionSetParams.emplace(SelectionSetParams {
+		_resolverContext,
+		_params->state,
+		_params->directives,
+		{},
+		{},
+		{},
+		std::nullopt,
+		_launch,
+		_plan.get(),
+		&_cancellation,
+		_instrumentation.get(),
+		_listGrainSize,
+		_memoryResource,
+	});
+}
+
+// Subscriptions which share the same document, operation name, variables, field arguments and
+// directives, and RequestState will resolve to the same payload for a single event.
+size_t hashSubscription(const SubscriptionData& registration) noexcept
+{
+	size_t seed = std::hash<const void*> {}(registration.data->state.get());
+	const auto combine = [&seed](size_t hash) noexcept {
+		seed ^= hash + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+	};
+
+	combine(std::hash<std::string_view> {}(registration.operationName));
+
+	for (const auto& definition : registration.query.root->children)
+	{
+		combine(std::hash<std::string_view> {}(definition->string_view()));
+	}
+
+	return seed;
+}
+
+SubscriptionData::SubscriptionData(std::shared_ptr<OperationData> data, SubscriptionName&& field,
+	response::Value arguments, Directives fieldDirectives, peg::ast&& query,
+	std::string&& operationName, SubscriptionCallback&& callback, const peg::ast_node& selection)
+	: data(std::move(data))
+	, field(std::move(field))
+	, arguments(std::move(arguments))
+	, fieldDirectives(std::move(fieldDirectives))
+	, query(std::move(query))
+	, operationName(std::move(operationName))
+	, callback(std::move(callback))
+	, selection(selection)
+	, hash(hashSubscription(*this))
+{
+}
+
+// SubscriptionDefinitionVisitor visits the AST collects the fields referenced in the
+// subscription at the point where we create a subscription.
+class SubscriptionDefinitionVisitor
+{
+public:
+	SubscriptionDefinitionVisitor(RequestSubscribeParams&& params, FragmentMap&& fragments,
+		const std::shared_ptr<const Object>& subscriptionObject);
+
+	const peg::ast_node& getRoot() const;
+	std::shared_ptr<SubscriptionData> getRegistration();
+
+	void visit(const peg::ast_node& operationDefinition);
+
+private:
+	void visitField(const peg::ast_node& field);
+	void visitFragmentSpread(const peg::ast_node& fragmentSpread);
+	void visitInlineFragment(const peg::ast_node& inlineFragment);
+
+	RequestSubscribeParams _params;
+	FragmentMap _fragments;
+	const std::shared_ptr<const Object>& _subscriptionObject;
+	SubscriptionName _field;
+	response::Value _arguments;
+	Directives _fieldDirectives;
+	std::shared_ptr<SubscriptionData> _result;
+};
+
+SubscriptionDefinitionVisitor::SubscriptionDefinitionVisitor(RequestSubscribeParams&& params,
+	FragmentMap&& fragments, const std::shared_ptr<const Object>& subscriptionObject)
+	: _params(std::move(params))
+	, _fragments(std::move(fragments))
+	, _subscriptionObject(subscriptionObject)
+{
+}
+
+const peg::ast_node& SubscriptionDefinitionVisitor::getRoot() const
+{
+	return *_params.query.root;
+}
+
+std::shared_ptr<SubscriptionData> SubscriptionDefinitionVisitor::getRegistration()
+{
+	auto result = std::move(_result);
+
+	_result.reset();
+
+	return result;
+}
+
+void SubscriptionDefinitionVisitor::visit(const peg::ast_node& operationDefinition)
+{
+	const auto& selection = *operationDefinition.children.back();
+
+	for (const auto& child : selection.children)
+	{
+		if (child->is_type<peg::field>())
+		{
+			visitField(*child);
+		}
+		else if (child->is_type<peg::fragment_spread>())
+		{
+			visitFragmentSpread(*child);
+		}
+		else if (child->is_type<peg::inline_fragment>())
+		{
+			visitInlineFragment(*child);
+		}
+	}
+
+	Directives directives;
+
+	peg::on_first_child<peg::directives>(operationDefinition,
+		[this, &directives](const peg::ast_node& child) {
+			DirectiveVisitor directiveVisitor(_params.variables);
+
+			directiveVisitor.visit(child);
+			directives = directiveVisitor.getDirectives();
+		});
+
+	_result =
+		std::make_shared<SubscriptionData>(std::make_shared<OperationData>(std::move(_params.state),
+											   std::move(_params.variables),
+											   std::move(directives),
+											   std::make_shared<const FragmentMap>(
+												   std::move(_fragments))),
+			std::move(_field),
+			std::move(_arguments),
+			std::move(_fieldDirectives),
+			std::move(_params.query),
+			std::move(_params.operationName),
+			std::move(_params.callback),
+			selection);
+}
+
+void SubscriptionDefinitionVisitor::visitField(const peg::ast_node& field)
+{
+	std::string_view name;
+
+	peg::on_first_child<peg::field_name>(field, [&name](const peg::ast_node& child) {
+		name = child.string_view();
+	});
+
+	// https://spec.graphql.org/October2021/#sec-Single-root-field
+	if (!_field.empty())
+	{
+		auto position = field.begin();
+		std::ostringstream error;
+
+		error << "Extra subscription root field name: " << name;
+
+		throw schema_exception {
+			{ schema_error { error.str(), { position.line, position.column } } }
+		};
+	}
+
+	DirectiveVisitor directiveVisitor(_params.variables);
+
+	peg::on_first_child<peg::directives>(field, [&directiveVisitor](const peg::ast_node& child) {
+		directiveVisitor.visit(child);
+	});
+
+	if (directiveVisitor.shouldSkip())
+	{
+		return;
+	}
+
+	_fieldDirectives = directiveVisitor.getDirectives();
+
+	response::Value arguments(response::Type::Map);
+
+	peg::on_first_child<peg::arguments>(field, [this, &arguments](const peg::ast_node& child) {
+		ValueVisitor visitor(_params.variables);
+
+		for (auto& argument : child.children)
+		{
+			visitor.visit(*argument->children.back());
+
+			arguments.emplace_back(argument->children.front()->string(), visitor.getValue());
+		}
+	});
+
+	_field = std::move(name);
+	_arguments = std::move(arguments);
+}
+
+void SubscriptionDefinitionVisitor::visitFragmentSpread(const peg::ast_node& fragmentSpread)
+{
+	const auto name = fragmentSpread.children.front()->string_view();
+	auto itr = _fragments.find(name);
+
+	if (itr == _fragments.end())
+	{
+		auto position = fragmentSpread.begin();
+		std::ostringstream error;
+
+		error << "Unknown fragment name: " << name;
+
+		throw schema_exception {
+			{ schema_error { error.str(), { position.line, position.column } } }
+		};
+	}
+
+	bool skip = !_subscriptionObject->matchesType(itr->second.getType());
+	DirectiveVisitor directiveVisitor(_params.variables);
+
+	if (!skip)
+	{
+		peg::on_first_child<peg::directives>(fragmentSpread,
+			[&directiveVisitor](const peg::ast_node& child) {
+				directiveVisitor.visit(child);
+			});
+
+		skip = directiveVisitor.shouldSkip();
+	}
+
+	if (skip)
+	{
+		return;
+	}
+
+	for (const auto& selection : itr->second.getSelection().children)
+	{
+		visit(*selection);
+	}
+}
+
+void SubscriptionDefinitionVisitor::visitInlineFragment(const peg::ast_node& inlineFragment)
+{
+	DirectiveVisitor directiveVisitor(_params.variables);
+
+	peg::on_first_child<peg::directives>(inlineFragment,
+		[&directiveVisitor](const peg::ast_node& child) {
+			directiveVisitor.visit(child);
+		});
+
+	if (directiveVisitor.shouldSkip())
+	{
+		return;
+	}
+
+	const peg::ast_node* typeCondition = nullptr;
+
+	peg::on_first_child<peg::type_condition>(inlineFragment,
+		[&typeCondition](const peg::ast_node& child) {
+			typeCondition = &child;
+		});
+
+	if (typeCondition == nullptr
+		|| _subscriptionObject->matchesType(typeCondition->children.front()->string()))
+	{
+		peg::on_first_child<peg::selection_set>(inlineFragment, [this](const peg::ast_node& child) {
+			for (const auto& selection : child.children)
+			{
+				visit(*selection);
+			}
+		});
+	}
+}
+
+Request::Request(TypeMap operationTypes, std::shared_ptr<schema::Schema> schema)
+	: _operations(std::move(operationTypes))
+	, _schema(schema)
+	, _validation(std::make_shared<const ValidateExecutableSchema>(std::move(schema)))
+{
+}
+
+Request::~Request()
+{
+	// The default implementation is fine, but it's defined here rather than as = default in the
+	// header so the exported virtual destructor stays in this module.
+}
+
+std::list<schema_error> Request::validate(peg::ast& query) const
+{
+	std::list<schema_error> errors;
+
+	if (!query.validated)
+	{
+		// The shared ValidateExecutableSchema is read-only, so each call gets its own visitor and
+		// concurrent validation doesn't need to take a lock.
+		ValidateExecutableVisitor validation { _validation };
+
+		validation.visit(*query.root);
+		errors = validation.getStructuredErrors();
+		query.validated = errors.empty();
+	}
+
+	if (query.validated && !query.plan)
+	{
+		query.plan = std::make_shared<ExecutionPlan>();
+	}
+
+	return errors;
+}
+
+std::pair<std::string_view, const peg::ast_node*> Request::findOperationDefinition(
+	peg::ast& query, std::string_view operationName) const
+{
+	// Ensure the query has been validated.
+	auto errors = validate(query);
+
+	if (!errors.empty())
+	{
+		throw schema_exception { std::move(errors) };
+	}
+
+	std::pair<std::string_view, const peg::ast_node*> result = { {}, nullptr };
+
+	peg::on_first_child_if<peg::operation_definition>(*query.root,
+		[&operationName, &result](const peg::ast_node& operationDefinition) noexcept -> bool {
+			std::string_view operationType = strQuery;
+
+			peg::on_first_child<peg::operation_type>(operationDefinition,
+				[&operationType](const peg::ast_node& child) {
+					operationType = child.string_view();
+				});
+
+			std::string_view name;
+
+			peg::on_first_child<peg::operation_name>(operationDefinition,
+				[&name](const peg::ast_node& child) {
+					name = child.string_view();
+				});
+
+			if (operationName.empty() || name == operationName)
+			{
+				result = { operationType, &operationDefinition };
+				return true;
+			}
+
+			return false;
+		});
+
+	return result;
+}
+
+void Request::setCostLimits(std::shared_ptr<const CostLimits> limits)
+{
+	const std::unique_lock lock { _costMutex };
+
+	_costLimits = std::move(limits);
+}
+
+std::shared_ptr<const CostLimits> Request::getCostLimits() const
+{
+	const std::shared_lock lock { _costMutex };
+
+	return _costLimits;
+}
+
+void Request::checkCost(std::string_view operationType, const peg::ast_node& operationDefinition,
+	const FragmentMap& fragments, const response::Value& variables) const
+{
+	const auto limits = getCostLimits();
+
+	if (!limits || limits->maxCost == std::numeric_limits<size_t>::max())
+	{
+		return;
+	}
+
+	ValidateQueryCost costVisitor { *_validation, *limits, fragments, variables };
+
+	if (costVisitor.visit(operationType, operationDefinition) > limits->maxCost)
+	{
+		auto position = operationDefinition.begin();
+		std::ostringstream message;
+
+		message << "Operation cost exceeds the limit: " << limits->maxCost;
+
+		throw schema_exception {
+			{ schema_error { message.str(), { position.line, position.column } } }
+		};
+	}
+}
+
+void Request::setCacheIntrospection(bool cacheIntrospection) noexcept
+{
+	_cacheIntrospection = cacheIntrospection;
+}
+
+// Check if every field in the selection set is an introspection field, looking inside of inline
+// fragments. Fragment spreads are not followed, so they are never treated as introspection.
+bool isIntrospectionSelection(const peg::ast_node& selection)
+{
+	for (const auto& child : selection.children)
+	{
+		if (child->is_type<peg::field>())
+		{
+			std::string_view name;
+
+			peg::on_first_child<peg::field_name>(*child, [&name](const peg::ast_node& fieldName) {
+				name = fieldName.string_view();
+			});
+
+			if (name != R"gql(__schema)gql"sv && name != R"gql(__type)gql"sv
+				&& name != R"gql(__typename)gql"sv)
+			{
+				return false;
+			}
+		}
+		else if (child->is_type<peg::inline_fragment>())
+		{
+			bool introspection = false;
+
+			peg::on_first_child<peg::selection_set>(*child,
+				[&introspection](const peg::ast_node& selectionSet) {
+					introspection = isIntrospectionSelection(selectionSet);
+				});
+
+			if (!introspection)
+			{
+				return false;
+			}
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// The result of a query without any variables, which only selects introspection fields, depends on
+// nothing but the schema.
+bool isIntrospectionOperation(
+	std::string_view operationType, const peg::ast_node& operationDefinition)
+{
+	if (operationType != strQuery)
+	{
+		return false;
+	}
+
+	bool hasVariables = false;
+
+	peg::on_first_child<peg::variable>(operationDefinition, [&hasVariables](const peg::ast_node&) {
+		hasVariables = true;
+	});
+
+	bool introspection = false;
+
+	if (!hasVariables)
+	{
+		peg::on_first_child<peg::selection_set>(operationDefinition,
+			[&introspection](const peg::ast_node& selectionSet) {
+				introspection = isIntrospectionSelection(selectionSet);
+			});
+	}
+
+	return introspection;
+}
+
+// Add the extensions from the RequestInstrumentation to the response document.
+void addExtensions(response::Value& document, RequestInstrumentation* instrumentation)
+{
+	if (!instrumentation)
+	{
+		return;
+	}
+
+	auto extensions = instrumentation->getExtensions();
+
+	if (extensions.type() != response::Type::Null)
+	{
+		document.emplace_back(std::string { strExtensions }, std::move(extensions));
+	}
+}
+
+// ResolveOperation holds the fragment definitions and the operation definition for a query or
+// mutation in Request::resolve.
+struct [[nodiscard("unnecessary construction")]] ResolveOperation
+{
+	std::shared_ptr<const FragmentMap> fragments;
+	std::string_view operationType;
+	const peg::ast_node* operationDefinition = nullptr;
+};
+
+// Find the operation to resolve, or throw a schema_exception if it's missing or a subscription.
+ResolveOperation findResolveOperation(const Request& request, RequestResolveParams& params)
+{
+	ResolveOperation result { std::move(params.fragments), {}, nullptr };
+
+	if (!result.fragments)
+	{
+		FragmentDefinitionVisitor fragmentVisitor(params.variables);
+
+		peg::for_each_child<peg::fragment_definition>(*params.query.root,
+			[&fragmentVisitor](const peg::ast_node& child) {
+				fragmentVisitor.visit(child);
+			});
+
+		result.fragments = std::make_shared<const FragmentMap>(fragmentVisitor.getFragments());
+	}
+
+	std::tie(result.operationType, result.operationDefinition) =
+		request.findOperationDefinition(params.query, params.operationName);
+
+	if (!result.operationDefinition)
+	{
+		std::ostringstream message;
+
+		message << "Missing operation";
+
+		if (!params.operationName.empty())
+		{
+			message << " name: " << params.operationName;
+		}
+
+		throw schema_exception { { message.str() } };
+	}
+	else if (result.operationType == strSubscription)
+	{
+		auto position = result.operationDefinition->begin();
+		std::ostringstream message;
+
+		message << "Unexpected subscription";
+
+		if (!params.operationName.empty())
+		{
+			message << " name: " << params.operationName;
+		}
+
+		throw schema_exception {
+			{ schema_error { message.str(), { position.line, position.column } } }
+		};
+	}
+
+	request.checkCost(result.operationType,
+		*result.operationDefinition,
+		*result.fragments,
+		params.variables);
+
+	return result;
+}
+
+response::AwaitableValue Request::resolve(RequestResolveParams params) const
+{
+	const auto instrumentation = std::move(params.instrumentation);
+
+	try
+	{
+		const auto validateStart = beginRequestPhase(instrumentation.get(), RequestPhase::Validate);
+		auto [fragments, operationType, operationDefinition] =
+			findResolveOperation(*this, params);
+
+		endRequestPhase(instrumentation.get(), RequestPhase::Validate, validateStart);
+
+		const auto revision = _schema->revision();
+		const bool cacheIntrospection = !instrumentation && _cacheIntrospection
+			&& isIntrospectionOperation(operationType, *operationDefinition);
+
+		if (cacheIntrospection)
+		{
+			if (const auto data =
+					params.query.plan->findIntrospection(*operationDefinition, revision))
+			{
+				response::Value document { response::Type::Map };
+
+				// Share the cached data with every response instead of copying it.
+				document.emplace_back(std::string { strData }, response::Value { data });
+
+				co_return std::move(document);
+			}
+		}
+
+		const bool isMutation = (operationType == strMutation);
+		const auto resolverContext =
+			isMutation ? ResolverContext::Mutation : ResolverContext::Query;
+		// https://spec.graphql.org/October2021/#sec-Normal-and-Serial-Execution
+		auto operationLaunch = isMutation ? await_async {} : params.launch;
+
+		OperationDefinitionVisitor operationVisitor(resolverContext,
+			std::move(operationLaunch),
+			std::move(params.state),
+			_operations,
+			std::move(params.variables),
+			std::move(fragments),
+			params.query.plan,
+			std::move(params.cancellation),
+			instrumentation,
+			params.listGrainSize,
+			params.memoryResource);
+
+		co_await params.launch;
+
+		const auto executeStart = beginRequestPhase(instrumentation.get(), RequestPhase::Execute);
+
+		operationVisitor.visit(operationType, *operationDefinition);
+
+		auto result = co_await operationVisitor.getValue();
+
+		endRequestPhase(instrumentation.get(), RequestPhase::Execute, executeStart);
+
+		if (cacheIntrospection && result.errors.empty())
+		{
+			result.data = response::Value { params.query.plan->addIntrospection(
+				*operationDefinition,
+				revision,
+				std::move(result.data)) };
+		}
+
+		response::Value document { response::Type::Map };
+
+		document.emplace_back(std::string { strData }, std::move(result.data));
+
+		if (!result.errors.empty())
+		{
+			document.emplace_back(std::string { strErrors },
+				buildErrorValues(std::move(result.errors)));
+		}
+
+		addExtensions(document, instrumentation.get());
+
+		co_return std::move(document);
+	}
+	catch (schema_exception& ex)
+	{
+		response::Value document(response::Type::Map);
+
+		document.emplace_back(std::string { strData }, response::Value());
+		document.emplace_back(std::string { strErrors }, ex.getErrors());
+		addExtensions(document, instrumentation.get());
+
+		co_return std::move(document);
+	}
+}
+
+AwaitableWrite Request::resolve(RequestResolveParams params, const response::Writer& writer) const
+{
+	const auto instrumentation = std::move(params.instrumentation);
+	const auto revision = _schema->revision();
+	std::optional<OperationDefinitionVisitor> operationVisitor;
+	const peg::ast_node* introspectionOperation = nullptr;
+	std::list<schema_error> errors;
+
+	try
+	{
+		const auto validateStart = beginRequestPhase(instrumentation.get(), RequestPhase::Validate);
+		auto [fragments, operationType, operationDefinition] =
+			findResolveOperation(*this, params);
+
+		endRequestPhase(instrumentation.get(), RequestPhase::Validate, validateStart);
+
+		if (!instrumentation && _cacheIntrospection
+			&& isIntrospectionOperation(operationType, *operationDefinition))
+		{
+			introspectionOperation = operationDefinition;
+
+			if (const auto data =
+					params.query.plan->findIntrospection(*operationDefinition, revision))
+			{
+				writer.start_object();
+				writer.add_member(std::string { strData });
+				writer.write(data);
+				writer.end_object();
+				co_return;
+			}
+		}
+
+		const bool isMutation = (operationType == strMutation);
+		const auto resolverContext =
+			isMutation ? ResolverContext::Mutation : ResolverContext::Query;
+		// https://spec.graphql.org/October2021/#sec-Normal-and-Serial-Execution
+		auto operationLaunch = isMutation ? await_async {} : params.launch;
+
+		operationVisitor.emplace(resolverContext,
+			std::move(operationLaunch),
+			std::move(params.state),
+			_operations,
+			std::move(params.variables),
+			std::move(fragments),
+			params.query.plan,
+			std::move(params.cancellation),
+			instrumentation,
+			params.listGrainSize,
+			params.memoryResource);
+
+		co_await params.launch;
+		operationVisitor->visit(operationType, *operationDefinition);
+	}
+	catch (schema_exception& ex)
+	{
+		operationVisitor.reset();
+		errors = ex.getStructuredErrors();
+	}
+
+	// Nothing has been written yet if the operation failed before it started resolving fields.
+	writer.start_object();
+	writer.add_member(std::string { strData });
+
+	if (operationVisitor && introspectionOperation)
+	{
+		// Build the whole value so it can be cached, there's no instrumentation to report it to.
+		auto result = co_await operationVisitor->getValue();
+
+		errors = std::move(result.errors);
+
+		if (errors.empty())
+		{
+			writer.write(params.query.plan->addIntrospection(*introspectionOperation,
+				revision,
+				std::move(result.data)));
+		}
+		else
+		{
+			writer.write(std::move(result.data));
+		}
+	}
+	else if (operationVisitor)
+	{
+		const auto executeStart = beginRequestPhase(instrumentation.get(), RequestPhase::Execute);
+
+		errors = co_await operationVisitor->getValue(writer);
+		endRequestPhase(instrumentation.get(), RequestPhase::Execute, executeStart);
+	}
+	else
+	{
+		writer.write(response::Value {});
+	}
+
+	if (!errors.empty())
+	{
+		writer.add_member(std::string { strErrors });
+		writer.write(buildErrorValues(std::move(errors)));
+	}
+
+	if (instrumentation)
+	{
+		auto extensions = instrumentation->getExtensions();
+
+		if (extensions.type() != response::Type::Null)
+		{
+			writer.add_member(std::string { strExtensions });
+			writer.write(std::move(extensions));
+		}
+	}
+
+	writer.end_object();
+}
+
+AwaitableSubscribe Request::subscribe(RequestSubscribeParams params)
+{
+	const auto spThis = shared_from_this();
+	const auto launch = std::move(params.launch);
+	const auto itrOperation = spThis->_operations.find(strSubscription);
+
+	if (itrOperation == _operations.end())
+	{
+		// There may be an empty entry in the operations map, but if it's completely missing
+		// then that means the schema doesn't support subscriptions at all.
+		throw std::logic_error("Subscriptions not supported");
+	}
+
+	const auto optionalOrDefaultSubscription =
+		params.subscriptionObject ? std::move(params.subscriptionObject) : itrOperation->second;
+	const auto [key, registration] = spThis->addSubscription(std::move(params));
+
+	if (optionalOrDefaultSubscription)
+	{
+		const SelectionSetParams selectionSetParams {
+			ResolverContext::NotifySubscribe,
+			registration->data->state,
+			registration->data->directives,
+			{},
+			{},
+			{},
+			{},
+			launch,
+			registration->query.plan.get(),
+		};
+
+		try
+		{
+			co_await launch;
+
+			auto errors =
+				std::move((co_await optionalOrDefaultSubscription->resolve(selectionSetParams,
+							   registration->selection,
+							   *registration->data->fragments,
+							   registration->data->variables))
+							  .errors);
+
+			if (!errors.empty())
+			{
+				throw schema_exception { std::move(errors) };
+			}
+		}
+		catch (...)
+		{
+			// Rethrow the exception, but don't leave it subscribed if the resolver failed.
+			spThis->removeSubscription(key);
+			throw;
+		}
+	}
+
+	co_return key;
+}
+
+AwaitableUnsubscribe Request::unsubscribe(RequestUnsubscribeParams params)
+{
+	const auto spThis = shared_from_this();
+	const auto itrOperation = spThis->_operations.find(strSubscription);
+
+	if (itrOperation == _operations.end())
+	{
+		// There may be an empty entry in the operations map, but if it's completely missing
+		// then that means the schema doesn't support subscriptions at all.
+		throw std::logic_error("Subscriptions not supported");
+	}
+
+	const auto optionalOrDefaultSubscription =
+		params.subscriptionObject ? std::move(params.subscriptionObject) : itrOperation->second;
+	std::list<schema_error> errors {};
+
+	if (optionalOrDefaultSubscription)
+	{
+		const auto registration = spThis->findSubscription(params.key);
+
+		if (!registration)
+		{
+			throw std::out_of_range("Unknown subscription key");
+		}
+
+		const SelectionSetParams selectionSetParams {
+			ResolverContext::NotifyUnsubscribe,
+			registration->data->state,
+			registration->data->directives,
+			{},
+			{},
+			{},
+			{},
+			params.launch,
+			registration->query.plan.get(),
+		};
+
+		co_await params.launch;
+		errors = std::move((co_await optionalOrDefaultSubscription->resolve(selectionSetParams,
+								registration->selection,
+								*registration->data->fragments,
+								registration->data->variables))
+							   .errors);
+	}
+
+	spThis->removeSubscription(params.key);
+
+	if (!errors.empty())
+	{
+		throw schema_exception { std::move(errors) };
+	}
+
+	co_return;
+}
+
+bool isSameSubscription(const SubscriptionData& lhs, const SubscriptionData& rhs)
+{
+	if (lhs.data->state != rhs.data->state || lhs.operationName != rhs.operationName
+		|| lhs.arguments != rhs.arguments || lhs.fieldDirectives != rhs.fieldDirectives
+		|| lhs.data->directives != rhs.data->directives
+		|| lhs.data->variables != rhs.data->variables)
+	{
+		return false;
+	}
+
+	if (lhs.query.root == rhs.query.root)
+	{
+		return true;
+	}
+
+	const auto& lhsDefinitions = lhs.query.root->children;
+	const auto& rhsDefinitions = rhs.query.root->children;
+
+	return std::equal(lhsDefinitions.cbegin(),
+		lhsDefinitions.cend(),
+		rhsDefinitions.cbegin(),
+		rhsDefinitions.cend(),
+		[](const auto& lhsDefinition, const auto& rhsDefinition) noexcept {
+			return lhsDefinition->string_view() == rhsDefinition->string_view();
+		});
+}
+
+using SubscriptionGroup = std::vector<std::shared_ptr<const SubscriptionData>>;
+
+// Resolve the payload once for a group of identical subscriptions and pass a copy of the same
+// document to each of their callbacks.
+AwaitableDeliver deliverGroup(std::shared_ptr<const Object> subscriptionObject,
+	SubscriptionGroup group, await_async launch)
+{
+	const auto& registration = group.front();
+	const SelectionSetParams selectionSetParams {
+		ResolverContext::Subscription,
+		registration->data->state,
+		registration->data->directives,
+		{},
+		{},
+		{},
+		std::nullopt,
+		launch,
+		registration->query.plan.get(),
+	};
+
+	response::Value document { response::Type::Map };
+
+	try
+	{
+		co_await launch;
+
+		auto result = co_await subscriptionObject->resolve(selectionSetParams,
+			registration->selection,
+			*registration->data->fragments,
+			registration->data->variables);
+
+		document.emplace_back(std::string { strData }, std::move(result.data));
+
+		if (!result.errors.empty())
+		{
+			document.emplace_back(std::string { strErrors },
+				buildErrorValues(std::move(result.errors)));
+		}
+	}
+	catch (schema_exception& ex)
+	{
+		document.emplace_back(std::string { strData }, response::Value());
+		document.emplace_back(std::string { strErrors }, ex.getErrors());
+	}
+
+	// Call every subscriber in the group even if one of them throws, and rethrow the first
+	// exception once they have all been called.
+	const auto itrLast = std::prev(group.cend());
+	std::exception_ptr firstException {};
+
+	for (auto itr = group.cbegin(); itr != group.cend(); ++itr)
+	{
+		try
+		{
+			if (itr == itrLast)
+			{
+				(*itr)->callback(std::move(document));
+			}
+			else
+			{
+				(*itr)->callback(response::Value { document });
+			}
+		}
+		catch (...)
+		{
+			if (!firstException)
+			{
+				firstException = std::current_exception();
+			}
+		}
+	}
+
+	if (firstException)
+	{
+		std::rethrow_exception(firstException);
+	}
+}
+
+AwaitableDeliver Request::deliver(RequestDeliverParams params) const
+{
+	const auto itrOperation = _operations.find(strSubscription);
+
+	if (itrOperation == _operations.end())
+	{
+		// There may be an empty entry in the operations map, but if it's completely missing
+		// then that means the schema doesn't support subscriptions at all.
+		throw std::logic_error("Subscriptions not supported");
+	}
+
+	const auto optionalOrDefaultSubscription =
+		params.subscriptionObject ? std::move(params.subscriptionObject) : itrOperation->second;
+
+	if (!optionalOrDefaultSubscription)
+	{
+		// If there is no default in the operations map, you must pass a non-empty
+		// subscriptionObject parameter to deliver.
+		throw std::invalid_argument("Missing subscriptionObject");
+	}
+
+	const auto registrations = collectRegistrations(params.field, std::move(params.filter));
+
+	if (registrations.empty())
+	{
+		co_return;
+	}
+
+	// Group the identical subscriptions so each group only resolves the payload once.
+	std::vector<SubscriptionGroup> groups;
+	std::unordered_multimap<size_t, size_t> groupIndices;
+
+	for (const auto& registration : registrations)
+	{
+		const auto hash = registration->hash;
+		const auto [itrBegin, itrEnd] = groupIndices.equal_range(hash);
+		const auto itrGroup =
+			std::find_if(itrBegin, itrEnd, [&groups, &registration](const auto& entry) {
+				return isSameSubscription(*groups[entry.second].front(), *registration);
+			});
+
+		if (itrGroup == itrEnd)
+		{
+			groupIndices.emplace(hash, groups.size());
+			groups.push_back({ registration });
+		}
+		else
+		{
+			groups[itrGroup->second].push_back(registration);
+		}
+	}
+
+	// Start every group before awaiting any of them, so they can resolve concurrently if the launch
+	// policy switches to another thread.
+	std::vector<AwaitableDeliver> deliveries;
 
-			peg::on_first_child<peg::variable_name>(variable,
-				[&variableName](const peg::ast_node& name) {
-					// Skip the $ prefix
-					variableName = name.string_view().substr(1);
-				});
+	deliveries.reserve(groups.size());
 
-			auto itrVar = _params->variables.find(variableName);
-			response::Value valueVar;
+	for (auto& group : groups)
+	{
+		deliveries.push_back(
+			deliverGroup(optionalOrDefaultSubscription, std::move(group), params.launch));
+	}
 
-			if (itrVar != _params->variables.get<response::MapType>().cend())
+	std::exception_ptr firstException {};
+
+	for (auto& delivery : deliveries)
+	{
+		try
+		{
+			co_await delivery;
+		}
+		catch (...)
+		{
+			if (!firstException)
 			{
-				valueVar = response::Value(itrVar->second);
+				firstException = std::current_exception();
 			}
-			else
-			{
-				peg::on_first_child<peg::default_value>(variable,
-					[this, &valueVar](const peg::ast_node& defaultValue) {
-						ValueVisitor visitor(_params->variables);
+		}
+	}
 
-						visitor.visit(*defaultValue.children.front());
-						valueVar = visitor.getValue();
-					});
-			}
+	if (firstException)
+	{
+		std::rethrow_exception(firstException);
+	}
 
-			operationVariables.emplace_back(std::move(variableName), std::move(valueVar));
-		});
+	co_return;
+}
 
-	_params->variables = std::move(operationVariables);
+size_t Request::SubscriptionNameHash::operator()(std::string_view name) const noexcept
+{
+	return std::hash<std::string_view> {}(name);
+}
 
-	Directives operationDirectives;
+std::pair<SubscriptionKey, std::shared_ptr<const SubscriptionData>> Request::addSubscription(
+	RequestSubscribeParams&& params)
+{
+	auto errors = validate(params.query);
 
-	peg::on_first_child<peg::directives>(operationDefinition,
-		[this, &operationDirectives](const peg::ast_node& child) {
-			DirectiveVisitor directiveVisitor(_params->variables);
+	if (!errors.empty())
+	{
+		throw schema_exception { std::move(errors) };
+	}
 
-			directiveVisitor.visit(child);
-			operationDirectives = directiveVisitor.getDirectives();
+	FragmentDefinitionVisitor fragmentVisitor(params.variables);
+
+	peg::for_each_child<peg::fragment_definition>(*params.query.root,
+		[&fragmentVisitor](const peg::ast_node& child) {
+			fragmentVisitor.visit(child);
 		});
 
-	_params->directives = std::move(operationDirectives);
+	auto fragments = fragmentVisitor.getFragments();
+	auto [operationType, operationDefinition] =
+		findOperationDefinition(params.query, params.operationName);
 
-	const SelectionSetParams selectionSetParams {
-		_resolverContext,
-		_params->state,
-		_params->directives,
-		std::make_shared<FragmentDefinitionDirectiveStack>(),
-		std::make_shared<FragmentSpreadDirectiveStack>(),
-		std::make_shared<FragmentSpreadDirectiveStack>(),
-		std::nullopt,
-		_launch,
-	};
+	if (!operationDefinition)
+	{
+		std::ostringstream message;
 
-	_result = std::make_optional(itr->second->resolve(selectionSetParams,
-		*operationDefinition.children.back(),
-		_params->fragments,
-		_params->variables));
-}
+		message << "Missing subscription";
 
-SubscriptionData::SubscriptionData(std::shared_ptr<OperationData> data, SubscriptionName&& field,
-	response::Value arguments, Directives fieldDirectives, peg::ast&& query,
-	std::string&& operationName, SubscriptionCallback&& callback, const peg::ast_node& selection)
-	: data(std::move(data))
-	, field(std::move(field))
-	, arguments(std::move(arguments))
-	, fieldDirectives(std::move(fieldDirectives))
-	, query(std::move(query))
-	, operationName(std::move(operationName))
-	, callback(std::move(callback))
-	, selection(selection)
-{
-}
+		if (!params.operationName.empty())
+		{
+			message << " name: " << params.operationName;
+		}
 
-// SubscriptionDefinitionVisitor visits the AST collects the fields referenced in the
-// subscription at the point where we create a subscription.
-class SubscriptionDefinitionVisitor
-{
-public:
-	SubscriptionDefinitionVisitor(RequestSubscribeParams&& params, FragmentMap&& fragments,
-		const std::shared_ptr<const Object>& subscriptionObject);
+		throw schema_exception { { message.str() } };
+	}
+	else if (operationType != strSubscription)
+	{
+		auto position = operationDefinition->begin();
+		std::ostringstream message;
 
-	const peg::ast_node& getRoot() const;
-	std::shared_ptr<SubscriptionData> getRegistration();
+		message << "Unexpected operation type: " << operationType;
 
-	void visit(const peg::ast_node& operationDefinition);
+		if (!params.operationName.empty())
+		{
+			message << " name: " << params.operationName;
+		}
 
-private:
-	void visitField(const peg::ast_node& field);
-	void visitFragmentSpread(const peg::ast_node& fragmentSpread);
-	void visitInlineFragment(const peg::ast_node& inlineFragment);
+		throw schema_exception {
+			{ schema_error { message.str(), { position.line, position.column } } }
+		};
+	}
 
-	RequestSubscribeParams _params;
-	FragmentMap _fragments;
-	const std::shared_ptr<const Object>& _subscriptionObject;
-	SubscriptionName _field;
-	response::Value _arguments;
-	Directives _fieldDirectives;
-	std::shared_ptr<SubscriptionData> _result;
-};
+	checkCost(operationType, *operationDefinition, fragments, params.variables);
 
-SubscriptionDefinitionVisitor::SubscriptionDefinitionVisitor(RequestSubscribeParams&& params,
-	FragmentMap&& fragments, const std::shared_ptr<const Object>& subscriptionObject)
-	: _params(std::move(params))
-	, _fragments(std::move(fragments))
-	, _subscriptionObject(subscriptionObject)
-{
+	auto itr = _operations.find(strSubscription);
+	SubscriptionDefinitionVisitor subscriptionVisitor(std::move(params),
+		std::move(fragments),
+		itr->second);
+
+	peg::for_each_child<peg::operation_definition>(subscriptionVisitor.getRoot(),
+		[&subscriptionVisitor](const peg::ast_node& child) {
+			subscriptionVisitor.visit(child);
+		});
+
+	// Everything up to this point only depends on the params, so the shard is only locked long
+	// enough to insert the new registration.
+	auto registration = subscriptionVisitor.getRegistration();
+	const auto key = _nextKey.fetch_add(1, std::memory_order_relaxed);
+	auto& shard = _subscriptionShards[key % c_subscriptionShards];
+	const std::unique_lock lock { shard.mutex };
+
+	shard.listeners[registration->field].emplace(key, registration);
+	shard.subscriptions.emplace(key, registration);
+
+	return { key, std::move(registration) };
 }
 
-const peg::ast_node& SubscriptionDefinitionVisitor::getRoot() const
+void Request::removeSubscription(SubscriptionKey key)
 {
-	return *_params.query.root;
+	auto& shard = _subscriptionShards[key % c_subscriptionShards];
+	const std::unique_lock lock { shard.mutex };
+	const auto itrSubscription = shard.subscriptions.find(key);
+
+	if (itrSubscription == shard.subscriptions.end())
+	{
+		return;
+	}
+
+	const auto itrListener = shard.listeners.find(itrSubscription->second->field);
+	auto& listener = itrListener->second;
+
+	listener.erase(key);
+	if (listener.empty())
+	{
+		shard.listeners.erase(itrListener);
+	}
+
+	shard.subscriptions.erase(itrSubscription);
 }
 
-std::shared_ptr<SubscriptionData> SubscriptionDefinitionVisitor::getRegistration()
+std::shared_ptr<const SubscriptionData> Request::findSubscription(SubscriptionKey key) const
 {
-	auto result = std::move(_result);
-
-	_result.reset();
+	const auto& shard = _subscriptionShards[key % c_subscriptionShards];
+	const std::shared_lock lock { shard.mutex };
+	const auto itr = shard.subscriptions.find(key);
 
-	return result;
+	return itr == shard.subscriptions.end() ? std::shared_ptr<const SubscriptionData> {}
+											: itr->second;
 }
 
-void SubscriptionDefinitionVisitor::visit(const peg::ast_node& operationDefinition)
+std::vector<std::shared_ptr<const SubscriptionData>> Request::collectRegistrations(
+	std::string_view field, RequestDeliverFilter&& filter) const noexcept
 {
-	const auto& selection = *operationDefinition.children.back();
+	std::vector<std::shared_ptr<const SubscriptionData>> registrations;
 
-	for (const auto& child : selection.children)
+	if (!filter)
 	{
-		if (child->is_type<peg::field>())
+		// Return all of the registered subscriptions for this field.
+		for (const auto& shard : _subscriptionShards)
 		{
-			visitField(*child);
+			const std::shared_lock lock { shard.mutex };
+			const auto itrListeners = shard.listeners.find(field);
+
+			if (itrListeners != shard.listeners.end())
+			{
+				registrations.reserve(registrations.size() + itrListeners->second.size());
+				std::transform(itrListeners->second.begin(),
+					itrListeners->second.end(),
+					std::back_inserter(registrations),
+					[](const auto& entry) noexcept {
+						return entry.second;
+					});
+			}
 		}
-		else if (child->is_type<peg::fragment_spread>())
+	}
+	else if (std::holds_alternative<SubscriptionKey>(*filter))
+	{
+		// Return the specific subscription for this key.
+		const auto key = std::get<SubscriptionKey>(*filter);
+		const auto& shard = _subscriptionShards[key % c_subscriptionShards];
+		const std::shared_lock lock { shard.mutex };
+		const auto itr = shard.subscriptions.find(key);
+
+		if (itr != shard.subscriptions.end() && itr->second->field == field)
 		{
-			visitFragmentSpread(*child);
+			registrations.push_back(itr->second);
 		}
-		else if (child->is_type<peg::inline_fragment>())
+	}
+	else if (std::holds_alternative<SubscriptionFilter>(*filter))
+	{
+		auto& subscriptionFilter = std::get<SubscriptionFilter>(*filter);
+		std::optional<SubscriptionArgumentFilterCallback> argumentsMatch;
+
+		if (subscriptionFilter.arguments)
 		{
-			visitInlineFragment(*child);
+			if (std::holds_alternative<SubscriptionArguments>(*subscriptionFilter.arguments))
+			{
+				argumentsMatch = [arguments = std::move(std::get<SubscriptionArguments>(
+									  *subscriptionFilter.arguments))](
+									 response::MapType::const_reference required) noexcept {
+					auto itrArgument = arguments.find(required.first);
+
+					return (itrArgument != arguments.end()
+						&& itrArgument->second == required.second);
+				};
+			}
+			else if (std::holds_alternative<SubscriptionArgumentFilterCallback>(
+						 *subscriptionFilter.arguments))
+			{
+				argumentsMatch = std::move(
+					std::get<SubscriptionArgumentFilterCallback>(*subscriptionFilter.arguments));
+			}
 		}
-	}
 
-	Directives directives;
+		std::optional<SubscriptionDirectiveFilterCallback> directivesMatch;
 
-	peg::on_first_child<peg::directives>(operationDefinition,
-		[this, &directives](const peg::ast_node& child) {
-			DirectiveVisitor directiveVisitor(_params.variables);
+		if (subscriptionFilter.directives)
+		{
+			if (std::holds_alternative<Directives>(*subscriptionFilter.directives))
+			{
+				directivesMatch = [directives = std::move(
+									   std::get<Directives>(*subscriptionFilter.directives))](
+									  Directives::const_reference required) noexcept {
+					auto itrDirective = std::find_if(directives.cbegin(),
+						directives.cend(),
+						[directiveName = required.first](const auto& directive) noexcept {
+							return directive.first == directiveName;
+						});
+
+					return (itrDirective != directives.end()
+						&& itrDirective->second == required.second);
+				};
+			}
+			else if (std::holds_alternative<SubscriptionDirectiveFilterCallback>(
+						 *subscriptionFilter.directives))
+			{
+				directivesMatch = std::move(std::get<SubscriptionDirectiveFilterCallback>(
+					*subscriptionFilter.directives));
+			}
+		}
 
-			directiveVisitor.visit(child);
-			directives = directiveVisitor.getDirectives();
-		});
+		for (const auto& shard : _subscriptionShards)
+		{
+			const std::shared_lock lock { shard.mutex };
+			const auto itrListeners = shard.listeners.find(field);
 
-	_result =
-		std::make_shared<SubscriptionData>(std::make_shared<OperationData>(std::move(_params.state),
-											   std::move(_params.variables),
-											   std::move(directives),
-											   std::move(_fragments)),
-			std::move(_field),
-			std::move(_arguments),
-			std::move(_fieldDirectives),
-			std::move(_params.query),
-			std::move(_params.operationName),
-			std::move(_params.callback),
-			selection);
-}
+			if (itrListeners == shard.listeners.end())
+			{
+				continue;
+			}
 
-void SubscriptionDefinitionVisitor::visitField(const peg::ast_node& field)
-{
-	std::string_view name;
+			registrations.reserve(registrations.size() + itrListeners->second.size());
 
-	peg::on_first_child<peg::field_name>(field, [&name](const peg::ast_node& child) {
-		name = child.string_view();
-	});
+			for (const auto& [key, registration] : itrListeners->second)
+			{
+				if (argumentsMatch)
+				{
+					const auto& subscriptionArguments = registration->arguments;
+					bool matchedArguments = true;
+
+					// If the field in this subscription had arguments that did not match what
+					// was provided in this event, don't deliver the event to this subscription
+					for (const auto& required : subscriptionArguments)
+					{
+						if (!(*argumentsMatch)(required))
+						{
+							matchedArguments = false;
+							break;
+						}
+					}
+
+					if (!matchedArguments)
+					{
+						continue;
+					}
+				}
+
+				if (directivesMatch)
+				{
+					// If the field in this subscription had field directives that did not match
+					// what was provided in this event, don't deliver the event to this
+					// subscription
+					const auto& subscriptionFieldDirectives = registration->fieldDirectives;
+					bool matchedFieldDirectives = true;
 
-	// https://spec.graphql.org/October2021/#sec-Single-root-field
-	if (!_field.empty())
-	{
-		auto position = field.begin();
-		std::ostringstream error;
+					for (const auto& required : subscriptionFieldDirectives)
+					{
+						if (!(*directivesMatch)(required))
+						{
+							matchedFieldDirectives = false;
+							break;
+						}
+					}
 
-		error << "Extra subscription root field name: " << name;
+					if (!matchedFieldDirectives)
+					{
+						continue;
+					}
+				}
 
-		throw schema_exception {
-			{ schema_error { error.str(), { position.line, position.column } } }
-		};
+				registrations.push_back(registration);
+			}
+		}
 	}
 
-	DirectiveVisitor directiveVisitor(_params.variables);
+	return registrations;
+}
 
-	peg::on_first_child<peg::directives>(field, [&directiveVisitor](const peg::ast_node& child) {
-		directiveVisitor.visit(child);
-	});
+DocumentCache::DocumentCache(
+	std::shared_ptr<const Request> service, size_t capacity, size_t depthLimit)
+	: _service(std::move(service))
+	, _capacity(std::max(capacity, size_t { 1 }))
+	, _depthLimit(depthLimit)
+{
+}
 
-	if (directiveVisitor.shouldSkip())
+std::shared_ptr<const CachedDocument> DocumentCache::getDocument(std::string_view query)
+{
+	if (auto document = find(_queries, query))
 	{
-		return;
+		return document;
 	}
 
-	_fieldDirectives = directiveVisitor.getDirectives();
-
-	response::Value arguments(response::Type::Map);
-
-	peg::on_first_child<peg::arguments>(field, [this, &arguments](const peg::ast_node& child) {
-		ValueVisitor visitor(_params.variables);
-
-		for (auto& argument : child.children)
-		{
-			visitor.visit(*argument->children.back());
+	// Parse and validate the query outside of the lock, if another thread beats us to it the
+	// document will just be replaced with an equivalent one.
+	return insert(false, query, parseDocument(query));
+}
 
-			arguments.emplace_back(argument->children.front()->string(), visitor.getValue());
-		}
-	});
+std::shared_ptr<const CachedDocument> DocumentCache::findPersistedDocument(std::string_view id)
+{
+	return find(_persisted, id);
+}
 
-	_field = std::move(name);
-	_arguments = std::move(arguments);
+std::shared_ptr<const CachedDocument> DocumentCache::addPersistedDocument(
+	std::string_view id, std::string_view query)
+{
+	return insert(true, id, parseDocument(query));
 }
 
-void SubscriptionDefinitionVisitor::visitFragmentSpread(const peg::ast_node& fragmentSpread)
+DocumentCacheStats DocumentCache::getStats() const
 {
-	const auto name = fragmentSpread.children.front()->string_view();
-	auto itr = _fragments.find(name);
+	std::unique_lock lock { _mutex };
 
-	if (itr == _fragments.end())
-	{
-		auto position = fragmentSpread.begin();
-		std::ostringstream error;
+	return { _hits, _misses, _evictions, _entries.size() };
+}
 
-		error << "Unknown fragment name: " << name;
+void DocumentCache::clear()
+{
+	std::unique_lock lock { _mutex };
 
-		throw schema_exception {
-			{ schema_error { error.str(), { position.line, position.column } } }
-		};
-	}
+	_queries.clear();
+	_persisted.clear();
+	_entries.clear();
+}
 
-	bool skip = !_subscriptionObject->matchesType(itr->second.getType());
-	DirectiveVisitor directiveVisitor(_params.variables);
+std::shared_ptr<const CachedDocument> DocumentCache::find(EntryMap& entries, std::string_view key)
+{
+	std::unique_lock lock { _mutex };
+	const auto itr = entries.find(key);
 
-	if (!skip)
+	if (itr == entries.end())
 	{
-		peg::on_first_child<peg::directives>(fragmentSpread,
-			[&directiveVisitor](const peg::ast_node& child) {
-				directiveVisitor.visit(child);
-			});
-
-		skip = directiveVisitor.shouldSkip();
+		++_misses;
+		return nullptr;
 	}
 
-	if (skip)
-	{
-		return;
-	}
+	++_hits;
 
-	for (const auto& selection : itr->second.getSelection().children)
-	{
-		visit(*selection);
-	}
+	// Move the entry to the front of the list, this does not invalidate any of the iterators.
+	_entries.splice(_entries.begin(), _entries, itr->second);
+
+	return itr->second->document;
 }
 
-void SubscriptionDefinitionVisitor::visitInlineFragment(const peg::ast_node& inlineFragment)
+std::shared_ptr<const CachedDocument> DocumentCache::parseDocument(std::string_view query) const
 {
-	DirectiveVisitor directiveVisitor(_params.variables);
+	auto document = std::make_shared<CachedDocument>();
 
-	peg::on_first_child<peg::directives>(inlineFragment,
-		[&directiveVisitor](const peg::ast_node& child) {
-			directiveVisitor.visit(child);
-		});
+	// The AST needs to own a copy of the query text, it will outlive the caller's buffer.
+	document->query = peg::parseString(query, _depthLimit);
 
-	if (directiveVisitor.shouldSkip())
+	auto errors = _service->validate(document->query);
+
+	if (!errors.empty())
 	{
-		return;
+		throw schema_exception { std::move(errors) };
 	}
 
-	const peg::ast_node* typeCondition = nullptr;
+	bool hasDirectives = false;
 
-	peg::on_first_child<peg::type_condition>(inlineFragment,
-		[&typeCondition](const peg::ast_node& child) {
-			typeCondition = &child;
+	peg::for_each_child<peg::fragment_definition>(*document->query.root,
+		[&hasDirectives](const peg::ast_node& child) {
+			peg::on_first_child<peg::directives>(child, [&hasDirectives](const peg::ast_node&) {
+				hasDirectives = true;
+			});
 		});
 
-	if (typeCondition == nullptr
-		|| _subscriptionObject->matchesType(typeCondition->children.front()->string()))
+	if (!hasDirectives)
 	{
-		peg::on_first_child<peg::selection_set>(inlineFragment, [this](const peg::ast_node& child) {
-			for (const auto& selection : child.children)
-			{
-				visit(*selection);
-			}
-		});
-	}
-}
-
-Request::Request(TypeMap operationTypes, std::shared_ptr<schema::Schema> schema)
-	: _operations(std::move(operationTypes))
-	, _validation(std::make_unique<ValidateExecutableVisitor>(std::move(schema)))
-{
-}
-
-Request::~Request()
-{
-	// The default implementation is fine, but it can't be declared as = default because it
-	// needs to know how to destroy the _validation member and it can't do that with just a
-	// forward declaration of the class.
-}
-
-std::list<schema_error> Request::validate(peg::ast& query) const
-{
-	std::list<schema_error> errors;
+		// None of the fragment definitions can depend on the variables, so they only need to be
+		// collected once.
+		const response::Value variables(response::Type::Map);
+		FragmentDefinitionVisitor fragmentVisitor(variables);
 
-	if (!query.validated)
-	{
-		const std::lock_guard lock { _validationMutex };
+		peg::for_each_child<peg::fragment_definition>(*document->query.root,
+			[&fragmentVisitor](const peg::ast_node& child) {
+				fragmentVisitor.visit(child);
+			});
 
-		_validation->visit(*query.root);
-		errors = _validation->getStructuredErrors();
-		query.validated = errors.empty();
+		document->fragments = std::make_shared<const FragmentMap>(fragmentVisitor.getFragments());
 	}
 
-	return errors;
+	return document;
 }
 
-std::pair<std::string_view, const peg::ast_node*> Request::findOperationDefinition(
-	peg::ast& query, std::string_view operationName) const
+std::shared_ptr<const CachedDocument> DocumentCache::insert(
+	bool persisted, std::string_view key, std::shared_ptr<const CachedDocument> document)
 {
-	// Ensure the query has been validated.
-	auto errors = validate(query);
+	std::unique_lock lock { _mutex };
+	auto& entries = persisted ? _persisted : _queries;
+	const auto itrExisting = entries.find(key);
 
-	if (!errors.empty())
+	if (itrExisting != entries.end())
 	{
-		throw schema_exception { std::move(errors) };
-	}
-
-	std::pair<std::string_view, const peg::ast_node*> result = { {}, nullptr };
-
-	peg::on_first_child_if<peg::operation_definition>(*query.root,
-		[&operationName, &result](const peg::ast_node& operationDefinition) noexcept -> bool {
-			std::string_view operationType = strQuery;
+		itrExisting->second->document = document;
+		_entries.splice(_entries.begin(), _entries, itrExisting->second);
 
-			peg::on_first_child<peg::operation_type>(operationDefinition,
-				[&operationType](const peg::ast_node& child) {
-					operationType = child.string_view();
-				});
+		return document;
+	}
 
-			std::string_view name;
+	while (_entries.size() >= _capacity)
+	{
+		const auto& oldest = _entries.back();
 
-			peg::on_first_child<peg::operation_name>(operationDefinition,
-				[&name](const peg::ast_node& child) {
-					name = child.string_view();
-				});
+		(oldest.persisted ? _persisted : _queries).erase(oldest.key);
+		_entries.pop_back();
+		++_evictions;
+	}
 
-			if (operationName.empty() || name == operationName)
-			{
-				result = { operationType, &operationDefinition };
-				return true;
-			}
+	_entries.push_front({ std::string { key }, persisted, document });
+	entries.emplace(_entries.front().key, _entries.begin());
 
-			return false;
-		});
+	return document;
+}
 
-	return result;
+// Append a length prefixed string to the coalescing key, so no combination of strings can collide.
+void appendCoalescingKey(std::string& key, std::string_view value)
+{
+	key.append(std::to_string(value.size()));
+	key.push_back(':');
+	key.append(value);
 }
 
-response::AwaitableValue Request::resolve(RequestResolveParams params) const
+// Append a canonical representation of the variables to the coalescing key. The members of a map
+// are sorted by name, since they are not ordered in the JSON request.
+void appendCoalescingKey(std::string& key, const response::Value& value)
 {
-	try
+	switch (value.type())
 	{
-		FragmentDefinitionVisitor fragmentVisitor(params.variables);
+		case response::Type::Map:
+		{
+			const auto& members = value.get<response::MapType>();
+			std::vector<const response::MapType::value_type*> sorted;
 
-		peg::for_each_child<peg::fragment_definition>(*params.query.root,
-			[&fragmentVisitor](const peg::ast_node& child) {
-				fragmentVisitor.visit(child);
-			});
+			sorted.reserve(members.size());
 
-		auto fragments = fragmentVisitor.getFragments();
-		auto [operationType, operationDefinition] =
-			findOperationDefinition(params.query, params.operationName);
+			for (const auto& member : members)
+			{
+				sorted.push_back(&member);
+			}
 
-		if (!operationDefinition)
-		{
-			std::ostringstream message;
+			std::sort(sorted.begin(), sorted.end(), [](const auto* lhs, const auto* rhs) noexcept {
+				return static_cast<std::string_view>(lhs->first)
+					< static_cast<std::string_view>(rhs->first);
+			});
 
-			message << "Missing operation";
+			key.push_back('{');
 
-			if (!params.operationName.empty())
+			for (const auto* member : sorted)
 			{
-				message << " name: " << params.operationName;
+				appendCoalescingKey(key, static_cast<std::string_view>(member->first));
+				appendCoalescingKey(key, member->second);
 			}
 
-			throw schema_exception { { message.str() } };
+			key.push_back('}');
+			break;
 		}
-		else if (operationType == strSubscription)
-		{
-			auto position = operationDefinition->begin();
-			std::ostringstream message;
 
-			message << "Unexpected subscription";
+		case response::Type::List:
+			key.push_back('[');
 
-			if (!params.operationName.empty())
+			for (const auto& element : value.get<response::ListType>())
 			{
-				message << " name: " << params.operationName;
+				appendCoalescingKey(key, element);
 			}
 
-			throw schema_exception {
-				{ schema_error { message.str(), { position.line, position.column } } }
-			};
-		}
-
-		const bool isMutation = (operationType == strMutation);
-		const auto resolverContext =
-			isMutation ? ResolverContext::Mutation : ResolverContext::Query;
-		// https://spec.graphql.org/October2021/#sec-Normal-and-Serial-Execution
-		auto operationLaunch = isMutation ? await_async {} : params.launch;
+			key.push_back(']');
+			break;
 
-		OperationDefinitionVisitor operationVisitor(resolverContext,
-			std::move(operationLaunch),
-			std::move(params.state),
-			_operations,
-			std::move(params.variables),
-			std::move(fragments));
+		case response::Type::String:
+			// Strings from JSON or input literals may also be coerced to an enum value or an ID.
+			key.push_back(value.maybe_enum() ? 'e' : (value.maybe_id() ? 'd' : 's'));
+			appendCoalescingKey(key, std::string_view { value.get<response::StringType>() });
+			break;
 
-		co_await params.launch;
-		operationVisitor.visit(operationType, *operationDefinition);
+		case response::Type::Null:
+			key.push_back('n');
+			break;
 
-		auto result = co_await operationVisitor.getValue();
-		response::Value document { response::Type::Map };
+		case response::Type::Boolean:
+			key.push_back(value.get<response::BooleanType>() ? 't' : 'f');
+			break;
 
-		document.emplace_back(std::string { strData }, std::move(result.data));
+		case response::Type::Int:
+			key.push_back('i');
+			key.append(std::to_string(value.get<response::IntType>()));
+			key.push_back(';');
+			break;
 
-		if (!result.errors.empty())
+		case response::Type::Float:
 		{
-			document.emplace_back(std::string { strErrors },
-				buildErrorValues(std::move(result.errors)));
+			std::array<char, 32> buffer {};
+			const auto [end, ec] = std::to_chars(buffer.data(),
+				buffer.data() + buffer.size(),
+				value.get<response::FloatType>());
+
+			key.push_back('F');
+			key.append(buffer.data(), end);
+			key.push_back(';');
+			break;
 		}
 
-		co_return std::move(document);
-	}
-	catch (schema_exception& ex)
-	{
-		response::Value document(response::Type::Map);
-
-		document.emplace_back(std::string { strData }, response::Value());
-		document.emplace_back(std::string { strErrors }, ex.getErrors());
-
-		co_return std::move(document);
-	}
-}
-
-AwaitableSubscribe Request::subscribe(RequestSubscribeParams params)
-{
-	const auto spThis = shared_from_this();
-	const auto launch = std::move(params.launch);
-	std::unique_lock lock { spThis->_subscriptionMutex };
-	const auto itrOperation = spThis->_operations.find(strSubscription);
-
-	if (itrOperation == _operations.end())
-	{
-		// There may be an empty entry in the operations map, but if it's completely missing
-		// then that means the schema doesn't support subscriptions at all.
-		throw std::logic_error("Subscriptions not supported");
-	}
-
-	const auto optionalOrDefaultSubscription =
-		params.subscriptionObject ? std::move(params.subscriptionObject) : itrOperation->second;
-	const auto key = spThis->addSubscription(std::move(params));
-
-	if (optionalOrDefaultSubscription)
-	{
-		const auto registration = spThis->_subscriptions.at(key);
-		const SelectionSetParams selectionSetParams {
-			ResolverContext::NotifySubscribe,
-			registration->data->state,
-			registration->data->directives,
-			std::make_shared<FragmentDefinitionDirectiveStack>(),
-			std::make_shared<FragmentSpreadDirectiveStack>(),
-			std::make_shared<FragmentSpreadDirectiveStack>(),
-			{},
-			launch,
-		};
-
-		lock.unlock();
+		case response::Type::EnumValue:
+			key.push_back('E');
+			appendCoalescingKey(key, std::string_view { value.get<response::StringType>() });
+			break;
 
-		try
+		case response::Type::ID:
 		{
-			co_await launch;
+			const auto& id = value.get<response::IdType>();
 
-			auto errors =
-				std::move((co_await optionalOrDefaultSubscription->resolve(selectionSetParams,
-							   registration->selection,
-							   registration->data->fragments,
-							   registration->data->variables))
-							  .errors);
+			if (id.isBase64())
+			{
+				const auto& data = id.get<response::IdType::ByteData>();
 
-			if (!errors.empty())
+				key.push_back('B');
+				appendCoalescingKey(key,
+					std::string_view { reinterpret_cast<const char*>(data.data()), data.size() });
+			}
+			else
 			{
-				throw schema_exception { std::move(errors) };
+				key.push_back('O');
+				appendCoalescingKey(key,
+					std::string_view { id.get<response::IdType::OpaqueString>() });
 			}
+			break;
 		}
-		catch (...)
-		{
-			lock.lock();
 
-			// Rethrow the exception, but don't leave it subscribed if the resolver failed.
-			spThis->removeSubscription(key);
-			throw;
-		}
+		case response::Type::Scalar:
+			key.push_back('S');
+			appendCoalescingKey(key, value.get<response::ScalarType>());
+			break;
 	}
-
-	co_return key;
 }
 
-AwaitableUnsubscribe Request::unsubscribe(RequestUnsubscribeParams params)
+RequestCoalescer::RequestCoalescer(std::shared_ptr<const Request> service)
+	: _service { std::move(service) }
 {
-	const auto spThis = shared_from_this();
-	std::unique_lock lock { spThis->_subscriptionMutex };
-	const auto itrOperation = spThis->_operations.find(strSubscription);
+}
 
-	if (itrOperation == _operations.end())
+void RequestCoalescer::Waiter::resume() noexcept
+{
+	if (!resumed.exchange(true))
 	{
-		// There may be an empty entry in the operations map, but if it's completely missing
-		// then that means the schema doesn't support subscriptions at all.
-		throw std::logic_error("Subscriptions not supported");
+		handle.resume();
 	}
+}
 
-	const auto optionalOrDefaultSubscription =
-		params.subscriptionObject ? std::move(params.subscriptionObject) : itrOperation->second;
-	std::list<schema_error> errors {};
-
-	if (optionalOrDefaultSubscription)
-	{
-		const auto registration = spThis->_subscriptions.at(params.key);
-		const SelectionSetParams selectionSetParams {
-			ResolverContext::NotifyUnsubscribe,
-			registration->data->state,
-			registration->data->directives,
-			std::make_shared<FragmentDefinitionDirectiveStack>(),
-			std::make_shared<FragmentSpreadDirectiveStack>(),
-			std::make_shared<FragmentSpreadDirectiveStack>(),
-			{},
-			params.launch,
-		};
-
-		lock.unlock();
-
-		co_await params.launch;
-		errors = std::move((co_await optionalOrDefaultSubscription->resolve(selectionSetParams,
-								registration->selection,
-								registration->data->fragments,
-								registration->data->variables))
-							   .errors);
-
-		lock.lock();
-	}
+void RequestCoalescer::ResumeWaiter::operator()() const noexcept
+{
+	waiter->resume();
+}
 
-	spThis->removeSubscription(params.key);
+RequestCoalescer::Wait::Wait(RequestCoalescer& coalescer, std::shared_ptr<InFlight> inFlight,
+	const RequestCancellation& cancellation) noexcept
+	: _coalescer { coalescer }
+	, _inFlight { std::move(inFlight) }
+	, _cancellation { cancellation }
+	, _waiter { std::make_shared<Waiter>() }
+{
+}
 
-	if (!errors.empty())
+RequestCoalescer::Wait::~Wait()
+{
+	if (_deadlineArmed)
 	{
-		throw schema_exception { std::move(errors) };
+		_coalescer.disarmDeadline(*_waiter);
 	}
+}
 
-	co_return;
+bool RequestCoalescer::Wait::await_ready() const noexcept
+{
+	return _inFlight->ready || _cancellation.stopRequested();
 }
 
-AwaitableDeliver Request::deliver(RequestDeliverParams params) const
+bool RequestCoalescer::Wait::await_suspend(coro::coroutine_handle<> h)
 {
-	const auto itrOperation = _operations.find(strSubscription);
+	// Either of them may resume the coroutine and destroy this Wait on another thread as soon as
+	// the Waiter is armed, so only use these copies after that.
+	const auto inFlight = _inFlight;
+	const auto waiter = _waiter;
+	const auto stopToken = _cancellation.stopToken;
+	const auto deadline = _cancellation.deadline;
 
-	if (itrOperation == _operations.end())
+	waiter->handle = h;
+
+	// The Waiter is not armed yet, so these do nothing if the stop was already requested or the
+	// deadline already passed. That's checked again below, after the Waiter is armed.
+	_stopCallback.emplace(stopToken, ResumeWaiter { waiter });
+
+	if (deadline)
 	{
-		// There may be an empty entry in the operations map, but if it's completely missing
-		// then that means the schema doesn't support subscriptions at all.
-		throw std::logic_error("Subscriptions not supported");
+		_deadlineArmed = true;
+		_coalescer.armDeadline(*deadline, waiter);
 	}
 
-	const auto optionalOrDefaultSubscription =
-		params.subscriptionObject ? std::move(params.subscriptionObject) : itrOperation->second;
+	waiter->resumed = false;
 
-	if (!optionalOrDefaultSubscription)
+	std::lock_guard lock { inFlight->mutex };
+
+	if (inFlight->ready || stopToken.stop_requested()
+		|| (deadline && std::chrono::steady_clock::now() >= *deadline))
 	{
-		// If there is no default in the operations map, you must pass a non-empty
-		// subscriptionObject parameter to deliver.
-		throw std::invalid_argument("Missing subscriptionObject");
+		// Don't suspend unless the stop callback already claimed it.
+		return waiter->resumed.exchange(true);
 	}
 
-	const auto registrations = collectRegistrations(params.field, std::move(params.filter));
+	inFlight->waiters.push_back(waiter);
+	return true;
+}
 
-	if (registrations.empty())
+std::shared_ptr<const response::Value> RequestCoalescer::Wait::await_resume() const
+{
+	if (!_inFlight->ready)
 	{
-		co_return;
+		return nullptr;
 	}
 
-	for (const auto& registration : registrations)
+	if (_inFlight->exception)
 	{
-		const SelectionSetParams selectionSetParams {
-			ResolverContext::Subscription,
-			registration->data->state,
-			registration->data->directives,
-			std::make_shared<FragmentDefinitionDirectiveStack>(),
-			std::make_shared<FragmentSpreadDirectiveStack>(),
-			std::make_shared<FragmentSpreadDirectiveStack>(),
-			std::nullopt,
-			params.launch,
-		};
-
-		response::Value document { response::Type::Map };
-
-		try
-		{
-			co_await params.launch;
+		std::rethrow_exception(_inFlight->exception);
+	}
 
-			auto result = co_await optionalOrDefaultSubscription->resolve(selectionSetParams,
-				registration->selection,
-				registration->data->fragments,
-				registration->data->variables);
+	return _inFlight->result;
+}
 
-			document.emplace_back(std::string { strData }, std::move(result.data));
+void RequestCoalescer::armDeadline(
+	std::chrono::steady_clock::time_point deadline, const std::shared_ptr<Waiter>& waiter)
+{
+	std::lock_guard lock { _deadlineMutex };
 
-			if (!result.errors.empty())
-			{
-				document.emplace_back(std::string { strErrors },
-					buildErrorValues(std::move(result.errors)));
-			}
-		}
-		catch (schema_exception& ex)
-		{
-			document.emplace_back(std::string { strData }, response::Value());
-			document.emplace_back(std::string { strErrors }, ex.getErrors());
-		}
+	waiter->deadline = _deadlines.emplace(deadline, waiter);
 
-		registration->callback(std::move(document));
+	if (!_deadlineThread.joinable())
+	{
+		_deadlineThread = std::jthread { [this](std::stop_token stopToken) {
+			resumeExpiredWaiters(std::move(stopToken));
+		} };
 	}
 
-	co_return;
+	_deadlineCondition.notify_one();
 }
 
-SubscriptionKey Request::addSubscription(RequestSubscribeParams&& params)
+void RequestCoalescer::disarmDeadline(Waiter& waiter) noexcept
 {
-	auto errors = validate(params.query);
+	std::lock_guard lock { _deadlineMutex };
 
-	if (!errors.empty())
+	if (waiter.deadline)
 	{
-		throw schema_exception { std::move(errors) };
+		_deadlines.erase(*waiter.deadline);
+		waiter.deadline.reset();
 	}
+}
 
-	FragmentDefinitionVisitor fragmentVisitor(params.variables);
-
-	peg::for_each_child<peg::fragment_definition>(*params.query.root,
-		[&fragmentVisitor](const peg::ast_node& child) {
-			fragmentVisitor.visit(child);
-		});
-
-	auto fragments = fragmentVisitor.getFragments();
-	auto [operationType, operationDefinition] =
-		findOperationDefinition(params.query, params.operationName);
+void RequestCoalescer::resumeExpiredWaiters(std::stop_token stopToken)
+{
+	std::unique_lock lock { _deadlineMutex };
 
-	if (!operationDefinition)
+	while (!stopToken.stop_requested())
 	{
-		std::ostringstream message;
-
-		message << "Missing subscription";
-
-		if (!params.operationName.empty())
+		if (_deadlines.empty())
 		{
-			message << " name: " << params.operationName;
+			_deadlineCondition.wait(lock, stopToken, [this]() noexcept {
+				return !_deadlines.empty();
+			});
+			continue;
 		}
 
-		throw schema_exception { { message.str() } };
-	}
-	else if (operationType != strSubscription)
-	{
-		auto position = operationDefinition->begin();
-		std::ostringstream message;
-
-		message << "Unexpected operation type: " << operationType;
+		const auto next = _deadlines.begin()->first;
 
-		if (!params.operationName.empty())
+		if (std::chrono::steady_clock::now() < next)
 		{
-			message << " name: " << params.operationName;
+			// Wake up early if an earlier deadline is armed in the meantime.
+			_deadlineCondition.wait_until(lock, stopToken, next, [this, next]() noexcept {
+				return _deadlines.empty() || _deadlines.begin()->first < next;
+			});
+			continue;
 		}
 
-		throw schema_exception {
-			{ schema_error { message.str(), { position.line, position.column } } }
-		};
-	}
-
-	auto itr = _operations.find(strSubscription);
-	SubscriptionDefinitionVisitor subscriptionVisitor(std::move(params),
-		std::move(fragments),
-		itr->second);
-
-	peg::for_each_child<peg::operation_definition>(subscriptionVisitor.getRoot(),
-		[&subscriptionVisitor](const peg::ast_node& child) {
-			subscriptionVisitor.visit(child);
-		});
-
-	auto registration = subscriptionVisitor.getRegistration();
-	auto key = _nextKey++;
+		auto waiter = std::move(_deadlines.begin()->second);
 
-	_listeners[registration->field].emplace(key);
-	_subscriptions.emplace(key, std::move(registration));
+		_deadlines.erase(_deadlines.begin());
+		waiter->deadline.reset();
 
-	return key;
+		// The waiter may finish and disarm its own deadline on this thread.
+		lock.unlock();
+		waiter->resume();
+		lock.lock();
+	}
 }
 
-void Request::removeSubscription(SubscriptionKey key)
+internal::Awaitable<void> RequestCoalescer::resolveInFlight(std::string key,
+	std::shared_ptr<InFlight> inFlight, peg::ast query, std::string operationName,
+	RequestResolveParams params)
 {
-	auto itrSubscription = _subscriptions.find(key);
+	RequestResolveParams sharedParams { query,
+		operationName,
+		std::move(params.variables),
+		std::move(params.launch),
+		std::move(params.state),
+		std::move(params.fragments),
+		{},
+		std::move(params.instrumentation),
+		params.listGrainSize };
+	std::shared_ptr<const response::Value> result;
+	std::exception_ptr exception;
 
-	if (itrSubscription == _subscriptions.end())
+	try
 	{
-		return;
+		result = std::make_shared<const response::Value>(
+			co_await _service->resolve(std::move(sharedParams)));
+	}
+	catch (...)
+	{
+		exception = std::current_exception();
 	}
 
-	const auto listenerKey = std::string_view { itrSubscription->second->field };
-	auto& listener = _listeners.at(listenerKey);
-
-	listener.erase(key);
-	if (listener.empty())
 	{
-		_listeners.erase(listenerKey);
+		// Identical requests which arrive after this start over with a new resolution.
+		std::lock_guard lock { _mutex };
+
+		_inFlight.erase(key);
 	}
 
-	_subscriptions.erase(itrSubscription);
+	std::vector<std::shared_ptr<Waiter>> waiters;
 
-	if (_subscriptions.empty())
 	{
-		_nextKey = 0;
+		std::lock_guard lock { inFlight->mutex };
+
+		inFlight->result = std::move(result);
+		inFlight->exception = exception;
+		inFlight->ready = true;
+		waiters.swap(inFlight->waiters);
 	}
-	else
+
+	// Each waiter hops back onto its own launch policy as soon as it resumes.
+	for (const auto& waiter : waiters)
 	{
-		_nextKey = _subscriptions.rbegin()->first + 1;
+		waiter->resume();
 	}
 }
 
-std::vector<std::shared_ptr<const SubscriptionData>> Request::collectRegistrations(
-	std::string_view field, RequestDeliverFilter&& filter) const noexcept
+response::AwaitableValue RequestCoalescer::resolve(
+	std::string_view documentKey, std::string_view partition, RequestResolveParams params)
 {
-	std::vector<std::shared_ptr<const SubscriptionData>> registrations;
-	const std::lock_guard lock { _subscriptionMutex };
-	const auto itrListeners = _listeners.find(field);
+	bool isQuery = false;
 
-	if (itrListeners != _listeners.end())
+	try
 	{
-		if (!filter)
-		{
-			// Return all of the registered subscriptions for this field.
-			registrations.reserve(itrListeners->second.size());
-			std::transform(itrListeners->second.begin(),
-				itrListeners->second.end(),
-				std::back_inserter(registrations),
-				[this](const auto& key) noexcept {
-					const auto itr = _subscriptions.find(key);
-
-					return itr == _subscriptions.end() ? std::shared_ptr<const SubscriptionData> {}
-													   : itr->second;
-				});
-		}
-		else if (std::holds_alternative<SubscriptionKey>(*filter))
-		{
-			// Return the specific subscription for this key.
-			const auto itr = _subscriptions.find(std::get<SubscriptionKey>(*filter));
+		isQuery = _service->findOperationDefinition(params.query, params.operationName).first
+			== strQuery;
+	}
+	catch (const schema_exception&)
+	{
+		// Let Request::resolve report the validation errors.
+	}
 
-			if (itr != _subscriptions.end() && itr->second->field == field)
-			{
-				registrations.push_back(itr->second);
-			}
-		}
-		else if (std::holds_alternative<SubscriptionFilter>(*filter))
-		{
-			auto& subscriptionFilter = std::get<SubscriptionFilter>(*filter);
+	if (!isQuery)
+	{
+		co_return co_await _service->resolve(std::move(params));
+	}
 
-			registrations.reserve(itrListeners->second.size());
+	std::string key;
 
-			std::optional<SubscriptionArgumentFilterCallback> argumentsMatch;
+	appendCoalescingKey(key, documentKey);
+	appendCoalescingKey(key, params.operationName);
+	appendCoalescingKey(key, partition);
+	appendCoalescingKey(key, params.variables);
 
-			if (subscriptionFilter.arguments)
-			{
-				if (std::holds_alternative<SubscriptionArguments>(*subscriptionFilter.arguments))
-				{
-					argumentsMatch = [arguments = std::move(std::get<SubscriptionArguments>(
-										  *subscriptionFilter.arguments))](
-										 response::MapType::const_reference required) noexcept {
-						auto itrArgument = arguments.find(required.first);
-
-						return (itrArgument != arguments.end()
-							&& itrArgument->second == required.second);
-					};
-				}
-				else if (std::holds_alternative<SubscriptionArgumentFilterCallback>(
-							 *subscriptionFilter.arguments))
-				{
-					argumentsMatch = std::move(std::get<SubscriptionArgumentFilterCallback>(
-						*subscriptionFilter.arguments));
-				}
-			}
+	std::shared_ptr<InFlight> inFlight;
+	bool first = false;
 
-			std::optional<SubscriptionDirectiveFilterCallback> directivesMatch;
+	{
+		std::lock_guard lock { _mutex };
+		auto [itr, inserted] = _inFlight.try_emplace(key);
 
-			if (subscriptionFilter.directives)
-			{
-				if (std::holds_alternative<Directives>(*subscriptionFilter.directives))
-				{
-					directivesMatch = [directives = std::move(
-										   std::get<Directives>(*subscriptionFilter.directives))](
-										  Directives::const_reference required) noexcept {
-						auto itrDirective = std::find_if(directives.cbegin(),
-							directives.cend(),
-							[directiveName = required.first](const auto& directive) noexcept {
-								return directive.first == directiveName;
-							});
-
-						return (itrDirective != directives.end()
-							&& itrDirective->second == required.second);
-					};
-				}
-				else if (std::holds_alternative<SubscriptionDirectiveFilterCallback>(
-							 *subscriptionFilter.directives))
-				{
-					directivesMatch = std::move(std::get<SubscriptionDirectiveFilterCallback>(
-						*subscriptionFilter.directives));
-				}
-			}
+		if (inserted)
+		{
+			itr->second = std::make_shared<InFlight>();
+			++_resolved;
+		}
+		else
+		{
+			++_coalesced;
+		}
 
-			for (const auto& key : itrListeners->second)
-			{
-				auto itrSubscription = _subscriptions.find(key);
-				auto registration = itrSubscription->second;
+		inFlight = itr->second;
+		first = inserted;
+	}
 
-				if (argumentsMatch)
-				{
-					const auto& subscriptionArguments = registration->arguments;
-					bool matchedArguments = true;
+	const auto cancellation = std::move(params.cancellation);
+	auto launch = params.launch;
 
-					// If the field in this subscription had arguments that did not match what
-					// was provided in this event, don't deliver the event to this subscription
-					for (const auto& required : subscriptionArguments)
-					{
-						if (!(*argumentsMatch)(required))
-						{
-							matchedArguments = false;
-							break;
-						}
-					}
+	if (first)
+	{
+		auto query = params.query;
+		std::string operationName { params.operationName };
+
+		// Abandoning the Awaitable lets it finish on its own after this caller stops waiting.
+		static_cast<void>(resolveInFlight(std::move(key),
+			inFlight,
+			std::move(query),
+			std::move(operationName),
+			std::move(params)));
+	}
 
-					if (!matchedArguments)
-					{
-						continue;
-					}
-				}
+	auto result = co_await Wait { *this, std::move(inFlight), cancellation };
 
-				if (directivesMatch)
-				{
-					// If the field in this subscription had field directives that did not match
-					// what was provided in this event, don't deliver the event to this
-					// subscription
-					const auto& subscriptionFieldDirectives = registration->fieldDirectives;
-					bool matchedFieldDirectives = true;
+	co_await launch;
 
-					for (const auto& required : subscriptionFieldDirectives)
-					{
-						if (!(*directivesMatch)(required))
-						{
-							matchedFieldDirectives = false;
-							break;
-						}
-					}
+	if (!result || cancellation.stopRequested())
+	{
+		response::Value document { response::Type::Map };
 
-					if (!matchedFieldDirectives)
-					{
-						continue;
-					}
-				}
+		document.emplace_back(std::string { strData }, response::Value {});
+		document.emplace_back(std::string { strErrors },
+			buildErrorValues({ cancellation.getError({}, {}) }));
 
-				registrations.push_back(std::move(registration));
-			}
-		}
+		co_return std::move(document);
 	}
 
-	return registrations;
+	co_return response::Value { std::move(result) };
+}
+
+RequestCoalescerStats RequestCoalescer::getStats() const
+{
+	std::lock_guard lock { _mutex };
+
+	return { _resolved, _coalesced, _inFlight.size() };
 }
 
 } // namespace graphql::service
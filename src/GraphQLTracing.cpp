@@ -0,0 +1,259 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "graphqlservice/GraphQLTracing.h"
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+using namespace std::literals;
+
+namespace graphql::service {
+
+std::chrono::nanoseconds FieldLatency::percentile(double fraction) const noexcept
+{
+	if (count == 0)
+	{
+		return {};
+	}
+
+	const auto target = std::max(size_t { 1 },
+		static_cast<size_t>(
+			std::ceil(std::clamp(fraction, 0.0, 1.0) * static_cast<double>(count))));
+	size_t seen = 0;
+
+	for (size_t i = 0; i + 1 < buckets.size(); ++i)
+	{
+		seen += buckets[i];
+
+		if (seen >= target)
+		{
+			return std::clamp<std::chrono::nanoseconds>(
+				std::chrono::microseconds { std::chrono::microseconds::rep { 1 } << i },
+				min,
+				max);
+		}
+	}
+
+	return max;
+}
+
+void FieldLatencyHistogram::record(std::string_view typeName, std::string_view fieldName,
+	std::chrono::steady_clock::duration duration)
+{
+	const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration);
+	const auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(duration);
+	size_t bucket = 0;
+
+	while (bucket + 1 < FieldLatency::c_bucketCount
+		&& microseconds.count() >= (std::chrono::microseconds::rep { 1 } << bucket))
+	{
+		++bucket;
+	}
+
+	const std::lock_guard lock { _mutex };
+	auto itrType = _latencies.find(typeName);
+
+	if (itrType == _latencies.end())
+	{
+		itrType = _latencies.emplace(std::string { typeName }, FieldLatencies::mapped_type {})
+					  .first;
+	}
+
+	auto itrField = itrType->second.find(fieldName);
+
+	if (itrField == itrType->second.end())
+	{
+		itrField = itrType->second.emplace(std::string { fieldName }, FieldLatency {}).first;
+	}
+
+	auto& latency = itrField->second;
+
+	++latency.count;
+	latency.total += nanoseconds;
+	latency.min = std::min(latency.min, nanoseconds);
+	latency.max = std::max(latency.max, nanoseconds);
+	++latency.buckets[bucket];
+}
+
+FieldLatencyHistogram::FieldLatencies FieldLatencyHistogram::getLatencies() const
+{
+	const std::lock_guard lock { _mutex };
+
+	return _latencies;
+}
+
+TracingInstrumentation::TracingInstrumentation(
+	std::shared_ptr<FieldLatencyHistogram> histogram, bool tracing)
+	: _histogram { std::move(histogram) }
+	, _tracing { tracing }
+	, _startTime { std::chrono::system_clock::now() }
+	, _start { std::chrono::steady_clock::now() }
+{
+}
+
+TracingInstrumentation::Timing TracingInstrumentation::getTiming(
+	std::chrono::steady_clock::duration duration) const noexcept
+{
+	// The caller may measure the Parse phase from before this was constructed.
+	return { std::max(std::chrono::steady_clock::now() - duration - _start,
+				 std::chrono::steady_clock::duration::zero()),
+		duration };
+}
+
+void TracingInstrumentation::endPhase(
+	RequestPhase phase, std::chrono::steady_clock::duration duration)
+{
+	if (!_tracing)
+	{
+		return;
+	}
+
+	const auto timing = getTiming(duration);
+	const std::lock_guard lock { _mutex };
+
+	_phases[static_cast<size_t>(phase)] = timing;
+}
+
+void TracingInstrumentation::endField(std::string_view typeName, std::string_view fieldName,
+	const error_path& path, std::chrono::steady_clock::duration duration)
+{
+	if (_histogram)
+	{
+		_histogram->record(typeName, fieldName, duration);
+	}
+
+	if (!_tracing)
+	{
+		return;
+	}
+
+	ResolverTiming resolver { getTiming(duration),
+		response::Value { response::Type::List },
+		std::string { typeName },
+		std::string { fieldName } };
+
+	resolver.path.reserve(path.size());
+
+	for (const auto& segment : path)
+	{
+		if (std::holds_alternative<std::string_view>(segment))
+		{
+			resolver.path.emplace_back(
+				response::Value { std::string { std::get<std::string_view>(segment) } });
+		}
+		else if (std::holds_alternative<size_t>(segment))
+		{
+			resolver.path.emplace_back(response::Value(static_cast<int>(std::get<size_t>(segment))));
+		}
+	}
+
+	const std::lock_guard lock { _mutex };
+
+	_resolvers.push_back(std::move(resolver));
+}
+
+// Durations are reported in nanoseconds, which only fit in an Int for about 2 seconds.
+response::Value toNanoseconds(std::chrono::steady_clock::duration duration)
+{
+	const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+
+	if (nanoseconds <= std::numeric_limits<int>::max())
+	{
+		return response::Value(static_cast<int>(nanoseconds));
+	}
+
+	return response::Value(static_cast<double>(nanoseconds));
+}
+
+// Format an RFC 3339 timestamp in UTC with millisecond precision.
+response::Value toTimestamp(std::chrono::system_clock::time_point time)
+{
+	const auto seconds = std::chrono::system_clock::to_time_t(time);
+	const auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(
+		time.time_since_epoch() % std::chrono::seconds { 1 });
+	std::tm utc {};
+
+#ifdef _WIN32
+	gmtime_s(&utc, &seconds);
+#else  // !_WIN32
+	gmtime_r(&seconds, &utc);
+#endif // !_WIN32
+
+	std::ostringstream oss;
+
+	oss << std::put_time(&utc, "%Y-%m-%dT%H:%M:%S") << '.' << std::setfill('0') << std::setw(3)
+		<< milliseconds.count() << 'Z';
+
+	return response::Value { oss.str() };
+}
+
+response::Value TracingInstrumentation::getExtensions()
+{
+	if (!_tracing)
+	{
+		return {};
+	}
+
+	const auto duration = std::chrono::steady_clock::now() - _start;
+	const std::lock_guard lock { _mutex };
+	response::Value tracing { response::Type::Map };
+
+	tracing.emplace_back("version"s, response::Value(1));
+	tracing.emplace_back("startTime"s, toTimestamp(_startTime));
+	tracing.emplace_back("endTime"s,
+		toTimestamp(_startTime
+			+ std::chrono::duration_cast<std::chrono::system_clock::duration>(duration)));
+	tracing.emplace_back("duration"s, toNanoseconds(duration));
+
+	constexpr std::array phaseNames { "parsing"sv, "validation"sv };
+
+	for (size_t i = 0; i < phaseNames.size(); ++i)
+	{
+		if (!_phases[i])
+		{
+			continue;
+		}
+
+		response::Value phase { response::Type::Map };
+
+		phase.emplace_back("startOffset"s, toNanoseconds(_phases[i]->startOffset));
+		phase.emplace_back("duration"s, toNanoseconds(_phases[i]->duration));
+		tracing.emplace_back(std::string { phaseNames[i] }, std::move(phase));
+	}
+
+	response::Value resolvers { response::Type::List };
+
+	resolvers.reserve(_resolvers.size());
+
+	for (auto& resolver : _resolvers)
+	{
+		response::Value entry { response::Type::Map };
+
+		entry.emplace_back("path"s, std::move(resolver.path));
+		entry.emplace_back("parentType"s, response::Value { std::move(resolver.parentType) });
+		entry.emplace_back("fieldName"s, response::Value { std::move(resolver.fieldName) });
+		entry.emplace_back("startOffset"s, toNanoseconds(resolver.startOffset));
+		entry.emplace_back("duration"s, toNanoseconds(resolver.duration));
+		resolvers.emplace_back(std::move(entry));
+	}
+
+	_resolvers.clear();
+
+	response::Value execution { response::Type::Map };
+
+	execution.emplace_back("resolvers"s, std::move(resolvers));
+	tracing.emplace_back("execution"s, std::move(execution));
+
+	response::Value extensions { response::Type::Map };
+
+	extensions.emplace_back("tracing"s, std::move(tracing));
+
+	return extensions;
+}
+
+} // namespace graphql::service
@@ -14,8 +14,247 @@
 
 namespace graphql::introspection {
 
+// Use the shared wrapper for a type if the ObjectCache is still alive, otherwise wrap it again.
+std::shared_ptr<object::Type> getTypeObject(const std::weak_ptr<object::Type>& cached,
+	const std::shared_ptr<const schema::BaseType>& type)
+{
+	if (auto result = cached.lock())
+	{
+		return result;
+	}
+
+	return type ? std::make_shared<object::Type>(std::make_shared<Type>(type)) : nullptr;
+}
+
+// Lock each of the shared wrappers, or return std::nullopt if any of them have expired.
+std::optional<std::vector<std::shared_ptr<object::Type>>> lockTypes(
+	const std::vector<std::weak_ptr<object::Type>>& types)
+{
+	auto result = std::make_optional<std::vector<std::shared_ptr<object::Type>>>();
+
+	result->reserve(types.size());
+
+	for (const auto& entry : types)
+	{
+		auto type = entry.lock();
+
+		if (!type)
+		{
+			return std::nullopt;
+		}
+
+		result->push_back(std::move(type));
+	}
+
+	return result;
+}
+
+ObjectCache::ObjectCache(const schema::Schema& schema)
+	: _revision { schema.revision() }
+{
+	const auto& types = schema.types();
+
+	_types.reserve(types.size());
+
+	for (const auto& entry : types)
+	{
+		_types.push_back(wrapType(entry.second));
+	}
+
+	const auto& directives = schema.directives();
+
+	_directives.reserve(directives.size());
+
+	for (const auto& directive : directives)
+	{
+		auto wrapped = std::make_shared<Directive>(directive);
+
+		wrapped->_args = wrapInputValues(directive->args());
+		wrapped->_cached = true;
+		_directives.push_back(std::make_shared<object::Directive>(std::move(wrapped)));
+	}
+
+	// Filling in a type may wrap more LIST and NON_NULL types, which are appended to the end.
+	for (size_t i = 0; i < _unfilled.size(); ++i)
+	{
+		const auto type = _unfilled[i];
+
+		fillType(*type);
+	}
+
+	_unfilled.clear();
+	_unfilled.shrink_to_fit();
+}
+
+std::shared_ptr<const ObjectCache> ObjectCache::get(schema::Schema& schema)
+{
+	const auto revision = schema.revision();
+
+	{
+		// Every request after the first one for this revision only needs a shared_lock.
+		std::shared_lock shared_lock { schema._introspectionMutex };
+
+		if (schema._introspectionCache && schema._introspectionCache->revision() == revision)
+		{
+			return schema._introspectionCache;
+		}
+	}
+
+	std::unique_lock unique_lock { schema._introspectionMutex };
+
+	// Another request may have rebuilt it while we were waiting for the unique_lock.
+	if (!schema._introspectionCache
+		|| schema._introspectionCache->revision() != schema.revision())
+	{
+		schema._introspectionCache = std::make_shared<const ObjectCache>(schema);
+	}
+
+	return schema._introspectionCache;
+}
+
+size_t ObjectCache::revision() const noexcept
+{
+	return _revision;
+}
+
+const std::vector<std::shared_ptr<object::Type>>& ObjectCache::types() const noexcept
+{
+	return _types;
+}
+
+const std::vector<std::shared_ptr<object::Directive>>& ObjectCache::directives() const noexcept
+{
+	return _directives;
+}
+
+std::shared_ptr<object::Type> ObjectCache::lookupType(
+	const std::shared_ptr<const schema::BaseType>& type) const
+{
+	if (!type)
+	{
+		return nullptr;
+	}
+
+	const auto itr = _objects.find(type.get());
+
+	return itr == _objects.end() ? std::make_shared<object::Type>(std::make_shared<Type>(type))
+								 : itr->second;
+}
+
+std::shared_ptr<object::Type> ObjectCache::wrapType(
+	const std::shared_ptr<const schema::BaseType>& type)
+{
+	if (!type)
+	{
+		return nullptr;
+	}
+
+	auto& result = _objects[type.get()];
+
+	if (!result)
+	{
+		auto wrapped = std::make_shared<Type>(type);
+
+		result = std::make_shared<object::Type>(wrapped);
+		_unfilled.push_back(std::move(wrapped));
+	}
+
+	return result;
+}
+
+std::vector<std::shared_ptr<object::InputValue>> ObjectCache::wrapInputValues(
+	const std::vector<std::shared_ptr<const schema::InputValue>>& inputValues)
+{
+	std::vector<std::shared_ptr<object::InputValue>> result;
+
+	result.reserve(inputValues.size());
+
+	for (const auto& inputValue : inputValues)
+	{
+		auto wrapped = std::make_shared<InputValue>(inputValue);
+
+		wrapped->_typeObject = wrapType(inputValue->type().lock());
+		result.push_back(std::make_shared<object::InputValue>(std::move(wrapped)));
+	}
+
+	return result;
+}
+
+void ObjectCache::fillType(Type& type)
+{
+	const auto kind = type._type->kind();
+
+	if (kind == TypeKind::OBJECT || kind == TypeKind::INTERFACE)
+	{
+		const auto& fields = type._type->fields();
+
+		type._fields.reserve(fields.size());
+
+		for (const auto& field : fields)
+		{
+			auto wrapped = std::make_shared<Field>(field);
+
+			wrapped->_args = wrapInputValues(field->args());
+			wrapped->_typeObject = wrapType(field->type().lock());
+			wrapped->_cached = true;
+			type._fields.push_back(std::make_shared<object::Field>(std::move(wrapped)));
+		}
+	}
+
+	if (kind == TypeKind::OBJECT)
+	{
+		const auto& interfaces = type._type->interfaces();
+
+		type._interfaces.reserve(interfaces.size());
+
+		for (const auto& entry : interfaces)
+		{
+			type._interfaces.push_back(wrapType(entry));
+		}
+	}
+
+	if (kind == TypeKind::INTERFACE || kind == TypeKind::UNION)
+	{
+		for (const auto& entry : type._type->possibleTypes())
+		{
+			auto possibleType = entry.lock();
+
+			if (possibleType && possibleType->kind() == TypeKind::OBJECT)
+			{
+				type._possibleTypes.push_back(wrapType(possibleType));
+			}
+		}
+	}
+
+	if (kind == TypeKind::ENUM)
+	{
+		const auto& enumValues = type._type->enumValues();
+
+		type._enumValues.reserve(enumValues.size());
+
+		for (const auto& value : enumValues)
+		{
+			type._enumValues.push_back(
+				std::make_shared<object::EnumValue>(std::make_shared<EnumValue>(value)));
+		}
+	}
+
+	if (kind == TypeKind::INPUT_OBJECT)
+	{
+		type._inputFields = wrapInputValues(type._type->inputFields());
+	}
+
+	if (kind == TypeKind::LIST || kind == TypeKind::NON_NULL)
+	{
+		type._ofType = wrapType(type._type->ofType().lock());
+	}
+
+	type._cached = true;
+}
+
 Schema::Schema(const std::shared_ptr<schema::Schema>& schema)
 	: _schema(schema)
+	, _cache(ObjectCache::get(*schema))
 {
 }
 
@@ -28,50 +267,27 @@ std::optional<std::string> Schema::getDescription() const
 
 std::vector<std::shared_ptr<object::Type>> Schema::getTypes() const
 {
-	const auto& types = _schema->types();
-	std::vector<std::shared_ptr<object::Type>> result(types.size());
-
-	std::transform(types.begin(), types.end(), result.begin(), [](const auto& entry) {
-		return std::make_shared<object::Type>(std::make_shared<Type>(entry.second));
-	});
-
-	return result;
+	return _cache->types();
 }
 
 std::shared_ptr<object::Type> Schema::getQueryType() const
 {
-	const auto& queryType = _schema->queryType();
-
-	return queryType ? std::make_shared<object::Type>(std::make_shared<Type>(queryType)) : nullptr;
+	return _cache->lookupType(_schema->queryType());
 }
 
 std::shared_ptr<object::Type> Schema::getMutationType() const
 {
-	const auto& mutationType = _schema->mutationType();
-
-	return mutationType ? std::make_shared<object::Type>(std::make_shared<Type>(mutationType))
-						: nullptr;
+	return _cache->lookupType(_schema->mutationType());
 }
 
 std::shared_ptr<object::Type> Schema::getSubscriptionType() const
 {
-	const auto& subscriptionType = _schema->subscriptionType();
-
-	return subscriptionType
-		? std::make_shared<object::Type>(std::make_shared<Type>(subscriptionType))
-		: nullptr;
+	return _cache->lookupType(_schema->subscriptionType());
 }
 
 std::vector<std::shared_ptr<object::Directive>> Schema::getDirectives() const
 {
-	const auto& directives = _schema->directives();
-	std::vector<std::shared_ptr<object::Directive>> result(directives.size());
-
-	std::transform(directives.begin(), directives.end(), result.begin(), [](const auto& entry) {
-		return std::make_shared<object::Directive>(std::make_shared<Directive>(entry));
-	});
-
-	return result;
+	return _cache->directives();
 }
 
 Type::Type(const std::shared_ptr<const schema::BaseType>& type)
@@ -113,14 +329,19 @@ std::optional<std::vector<std::shared_ptr<object::Field>>> Type::getFields(
 
 	const auto& fields = _type->fields();
 	const bool deprecated = includeDeprecatedArg && *includeDeprecatedArg;
+	const bool cached = _cached && _fields.size() == fields.size();
 	auto result = std::make_optional<std::vector<std::shared_ptr<object::Field>>>();
 
 	result->reserve(fields.size());
-	for (const auto& field : fields)
+	for (size_t i = 0; i < fields.size(); ++i)
 	{
+		const auto& field = fields[i];
+
 		if (deprecated || !field->deprecationReason())
 		{
-			result->push_back(std::make_shared<object::Field>(std::make_shared<Field>(field)));
+			result->push_back(cached
+					? _fields[i]
+					: std::make_shared<object::Field>(std::make_shared<Field>(field)));
 		}
 	}
 
@@ -138,6 +359,14 @@ std::optional<std::vector<std::shared_ptr<object::Type>>> Type::getInterfaces()
 			return std::nullopt;
 	}
 
+	if (_cached)
+	{
+		if (auto result = lockTypes(_interfaces))
+		{
+			return result;
+		}
+	}
+
 	const auto& interfaces = _type->interfaces();
 	auto result = std::make_optional<std::vector<std::shared_ptr<object::Type>>>(interfaces.size());
 
@@ -160,6 +389,14 @@ std::optional<std::vector<std::shared_ptr<object::Type>>> Type::getPossibleTypes
 			return std::nullopt;
 	}
 
+	if (_cached)
+	{
+		if (auto result = lockTypes(_possibleTypes))
+		{
+			return result;
+		}
+	}
+
 	const auto& possibleTypes = _type->possibleTypes();
 	auto result =
 		std::make_optional<std::vector<std::shared_ptr<object::Type>>>(possibleTypes.size());
@@ -195,15 +432,19 @@ std::optional<std::vector<std::shared_ptr<object::EnumValue>>> Type::getEnumValu
 
 	const auto& enumValues = _type->enumValues();
 	const bool deprecated = includeDeprecatedArg && *includeDeprecatedArg;
+	const bool cached = _cached && _enumValues.size() == enumValues.size();
 	auto result = std::make_optional<std::vector<std::shared_ptr<object::EnumValue>>>();
 
 	result->reserve(enumValues.size());
-	for (const auto& value : enumValues)
+	for (size_t i = 0; i < enumValues.size(); ++i)
 	{
+		const auto& value = enumValues[i];
+
 		if (deprecated || !value->deprecationReason())
 		{
-			result->push_back(
-				std::make_shared<object::EnumValue>(std::make_shared<EnumValue>(value)));
+			result->push_back(cached
+					? _enumValues[i]
+					: std::make_shared<object::EnumValue>(std::make_shared<EnumValue>(value)));
 		}
 	}
 
@@ -222,6 +463,12 @@ std::optional<std::vector<std::shared_ptr<object::InputValue>>> Type::getInputFi
 	}
 
 	const auto& inputFields = _type->inputFields();
+
+	if (_cached && _inputFields.size() == inputFields.size())
+	{
+		return _inputFields;
+	}
+
 	auto result =
 		std::make_optional<std::vector<std::shared_ptr<object::InputValue>>>(inputFields.size());
 
@@ -244,9 +491,7 @@ std::shared_ptr<object::Type> Type::getOfType() const
 			return nullptr;
 	}
 
-	const auto ofType = _type->ofType().lock();
-
-	return ofType ? std::make_shared<object::Type>(std::make_shared<Type>(ofType)) : nullptr;
+	return getTypeObject(_ofType, _type->ofType().lock());
 }
 
 std::optional<std::string> Type::getSpecifiedByURL() const
@@ -277,6 +522,12 @@ std::optional<std::string> Field::getDescription() const
 std::vector<std::shared_ptr<object::InputValue>> Field::getArgs() const
 {
 	const auto& args = _field->args();
+
+	if (_cached && _args.size() == args.size())
+	{
+		return _args;
+	}
+
 	std::vector<std::shared_ptr<object::InputValue>> result(args.size());
 
 	std::transform(args.begin(), args.end(), result.begin(), [](const auto& entry) {
@@ -288,9 +539,7 @@ std::vector<std::shared_ptr<object::InputValue>> Field::getArgs() const
 
 std::shared_ptr<object::Type> Field::getType() const
 {
-	const auto type = _field->type().lock();
-
-	return type ? std::make_shared<object::Type>(std::make_shared<Type>(type)) : nullptr;
+	return getTypeObject(_typeObject, _field->type().lock());
 }
 
 bool Field::getIsDeprecated() const
@@ -325,9 +574,7 @@ std::optional<std::string> InputValue::getDescription() const
 
 std::shared_ptr<object::Type> InputValue::getType() const
 {
-	const auto type = _inputValue->type().lock();
-
-	return type ? std::make_shared<object::Type>(std::make_shared<Type>(type)) : nullptr;
+	return getTypeObject(_typeObject, _inputValue->type().lock());
 }
 
 std::optional<std::string> InputValue::getDefaultValue() const
@@ -392,6 +639,12 @@ std::vector<DirectiveLocation> Directive::getLocations() const
 std::vector<std::shared_ptr<object::InputValue>> Directive::getArgs() const
 {
 	const auto& args = _directive->args();
+
+	if (_cached && _args.size() == args.size())
+	{
+		return _args;
+	}
+
 	std::vector<std::shared_ptr<object::InputValue>> result(args.size());
 
 	std::transform(args.begin(), args.end(), result.begin(), [](const auto& entry) {
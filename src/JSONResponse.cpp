@@ -6,21 +6,26 @@
 #define RAPIDJSON_NAMESPACE graphql::rapidjson
 #include <rapidjson/rapidjson.h>
 
+#include <rapidjson/error/en.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/ostreamwrapper.h>
 #include <rapidjson/reader.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
 #include <limits>
+#include <sstream>
 #include <stdexcept>
 #include <vector>
 
 namespace graphql::response {
 
-class StringWriter
+template <class Stream>
+class StreamWriter
 {
 public:
-	StringWriter(rapidjson::StringBuffer& buffer)
-		: _writer { buffer }
+	StreamWriter(Stream& stream)
+		: _writer { stream }
 	{
 	}
 
@@ -31,7 +36,7 @@ public:
 
 	void add_member(const std::string& key)
 	{
-		_writer.Key(key.c_str());
+		_writer.Key(key.data(), static_cast<rapidjson::SizeType>(key.size()));
 	}
 
 	void end_object()
@@ -56,7 +61,7 @@ public:
 
 	void write_string(const std::string& value)
 	{
-		_writer.String(value.c_str());
+		_writer.String(value.data(), static_cast<rapidjson::SizeType>(value.size()));
 	}
 
 	void write_bool(bool value)
@@ -75,7 +80,33 @@ public:
 	}
 
 private:
-	rapidjson::Writer<rapidjson::StringBuffer> _writer;
+	rapidjson::Writer<Stream> _writer;
+};
+
+using StringWriter = StreamWriter<rapidjson::StringBuffer>;
+
+// The rapidjson::OStreamWrapper needs to be constructed before the rapidjson::Writer which
+// references it, so it's held in a base class which is initialized first.
+struct OStreamHolder
+{
+	OStreamHolder(std::ostream& stream)
+		: wrapper { stream }
+	{
+	}
+
+	rapidjson::OStreamWrapper wrapper;
+};
+
+class OStreamWriter
+	: private OStreamHolder
+	, public StreamWriter<rapidjson::OStreamWrapper>
+{
+public:
+	OStreamWriter(std::ostream& stream)
+		: OStreamHolder { stream }
+		, StreamWriter<rapidjson::OStreamWrapper> { wrapper }
+	{
+	}
 };
 
 std::string toJSON(Value&& response)
@@ -87,6 +118,11 @@ std::string toJSON(Value&& response)
 	return buffer.GetString();
 }
 
+Writer makeJSONWriter(std::ostream& stream)
+{
+	return { std::make_unique<OStreamWriter>(stream) };
+}
+
 struct ResponseHandler : rapidjson::BaseReaderHandler<rapidjson::UTF8<>, ResponseHandler>
 {
 	ResponseHandler()
@@ -158,9 +194,9 @@ struct ResponseHandler : rapidjson::BaseReaderHandler<rapidjson::UTF8<>, Respons
 		return true;
 	}
 
-	bool String(const Ch* str, rapidjson::SizeType /*length*/, bool /*copy*/)
+	bool String(const Ch* str, rapidjson::SizeType length, bool /*copy*/)
 	{
-		setValue(Value(std::string(str)).from_json());
+		setValue(Value(std::string(str, length)).from_json());
 		return true;
 	}
 
@@ -170,9 +206,9 @@ struct ResponseHandler : rapidjson::BaseReaderHandler<rapidjson::UTF8<>, Respons
 		return true;
 	}
 
-	bool Key(const Ch* str, rapidjson::SizeType /*length*/, bool /*copy*/)
+	bool Key(const Ch* str, rapidjson::SizeType length, bool /*copy*/)
 	{
-		_keyStack.push_back(str);
+		_keyStack.emplace_back(str, length);
 		return true;
 	}
 
@@ -218,15 +254,59 @@ private:
 	std::vector<Value> _responseStack;
 };
 
-Value parseJSON(const std::string& json)
+json_exception::json_exception(std::string_view message, size_t offset)
+	: std::runtime_error { getMessage(message, offset) }
+	, _offset { offset }
+{
+}
+
+size_t json_exception::offset() const noexcept
+{
+	return _offset;
+}
+
+std::string json_exception::getMessage(std::string_view message, size_t offset)
+{
+	std::ostringstream oss;
+
+	oss << "JSON parse error: " << message << " offset: " << offset;
+
+	return oss.str();
+}
+
+template <unsigned ParseFlags, class Stream>
+Value parseStream(Stream& stream, size_t size)
 {
 	ResponseHandler handler;
 	rapidjson::Reader reader;
-	rapidjson::StringStream ss(json.c_str());
+	const auto result = reader.Parse<ParseFlags>(stream, handler);
+
+	if (result.IsError())
+	{
+		throw json_exception { rapidjson::GetParseError_En(result.Code()), result.Offset() };
+	}
 
-	reader.Parse(ss, handler);
+	// RapidJSON stops at a null character, which is not valid JSON anywhere outside of a string.
+	if (stream.Tell() != size)
+	{
+		throw json_exception { "Unexpected null character.", stream.Tell() };
+	}
 
 	return handler.getResponse();
 }
 
+Value parseJSON(std::string_view json)
+{
+	rapidjson::MemoryStream stream { json.data(), json.size() };
+
+	return parseStream<rapidjson::kParseDefaultFlags>(stream, json.size());
+}
+
+Value parseJSONInSitu(std::string& json)
+{
+	rapidjson::InsituStringStream stream { json.data() };
+
+	return parseStream<rapidjson::kParseInsituFlag>(stream, json.size());
+}
+
 } // namespace graphql::response
@@ -20,22 +20,26 @@ Schema::Schema(bool noIntrospection, std::string_view description)
 void Schema::AddQueryType(std::shared_ptr<ObjectType> query)
 {
 	_query = query;
+	++_revision;
 }
 
 void Schema::AddMutationType(std::shared_ptr<ObjectType> mutation)
 {
 	_mutation = mutation;
+	++_revision;
 }
 
 void Schema::AddSubscriptionType(std::shared_ptr<ObjectType> subscription)
 {
 	_subscription = subscription;
+	++_revision;
 }
 
 void Schema::AddType(std::string_view name, std::shared_ptr<BaseType> type)
 {
 	_typeMap[name] = _types.size();
 	_types.push_back({ name, type });
+	++_revision;
 }
 
 bool Schema::supportsIntrospection() const noexcept
@@ -89,6 +93,7 @@ std::shared_ptr<const BaseType> Schema::WrapType(
 void Schema::AddDirective(std::shared_ptr<Directive> directive)
 {
 	_directives.emplace_back(std::move(directive));
+	++_revision;
 }
 
 std::string_view Schema::description() const noexcept
@@ -122,6 +127,11 @@ const std::vector<std::shared_ptr<const Directive>>& Schema::directives() const
 	return _directives;
 }
 
+size_t Schema::revision() const noexcept
+{
+	return _revision;
+}
+
 BaseType::BaseType(introspection::TypeKind kind, std::string_view description)
 	: _kind(kind)
 	, _description(description)
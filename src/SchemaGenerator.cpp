@@ -675,8 +675,9 @@ private:
 	{
 		virtual ~Concept() = default;
 
-		[[nodiscard("unnecessary call")]] virtual service::TypeNames getTypeNames() const noexcept = 0;
-		[[nodiscard("unnecessary call")]] virtual service::ResolverMap getResolvers() const noexcept = 0;
+		[[nodiscard("unnecessary call")]] virtual const service::TypeNames& getTypeNames() const noexcept = 0;
+		[[nodiscard("unnecessary call")]] virtual const service::ResolverTable& getResolvers() const noexcept = 0;
+		[[nodiscard("unnecessary call")]] virtual const service::Object& getObject() const noexcept = 0;
 
 		virtual void beginSelectionSet(const service::SelectionSetParams& params) const = 0;
 		virtual void endSelectionSet(const service::SelectionSetParams& params) const = 0;
@@ -691,14 +692,19 @@ private:
 		{
 		}
 
-		[[nodiscard("unnecessary call")]] service::TypeNames getTypeNames() const noexcept override
+		[[nodiscard("unnecessary call")]] const service::TypeNames& getTypeNames() const noexcept override
 		{
-			return _pimpl->getTypeNames();
+			return T::getTypeNames();
 		}
 
-		[[nodiscard("unnecessary call")]] service::ResolverMap getResolvers() const noexcept override
+		[[nodiscard("unnecessary call")]] const service::ResolverTable& getResolvers() const noexcept override
 		{
-			return _pimpl->getResolvers();
+			return T::getResolvers();
+		}
+
+		[[nodiscard("unnecessary call")]] const service::Object& getObject() const noexcept override
+		{
+			return *_pimpl;
 		}
 
 		void beginSelectionSet(const service::SelectionSetParams& params) const override
@@ -902,6 +908,14 @@ private:
 		virtual void endSelectionSet(const service::SelectionSetParams& params) const = 0;
 
 )cpp";
+
+		if (_options.threadSafeResolvers)
+		{
+			headerFile
+				<< R"cpp(		[[nodiscard("unnecessary call")]] virtual bool isThreadSafe() const noexcept = 0;
+
+)cpp";
+		}
 	}
 
 	for (const auto& outputField : objectType.fields)
@@ -1062,6 +1076,16 @@ private:
 			}
 		}
 )cpp";
+
+		if (_options.threadSafeResolvers)
+		{
+			headerFile << R"cpp(
+		[[nodiscard("unnecessary call")]] bool isThreadSafe() const noexcept override
+		{
+			return service::ThreadSafeResolvers<T>;
+		}
+)cpp";
+		}
 	}
 
 	headerFile << R"cpp(
@@ -1075,8 +1099,8 @@ private:
 	{
 		headerFile << R"cpp(	const std::unique_ptr<const Concept> _pimpl;
 
-	[[nodiscard("unnecessary call")]] service::TypeNames getTypeNames() const noexcept;
-	[[nodiscard("unnecessary call")]] service::ResolverMap getResolvers() const noexcept;
+	[[nodiscard("unnecessary call")]] static const service::TypeNames& getTypeNames() noexcept;
+	[[nodiscard("unnecessary call")]] static const service::ResolverTable& getResolvers() noexcept;
 
 public:
 	GRAPHQLSERVICE_EXPORT explicit )cpp"
@@ -1139,14 +1163,22 @@ public:
 		}
 
 		headerFile
-			<< R"cpp(	[[nodiscard("unnecessary call")]] service::TypeNames getTypeNames() const noexcept;
-	[[nodiscard("unnecessary call")]] service::ResolverMap getResolvers() const noexcept;
+			<< R"cpp(	[[nodiscard("unnecessary call")]] static const service::TypeNames& getTypeNames() noexcept;
+	[[nodiscard("unnecessary call")]] static const service::ResolverTable& getResolvers() noexcept;
 
 	void beginSelectionSet(const service::SelectionSetParams& params) const override;
 	void endSelectionSet(const service::SelectionSetParams& params) const override;
 
 	const std::unique_ptr<const Concept> _pimpl;
+)cpp";
 
+		if (_options.threadSafeResolvers)
+		{
+			headerFile << R"cpp(	const bool _threadSafe;
+)cpp";
+		}
+
+		headerFile << R"cpp(
 public:
 	template <class T>
 	explicit )cpp"
@@ -2139,7 +2171,7 @@ void Generator::outputInterfaceImplementation(
 	// resolver methods.
 	sourceFile << cppType << R"cpp(::)cpp" << cppType
 			   << R"cpp((std::unique_ptr<const Concept> pimpl) noexcept
-	: service::Object { pimpl->getTypeNames(), pimpl->getResolvers() }
+	: service::Object { pimpl->getTypeNames(), pimpl->getResolvers(), &pimpl->getObject() }
 	, _pimpl { std::move(pimpl) }
 {
 }
@@ -2221,7 +2253,8 @@ void Generator::outputObjectImplementation(
 	}
 
 	sourceFile << R"cpp( noexcept
-	: service::Object{ getTypeNames(), getResolvers() })cpp";
+	: service::Object{ getTypeNames(), getResolvers(), R"gql()cpp"
+			   << objectType.type << R"cpp()gql"sv })cpp";
 
 	if (!_options.noIntrospection && isQueryType)
 	{
@@ -2240,6 +2273,12 @@ void Generator::outputObjectImplementation(
 	{
 		sourceFile << R"cpp(
 	, _pimpl { std::move(pimpl) })cpp";
+
+		if (_options.threadSafeResolvers)
+		{
+			sourceFile << R"cpp(
+	, _threadSafe { _pimpl->isThreadSafe() })cpp";
+		}
 	}
 	sourceFile << R"cpp(
 {
@@ -2259,10 +2298,10 @@ void Generator::outputObjectImplementation(
 	}
 
 	sourceFile << R"cpp(
-service::TypeNames )cpp"
-			   << objectType.cppType << R"cpp(::getTypeNames() const noexcept
+const service::TypeNames& )cpp"
+			   << objectType.cppType << R"cpp(::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 )cpp";
 
 	for (const auto& interfaceName : objectType.interfaces)
@@ -2279,39 +2318,46 @@ service::TypeNames )cpp"
 
 	sourceFile << R"cpp(		R"gql()cpp" << objectType.type << R"cpp()gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap )cpp"
-			   << objectType.cppType << R"cpp(::getResolvers() const noexcept
+const service::ResolverTable& )cpp"
+			   << objectType.cppType << R"cpp(::getResolvers() noexcept
 {
-	return {
+	static const service::ResolverTable s_resolvers {
 )cpp";
 
+	// Each entry is a captureless lambda which converts to a service::FieldResolver, so the table
+	// is shared by every instance of this type.
+	const auto getResolverEntry = [&objectType](std::string_view fieldName,
+									  std::string_view resolverName) {
+		std::ostringstream output;
+
+		output << R"cpp(		{ R"gql()cpp" << fieldName
+			   << R"cpp()gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const )cpp"
+			   << objectType.cppType << R"cpp(&>(object).)cpp" << resolverName
+			   << R"cpp((std::move(params)); } })cpp";
+
+		return output.str();
+	};
 	std::map<std::string_view, std::string, internal::shorter_or_less> resolvers;
 
 	std::transform(objectType.fields.cbegin(),
 		objectType.fields.cend(),
 		std::inserter(resolvers, resolvers.begin()),
-		[](const OutputField& outputField) noexcept {
-			const auto resolverName = SchemaLoader::getOutputCppResolver(outputField);
-			std::ostringstream output;
-
-			output << R"cpp(		{ R"gql()cpp" << outputField.name
-				   << R"cpp()gql"sv, [this](service::ResolverParams&& params) { return )cpp"
-				   << resolverName << R"cpp((std::move(params)); } })cpp";
-
-			return std::make_pair(std::string_view { outputField.name }, output.str());
+		[&getResolverEntry](const OutputField& outputField) noexcept {
+			return std::make_pair(std::string_view { outputField.name },
+				getResolverEntry(outputField.name,
+					SchemaLoader::getOutputCppResolver(outputField)));
 		});
 
-	resolvers["__typename"sv] =
-		R"cpp(		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } })cpp"s;
+	resolvers["__typename"sv] = getResolverEntry("__typename"sv, "resolve_typename"sv);
 
 	if (!_options.noIntrospection && isQueryType)
 	{
-		resolvers["__schema"sv] =
-			R"cpp(		{ R"gql(__schema)gql"sv, [this](service::ResolverParams&& params) { return resolve_schema(std::move(params)); } })cpp"s;
-		resolvers["__type"sv] =
-			R"cpp(		{ R"gql(__type)gql"sv, [this](service::ResolverParams&& params) { return resolve_type(std::move(params)); } })cpp"s;
+		resolvers["__schema"sv] = getResolverEntry("__schema"sv, "resolve_schema"sv);
+		resolvers["__type"sv] = getResolverEntry("__type"sv, "resolve_type"sv);
 	}
 
 	bool firstField = true;
@@ -2330,6 +2376,8 @@ service::ResolverMap )cpp"
 
 	sourceFile << R"cpp(
 	};
+
+	return s_resolvers;
 }
 )cpp";
 
@@ -2350,6 +2398,11 @@ void )cpp" << objectType.cppType
 )cpp";
 	}
 
+	// Implementation types which declare threadSafeResolvers skip the resolver mutex at runtime.
+	// The introspection types only read from a fully populated ObjectCache, so they never need it.
+	const bool threadSafeResolvers = _options.threadSafeResolvers;
+	const bool resolverMutex = !_loader.isIntrospection();
+
 	// Output each of the resolver implementations, which call the virtual property
 	// getters that the implementer must define.
 	for (const auto& outputField : objectType.fields)
@@ -2408,8 +2461,22 @@ service::AwaitableResolver )cpp"
 			}
 		}
 
-		sourceFile << R"cpp(	std::unique_lock resolverLock(_resolverMutex);
+		if (resolverMutex && threadSafeResolvers)
+		{
+			sourceFile << R"cpp(	std::unique_lock resolverLock(_resolverMutex, std::defer_lock);
+
+	if (!_threadSafe)
+	{
+		resolverLock.lock();
+	}
+
+)cpp";
+		}
+		else if (resolverMutex)
+		{
+			sourceFile << R"cpp(	std::unique_lock resolverLock(_resolverMutex);
 )cpp";
+		}
 
 		if (!_loader.isIntrospection())
 		{
@@ -2451,8 +2518,24 @@ service::AwaitableResolver )cpp"
 		}
 
 		sourceFile << R"cpp();
-	resolverLock.unlock();
+)cpp";
 
+		if (resolverMutex && threadSafeResolvers)
+		{
+			sourceFile << R"cpp(
+	if (resolverLock.owns_lock())
+	{
+		resolverLock.unlock();
+	}
+)cpp";
+		}
+		else if (resolverMutex)
+		{
+			sourceFile << R"cpp(	resolverLock.unlock();
+)cpp";
+		}
+
+		sourceFile << R"cpp(
 	return )cpp" << getResultAccessType(outputField)
 				   << R"cpp(::convert)cpp" << getTypeModifiers(outputField.modifiers)
 				   << R"cpp((std::move(result), std::move(params));
@@ -2491,10 +2574,9 @@ service::AwaitableResolver )cpp"
 	const auto& baseType = _schema->LookupType(argName);
 	std::shared_ptr<)cpp"
 			<< SchemaLoader::getIntrospectionNamespace()
-			<< R"cpp(::object::Type> result { baseType ? std::make_shared<)cpp"
+			<< R"cpp(::object::Type> result { baseType ? )cpp"
 			<< SchemaLoader::getIntrospectionNamespace()
-			<< R"cpp(::object::Type>(std::make_shared<)cpp"
-			<< SchemaLoader::getIntrospectionNamespace() << R"cpp(::Type>(baseType)) : nullptr };
+			<< R"cpp(::ObjectCache::get(*_schema)->lookupType(baseType) : nullptr };
 
 	return service::ModifiedResult<)cpp"
 			<< SchemaLoader::getIntrospectionNamespace()
@@ -3343,6 +3425,7 @@ int main(int argc, char** argv)
 	bool verbose = false;
 	bool stubs = false;
 	bool noIntrospection = false;
+	bool threadSafeResolvers = false;
 	std::string schemaFileName;
 	std::string filenamePrefix;
 	std::string schemaNamespace;
@@ -3369,7 +3452,9 @@ int main(int argc, char** argv)
 		"Unimplemented fields throw runtime exceptions instead of compiler errors")("no-"
 																					"introspection",
 		po::bool_switch(&noIntrospection),
-		"Do not generate support for Introspection");
+		"Do not generate support for Introspection")("thread-safe-resolvers",
+		po::bool_switch(&threadSafeResolvers),
+		"Skip the resolver mutex for implementation types which declare threadSafeResolvers");
 	positional.add("schema", 1).add("prefix", 1).add("namespace", 1);
 	internalOptions.add_options()("introspection",
 		po::bool_switch(&buildIntrospection),
@@ -3434,6 +3519,7 @@ int main(int argc, char** argv)
 				verbose,										// verbose
 				stubs,											// stubs
 				noIntrospection,								// noIntrospection
+				threadSafeResolvers,							// threadSafeResolvers
 			})
 							   .Build();
 
@@ -8,9 +8,12 @@
 
 #include <tao/pegtl/contrib/unescape.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <memory_resource>
 #include <numeric>
 #include <optional>
 #include <sstream>
@@ -21,9 +24,56 @@ using namespace std::literals;
 namespace graphql {
 namespace peg {
 
+// The arena for the document which is being parsed on this thread, if any.
+thread_local std::pmr::memory_resource* t_nodeArena = nullptr;
+
+// Each node is prefixed with the arena it came from, or nullptr if it came from the global heap.
+constexpr std::size_t c_nodeHeaderSize = alignof(std::max_align_t);
+
+static_assert(c_nodeHeaderSize >= sizeof(std::pmr::memory_resource*),
+	"the node header must fit the arena pointer");
+static_assert(alignof(ast_node) <= alignof(std::max_align_t), "ast_node is over-aligned");
+
+void* ast_node::operator new(std::size_t size)
+{
+	auto arena = t_nodeArena;
+	auto block = static_cast<std::byte*>(arena
+			? arena->allocate(c_nodeHeaderSize + size, alignof(std::max_align_t))
+			: ::operator new(c_nodeHeaderSize + size));
+
+	std::memcpy(block, &arena, sizeof(arena));
+
+	return block + c_nodeHeaderSize;
+}
+
+void ast_node::operator delete(void* ptr) noexcept
+{
+	if (!ptr)
+	{
+		return;
+	}
+
+	auto block = static_cast<std::byte*>(ptr) - c_nodeHeaderSize;
+	std::pmr::memory_resource* arena = nullptr;
+
+	std::memcpy(&arena, block, sizeof(arena));
+
+	// Nodes from an arena are released along with the rest of the document.
+	if (!arena)
+	{
+		::operator delete(block);
+	}
+}
+
+ast_node::ast_node() noexcept
+	: children { t_nodeArena ? t_nodeArena : std::pmr::get_default_resource() }
+{
+}
+
 void ast_node::unescaped_view(std::string_view unescaped) noexcept
 {
-	_unescaped = std::make_unique<unescaped_t>(unescaped);
+	_unescaped = unescaped;
+	_unescapedValue.reset();
 }
 
 std::string_view ast_node::unescaped_view() const
@@ -110,7 +160,8 @@ std::string_view ast_node::unescaped_view() const
 				}
 			}
 
-			_unescaped = std::make_unique<unescaped_t>(std::move(joined));
+			_unescapedValue = std::make_unique<std::string>(std::move(joined));
+			_unescaped = *_unescapedValue;
 		}
 		else if (children.size() > 1)
 		{
@@ -128,11 +179,12 @@ std::string_view ast_node::unescaped_view() const
 				joined.append(child->string_view());
 			}
 
-			_unescaped = std::make_unique<unescaped_t>(std::move(joined));
+			_unescapedValue = std::make_unique<std::string>(std::move(joined));
+			_unescaped = *_unescapedValue;
 		}
 		else if (!children.empty())
 		{
-			_unescaped = std::make_unique<unescaped_t>(children.front()->string_view());
+			_unescaped = children.front()->string_view();
 		}
 		else if (has_content() && is_type<escaped_unicode>())
 		{
@@ -143,25 +195,23 @@ std::string_view ast_node::unescaped_view() const
 			utf8.reserve((content.size() + 1) / 2);
 			unescape::unescape_j::apply(in, utf8);
 
-			_unescaped = std::make_unique<unescaped_t>(std::move(utf8));
+			_unescapedValue = std::make_unique<std::string>(std::move(utf8));
+			_unescaped = *_unescapedValue;
 		}
 		else
 		{
-			_unescaped = std::make_unique<unescaped_t>(std::string_view {});
+			_unescaped = std::string_view {};
 		}
 	}
 
-	return std::visit(
-		[](const auto& value) noexcept {
-			return std::string_view { value };
-		},
-		*_unescaped);
+	return *_unescaped;
 }
 
 void ast_node::remove_content() noexcept
 {
-	basic_node_t::remove_content();
+	m_end = peginternal::iterator();
 	_unescaped.reset();
+	_unescapedValue.reset();
 }
 
 using namespace tao::graphqlpeg;
@@ -954,11 +1004,38 @@ struct make_control<Selector>::state_handler<Rule, true, B> : ast_control<Rule>
 
 } // namespace internal
 
+// Allocate any nodes created on this thread from the arena until it goes out of scope.
+class [[nodiscard("unnecessary construction")]] ast_arena_scope
+{
+public:
+	explicit ast_arena_scope(std::pmr::memory_resource& arena) noexcept
+		: _previous { std::exchange(t_nodeArena, &arena) }
+	{
+	}
+
+	~ast_arena_scope()
+	{
+		t_nodeArena = _previous;
+	}
+
+private:
+	std::pmr::memory_resource* const _previous;
+};
+
 template <typename Rule, template <typename...> class Action, template <typename...> class Selector,
 	typename ParseInput>
-[[nodiscard("unnecessary call")]] std::unique_ptr<ast_node> parse(ParseInput&& in)
-{
+[[nodiscard("unnecessary call")]] std::shared_ptr<ast_node> parse(ParseInput&& in)
+{
+	// Start with a buffer about the size of the input, but no larger than a fixed cap. The arena
+	// lives as long as the document, so a large or malformed input should not pin much more
+	// memory than it needs. Bigger documents grow the arena geometrically as they are parsed.
+	constexpr std::size_t c_minArenaSize = 16 * sizeof(ast_node);
+	constexpr std::size_t c_maxInitialArenaSize = 64 * 1024;
+	auto arena = std::make_shared<std::pmr::monotonic_buffer_resource>(
+		std::clamp(in.size(), c_minArenaSize, c_maxInitialArenaSize));
+	ast_arena_scope arenaScope { *arena };
 	internal::ast_state state;
+
 	if (!tao::graphqlpeg::parse<Rule, Action, internal::make_control<Selector>::template type>(
 			std::forward<ParseInput>(in),
 			state))
@@ -971,7 +1048,10 @@ template <typename Rule, template <typename...> class Action, template <typename
 		throw std::logic_error("Unexpected error parsing GraphQL");
 	}
 
-	return std::move(state.back());
+	// The root owns the arena, so it outlives every node in the document.
+	return { state.back().release(), [arena = std::move(arena)](ast_node* root) noexcept {
+				delete root;
+			} };
 }
 
 } // namespace graphql_parse_tree
@@ -1018,6 +1098,8 @@ struct [[nodiscard("unnecessary construction")]] ast_input
 	std::variant<ast_string, std::unique_ptr<ast_file>, ast_string_view> data;
 };
 
+// Parse the mixed document grammar in a single pass, validation reports any unexpected definitions
+// by checking the type of each child of the root node. A malformed document is never parsed twice.
 ast parseSchemaString(std::string_view input, size_t depthLimit)
 {
 	ast result { std::make_shared<ast_input>(
@@ -1025,58 +1107,25 @@ ast parseSchemaString(std::string_view input, size_t depthLimit)
 		{} };
 	auto& data = std::get<ast_string>(result.input->data);
 
-	try
-	{
-		// Try a smaller grammar with only schema type definitions first.
-		data.memory = std::make_unique<ast_memory>(depthLimit,
-			data.input.data(),
-			data.input.size(),
-			"GraphQL"s);
-		result.root =
-			graphql_parse_tree::parse<schema_document, ast_action, schema_selector>(*data.memory);
-	}
-	catch (const peg::parse_error&)
-	{
-		// Try again with the full document grammar so validation can handle the unexepected
-		// executable definitions if this is a mixed document.
-		data.memory = std::make_unique<ast_memory>(depthLimit,
-			data.input.data(),
-			data.input.size(),
-			"GraphQL"s);
-		result.root =
-			graphql_parse_tree::parse<mixed_document, ast_action, schema_selector>(*data.memory);
-	}
+	data.memory = std::make_unique<ast_memory>(depthLimit,
+		data.input.data(),
+		data.input.size(),
+		"GraphQL"s);
+	result.root =
+		graphql_parse_tree::parse<mixed_document, ast_action, schema_selector>(*data.memory);
 
 	return result;
 }
 
 ast parseSchemaFile(std::string_view filename, size_t depthLimit)
 {
-	ast result;
-
-	try
-	{
-		result.input = std::make_shared<ast_input>(
-			ast_input { std::make_unique<ast_file>(depthLimit, filename) });
-
-		auto& in = *std::get<std::unique_ptr<ast_file>>(result.input->data);
-
-		// Try a smaller grammar with only schema type definitions first.
-		result.root =
-			graphql_parse_tree::parse<schema_document, ast_action, schema_selector>(std::move(in));
-	}
-	catch (const peg::parse_error&)
-	{
-		result.input = std::make_shared<ast_input>(
-			ast_input { std::make_unique<ast_file>(depthLimit, filename) });
-
-		auto& in = *std::get<std::unique_ptr<ast_file>>(result.input->data);
+	ast result { std::make_shared<ast_input>(
+					 ast_input { std::make_unique<ast_file>(depthLimit, filename) }),
+		{} };
+	auto& in = *std::get<std::unique_ptr<ast_file>>(result.input->data);
 
-		// Try again with the full document grammar so validation can handle the unexepected
-		// executable definitions if this is a mixed document.
-		result.root =
-			graphql_parse_tree::parse<mixed_document, ast_action, schema_selector>(std::move(in));
-	}
+	result.root =
+		graphql_parse_tree::parse<mixed_document, ast_action, schema_selector>(std::move(in));
 
 	return result;
 }
@@ -1088,60 +1137,25 @@ ast parseString(std::string_view input, size_t depthLimit)
 		{} };
 	auto& data = std::get<ast_string>(result.input->data);
 
-	try
-	{
-		// Try a smaller grammar with only executable definitions first.
-		data.memory = std::make_unique<ast_memory>(depthLimit,
-			data.input.data(),
-			data.input.size(),
-			"GraphQL"s);
-		result.root =
-			graphql_parse_tree::parse<executable_document, ast_action, executable_selector>(
-				*data.memory);
-	}
-	catch (const peg::parse_error&)
-	{
-		// Try again with the full document grammar so validation can handle the unexepected type
-		// definitions if this is a mixed document.
-		data.memory = std::make_unique<ast_memory>(depthLimit,
-			data.input.data(),
-			data.input.size(),
-			"GraphQL"s);
-		result.root = graphql_parse_tree::parse<mixed_document, ast_action, executable_selector>(
-			*data.memory);
-	}
+	data.memory = std::make_unique<ast_memory>(depthLimit,
+		data.input.data(),
+		data.input.size(),
+		"GraphQL"s);
+	result.root =
+		graphql_parse_tree::parse<mixed_document, ast_action, executable_selector>(*data.memory);
 
 	return result;
 }
 
 ast parseFile(std::string_view filename, size_t depthLimit)
 {
-	ast result;
-
-	try
-	{
-		result.input = std::make_shared<ast_input>(
-			ast_input { std::make_unique<ast_file>(depthLimit, filename) });
-
-		auto& in = *std::get<std::unique_ptr<ast_file>>(result.input->data);
-
-		// Try a smaller grammar with only executable definitions first.
-		result.root =
-			graphql_parse_tree::parse<executable_document, ast_action, executable_selector>(
-				std::move(in));
-	}
-	catch (const peg::parse_error&)
-	{
-		result.input = std::make_shared<ast_input>(
-			ast_input { std::make_unique<ast_file>(depthLimit, filename) });
-
-		auto& in = *std::get<std::unique_ptr<ast_file>>(result.input->data);
+	ast result { std::make_shared<ast_input>(
+					 ast_input { std::make_unique<ast_file>(depthLimit, filename) }),
+		{} };
+	auto& in = *std::get<std::unique_ptr<ast_file>>(result.input->data);
 
-		// Try again with the full document grammar so validation can handle the unexepected type
-		// definitions if this is a mixed document.
-		result.root = graphql_parse_tree::parse<mixed_document, ast_action, executable_selector>(
-			std::move(in));
-	}
+	result.root =
+		graphql_parse_tree::parse<mixed_document, ast_action, executable_selector>(std::move(in));
 
 	return result;
 }
@@ -1155,23 +1169,10 @@ peg::ast operator"" _graphql(const char* text, size_t size)
 		{} };
 	auto& data = std::get<peg::ast_string_view>(result.input->data);
 
-	try
-	{
-		// Try a smaller grammar with only executable definitions first.
-		data.memory =
-			std::make_unique<peg::memory_input<>>(data.input.data(), data.input.size(), "GraphQL"s);
-		result.root = peg::graphql_parse_tree::
-			parse<peg::executable_document, peg::nothing, peg::executable_selector>(*data.memory);
-	}
-	catch (const peg::parse_error&)
-	{
-		// Try again with the full document grammar so validation can handle the unexepected type
-		// definitions if this is a mixed document.
-		data.memory =
-			std::make_unique<peg::memory_input<>>(data.input.data(), data.input.size(), "GraphQL"s);
-		result.root = peg::graphql_parse_tree::
-			parse<peg::mixed_document, peg::nothing, peg::executable_selector>(*data.memory);
-	}
+	data.memory =
+		std::make_unique<peg::memory_input<>>(data.input.data(), data.input.size(), "GraphQL"s);
+	result.root = peg::graphql_parse_tree::
+		parse<peg::mixed_document, peg::nothing, peg::executable_selector>(*data.memory);
 
 	return result;
 }
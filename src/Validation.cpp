@@ -358,8 +358,22 @@ ValidateType ValidateVariableTypeVisitor::getType()
 	return result;
 }
 
-ValidateExecutableVisitor::ValidateExecutableVisitor(std::shared_ptr<schema::Schema> schema)
-	: _schema(schema)
+constexpr bool ValidateExecutableSchema::isScalarType(introspection::TypeKind kind)
+{
+	switch (kind)
+	{
+		case introspection::TypeKind::OBJECT:
+		case introspection::TypeKind::INTERFACE:
+		case introspection::TypeKind::UNION:
+			return false;
+
+		default:
+			return true;
+	}
+}
+
+ValidateExecutableSchema::ValidateExecutableSchema(std::shared_ptr<schema::Schema> schema)
+	: _schema(std::move(schema))
 {
 	const auto& queryType = _schema->queryType();
 	const auto& mutationType = _schema->mutationType();
@@ -478,6 +492,124 @@ ValidateExecutableVisitor::ValidateExecutableVisitor(std::shared_ptr<schema::Sch
 		validateDirective.arguments = getArguments(args);
 		_directives[name] = std::move(validateDirective);
 	}
+
+	for (const auto& entry : _types)
+	{
+		const auto kind = entry.second->get().kind();
+
+		if (!isScalarType(kind))
+		{
+			addTypeFields(entry.second);
+		}
+		else if (kind == introspection::TypeKind::INPUT_OBJECT)
+		{
+			_inputTypeFields.emplace(entry.first, getArguments(entry.second->get().inputFields()));
+		}
+	}
+}
+
+ValidateTypeFieldArguments ValidateExecutableSchema::getArguments(
+	const std::vector<std::shared_ptr<const schema::InputValue>>& args)
+{
+	ValidateTypeFieldArguments result;
+
+	for (const auto& arg : args)
+	{
+		if (!arg)
+		{
+			continue;
+		}
+
+		ValidateArgument argument;
+
+		argument.defaultValue = !arg->defaultValue().empty();
+		argument.nonNullDefaultValue =
+			argument.defaultValue && arg->defaultValue() != R"gql(null)gql"sv;
+		argument.type = getValidateType(arg->type().lock());
+
+		result[arg->name()] = std::move(argument);
+	}
+
+	return result;
+}
+
+void ValidateExecutableSchema::addTypeFields(const ValidateType& type)
+{
+	const auto& fields = type->get().fields();
+	internal::string_view_map<ValidateTypeField> validateFields;
+
+	for (auto& entry : fields)
+	{
+		if (!entry)
+		{
+			continue;
+		}
+
+		const auto fieldName = entry->name();
+		ValidateTypeField subField;
+
+		subField.returnType = getValidateType(entry->type().lock());
+
+		if (fieldName.empty() || !subField.returnType)
+		{
+			continue;
+		}
+
+		subField.arguments = getArguments(entry->args());
+
+		validateFields[fieldName] = std::move(subField);
+	}
+
+	const auto itrQuery = _operationTypes.find(strQuery);
+
+	if (_schema->supportsIntrospection() && itrQuery != _operationTypes.end()
+		&& type == itrQuery->second)
+	{
+		ValidateTypeField schemaField;
+
+		schemaField.returnType = getValidateType(_schema->WrapType(introspection::TypeKind::NON_NULL,
+			_schema->LookupType(R"gql(__Schema)gql"sv)));
+		validateFields[R"gql(__schema)gql"sv] = std::move(schemaField);
+
+		ValidateTypeField typeField;
+		ValidateArgument nameArgument;
+
+		typeField.returnType = getValidateType(_schema->LookupType(R"gql(__Type)gql"sv));
+
+		nameArgument.type = getValidateType(_schema->WrapType(introspection::TypeKind::NON_NULL,
+			_schema->LookupType(R"gql(String)gql"sv)));
+		typeField.arguments[R"gql(name)gql"sv] = std::move(nameArgument);
+
+		validateFields[R"gql(__type)gql"sv] = std::move(typeField);
+	}
+
+	ValidateTypeField typenameField;
+
+	typenameField.returnType = getValidateType(_schema->WrapType(introspection::TypeKind::NON_NULL,
+		_schema->LookupType(R"gql(String)gql"sv)));
+	validateFields[R"gql(__typename)gql"sv] = std::move(typenameField);
+
+	_typeFields.emplace(type->get().name(), std::move(validateFields));
+}
+
+ValidateExecutableVisitor::ValidateExecutableVisitor(std::shared_ptr<schema::Schema> schema)
+	: ValidateExecutableVisitor(std::make_shared<const ValidateExecutableSchema>(std::move(schema)))
+{
+}
+
+ValidateExecutableVisitor::ValidateExecutableVisitor(
+	std::shared_ptr<const ValidateExecutableSchema> validationSchema) noexcept
+	: _validationSchema(std::move(validationSchema))
+	, _schema(_validationSchema->_schema)
+	, _operationTypes(_validationSchema->_operationTypes)
+	, _types(_validationSchema->_types)
+	, _matchingTypes(_validationSchema->_matchingTypes)
+	, _directives(_validationSchema->_directives)
+	, _enumValues(_validationSchema->_enumValues)
+	, _scalarTypes(_validationSchema->_scalarTypes)
+	, _typeFields(_validationSchema->_typeFields)
+	, _inputTypeFields(_validationSchema->_inputTypeFields)
+{
 }
 
 void ValidateExecutableVisitor::visit(const peg::ast_node& root)
@@ -614,7 +746,8 @@ void ValidateExecutableVisitor::visitFragmentDefinition(const peg::ast_node& fra
 
 	auto itrType = _types.find(innerType);
 
-	if (itrType == _types.end() || isScalarType(itrType->second->get().kind()))
+	if (itrType == _types.end()
+		|| ValidateExecutableSchema::isScalarType(itrType->second->get().kind()))
 	{
 		// https://spec.graphql.org/October2021/#sec-Fragment-Spread-Type-Existence
 		// https://spec.graphql.org/October2021/#sec-Fragments-On-Composite-Types
@@ -866,45 +999,6 @@ void ValidateExecutableVisitor::visitSelection(const peg::ast_node& selection)
 	}
 }
 
-ValidateTypeFieldArguments ValidateExecutableVisitor::getArguments(
-	const std::vector<std::shared_ptr<const schema::InputValue>>& args)
-{
-	ValidateTypeFieldArguments result;
-
-	for (const auto& arg : args)
-	{
-		if (!arg)
-		{
-			continue;
-		}
-
-		ValidateArgument argument;
-
-		argument.defaultValue = !arg->defaultValue().empty();
-		argument.nonNullDefaultValue =
-			argument.defaultValue && arg->defaultValue() != R"gql(null)gql"sv;
-		argument.type = getValidateType(arg->type().lock());
-
-		result[arg->name()] = std::move(argument);
-	}
-
-	return result;
-}
-
-constexpr bool ValidateExecutableVisitor::isScalarType(introspection::TypeKind kind)
-{
-	switch (kind)
-	{
-		case introspection::TypeKind::OBJECT:
-		case introspection::TypeKind::INTERFACE:
-		case introspection::TypeKind::UNION:
-			return false;
-
-		default:
-			return true;
-	}
-}
-
 bool ValidateExecutableVisitor::matchesScopedType(std::string_view name) const
 {
 	if (name == _scopedType->get().name())
@@ -1410,91 +1504,15 @@ bool ValidateExecutableVisitor::validateVariableType(bool isNonNull,
 }
 
 ValidateExecutableVisitor::TypeFields::const_iterator ValidateExecutableVisitor::
-	getScopedTypeFields()
+	getScopedTypeFields() const
 {
-	auto typeKind = _scopedType->get().kind();
-	auto itrType = _typeFields.find(_scopedType->get().name());
-
-	if (itrType == _typeFields.end() && !isScalarType(typeKind))
-	{
-		const auto& fields = _scopedType->get().fields();
-		internal::string_view_map<ValidateTypeField> validateFields;
-
-		for (auto& entry : fields)
-		{
-			if (!entry)
-			{
-				continue;
-			}
-
-			const auto fieldName = entry->name();
-			ValidateTypeField subField;
-
-			subField.returnType = getValidateType(entry->type().lock());
-
-			if (fieldName.empty() || !subField.returnType)
-			{
-				continue;
-			}
-
-			subField.arguments = getArguments(entry->args());
-
-			validateFields[fieldName] = std::move(subField);
-		}
-
-		if (_schema->supportsIntrospection() && _scopedType == _operationTypes[strQuery])
-		{
-			ValidateTypeField schemaField;
-
-			schemaField.returnType =
-				getValidateType(_schema->WrapType(introspection::TypeKind::NON_NULL,
-					_schema->LookupType(R"gql(__Schema)gql"sv)));
-			validateFields[R"gql(__schema)gql"sv] = std::move(schemaField);
-
-			ValidateTypeField typeField;
-			ValidateArgument nameArgument;
-
-			typeField.returnType = getValidateType(_schema->LookupType(R"gql(__Type)gql"sv));
-
-			nameArgument.type = getValidateType(_schema->WrapType(introspection::TypeKind::NON_NULL,
-				_schema->LookupType(R"gql(String)gql"sv)));
-			typeField.arguments[R"gql(name)gql"sv] = std::move(nameArgument);
-
-			validateFields[R"gql(__type)gql"sv] = std::move(typeField);
-		}
-
-		ValidateTypeField typenameField;
-
-		typenameField.returnType =
-			getValidateType(_schema->WrapType(introspection::TypeKind::NON_NULL,
-				_schema->LookupType(R"gql(String)gql"sv)));
-		validateFields[R"gql(__typename)gql"sv] = std::move(typenameField);
-
-		itrType = _typeFields.emplace(_scopedType->get().name(), std::move(validateFields)).first;
-	}
-
-	return itrType;
+	return _typeFields.find(_scopedType->get().name());
 }
 
 ValidateExecutableVisitor::InputTypeFields::const_iterator ValidateExecutableVisitor::
-	getInputTypeFields(std::string_view name)
+	getInputTypeFields(std::string_view name) const
 {
-	auto itrFields = _inputTypeFields.find(name);
-
-	if (itrFields == _inputTypeFields.end())
-	{
-		auto itrType = _types.find(name);
-
-		if (itrType != _types.end()
-			&& itrType->second->get().kind() == introspection::TypeKind::INPUT_OBJECT)
-		{
-			itrFields =
-				_inputTypeFields.emplace(name, getArguments(itrType->second->get().inputFields()))
-					.first;
-		}
-	}
-
-	return itrFields;
+	return _inputTypeFields.find(name);
 }
 
 template <class _FieldTypes>
@@ -1794,7 +1812,7 @@ void ValidateExecutableVisitor::visitField(const peg::ast_node& field)
 		_fieldCount = outerFieldCount;
 	}
 
-	if (subFieldCount == 0 && !isScalarType(innerType->get().kind()))
+	if (subFieldCount == 0 && !ValidateExecutableSchema::isScalarType(innerType->get().kind()))
 	{
 		// https://spec.graphql.org/October2021/#sec-Leaf-Field-Selections
 		auto position = field.begin();
@@ -1924,13 +1942,14 @@ void ValidateExecutableVisitor::visitInlineFragment(const peg::ast_node& inlineF
 
 		fragmentType = itrInner->second;
 
-		if (isScalarType(fragmentType->get().kind()) || !matchesScopedType(innerType))
+		if (ValidateExecutableSchema::isScalarType(fragmentType->get().kind())
+			|| !matchesScopedType(innerType))
 		{
 			// https://spec.graphql.org/October2021/#sec-Fragments-On-Composite-Types
 			// https://spec.graphql.org/October2021/#sec-Fragment-spread-is-possible
 			std::ostringstream message;
 
-			message << (isScalarType(fragmentType->get().kind())
+			message << (ValidateExecutableSchema::isScalarType(fragmentType->get().kind())
 					? "Scalar target type on inline fragment name: "
 					: "Incompatible target type on inline fragment name: ")
 					<< innerType;
@@ -2133,4 +2152,276 @@ void ValidateExecutableVisitor::visitDirectives(
 	}
 }
 
+constexpr size_t saturatingAdd(size_t lhs, size_t rhs) noexcept
+{
+	return (lhs > std::numeric_limits<size_t>::max() - rhs) ? std::numeric_limits<size_t>::max()
+															: lhs + rhs;
+}
+
+constexpr size_t saturatingMultiply(size_t lhs, size_t rhs) noexcept
+{
+	return (lhs != 0 && rhs > std::numeric_limits<size_t>::max() / lhs)
+		? std::numeric_limits<size_t>::max()
+		: lhs * rhs;
+}
+
+ValidateQueryCost::ValidateQueryCost(const ValidateExecutableSchema& validationSchema,
+	const CostLimits& limits, const FragmentMap& fragments,
+	const response::Value& variables) noexcept
+	: _operationTypes { validationSchema._operationTypes }
+	, _typeFields { validationSchema._typeFields }
+	, _limits { limits }
+	, _fragments { fragments }
+	, _variables { variables }
+{
+}
+
+size_t ValidateQueryCost::visit(std::string_view operationType,
+	const peg::ast_node& operationDefinition)
+{
+	_cost = 0;
+
+	const auto itrType = _operationTypes.find(operationType);
+
+	if (itrType == _operationTypes.end() || !itrType->second)
+	{
+		return _cost;
+	}
+
+	const auto typeName = itrType->second->get().name();
+
+	_defaultValues.clear();
+
+	peg::for_each_child<peg::variable>(operationDefinition, [this](const peg::ast_node& variable) {
+		std::string_view variableName;
+
+		peg::on_first_child<peg::variable_name>(variable,
+			[&variableName](const peg::ast_node& name) {
+				// Skip the $ prefix
+				variableName = name.string_view().substr(1);
+			});
+
+		peg::on_first_child<peg::default_value>(variable,
+			[this, variableName](const peg::ast_node& defaultValue) {
+				const auto& value = *defaultValue.children.front();
+
+				if (value.is_type<peg::integer_value>())
+				{
+					_defaultValues.emplace(variableName, std::atoi(value.string().c_str()));
+				}
+			});
+	});
+
+	peg::on_first_child<peg::selection_set>(operationDefinition,
+		[this, typeName](const peg::ast_node& child) {
+			visitSelection(child, typeName, 1, _limits.defaultListSize);
+		});
+
+	return _cost;
+}
+
+void ValidateQueryCost::visitSelection(const peg::ast_node& selection, std::string_view typeName,
+	size_t multiplier, size_t listSize)
+{
+	for (const auto& child : selection.children)
+	{
+		if (_cost > _limits.maxCost)
+		{
+			return;
+		}
+
+		if (child->is_type<peg::field>())
+		{
+			visitField(*child, typeName, multiplier, listSize);
+		}
+		else if (child->is_type<peg::fragment_spread>())
+		{
+			const auto itr = _fragments.find(child->children.front()->string_view());
+
+			if (itr != _fragments.end())
+			{
+				visitSelection(itr->second.getSelection(),
+					itr->second.getType(),
+					multiplier,
+					listSize);
+			}
+		}
+		else if (child->is_type<peg::inline_fragment>())
+		{
+			auto innerType = typeName;
+
+			peg::on_first_child<peg::type_condition>(*child,
+				[&innerType](const peg::ast_node& typeCondition) {
+					innerType = typeCondition.children.front()->string_view();
+				});
+
+			peg::on_first_child<peg::selection_set>(*child,
+				[this, innerType, multiplier, listSize](const peg::ast_node& innerSelection) {
+					visitSelection(innerSelection, innerType, multiplier, listSize);
+				});
+		}
+	}
+}
+
+void ValidateQueryCost::visitField(const peg::ast_node& field, std::string_view typeName,
+	size_t multiplier, size_t listSize)
+{
+	std::string_view name;
+
+	peg::on_first_child<peg::field_name>(field, [&name](const peg::ast_node& child) {
+		name = child.string_view();
+	});
+
+	_cost = saturatingAdd(_cost, saturatingMultiply(multiplier, getFieldCost(typeName, name)));
+
+	const peg::ast_node* selection = nullptr;
+
+	peg::on_first_child<peg::selection_set>(field, [&selection](const peg::ast_node& child) {
+		selection = &child;
+	});
+
+	if (!selection)
+	{
+		return;
+	}
+
+	const auto itrType = _typeFields.find(typeName);
+
+	if (itrType == _typeFields.end())
+	{
+		return;
+	}
+
+	const auto itrField = itrType->second.find(name);
+
+	if (itrField == itrType->second.end())
+	{
+		return;
+	}
+
+	// Unwrap the NON_NULL and LIST modifiers to find the type of the selection set.
+	auto fieldType = itrField->second.returnType;
+	bool isList = false;
+
+	while (fieldType && fieldType->get().name().empty())
+	{
+		isList = isList || fieldType->get().kind() == introspection::TypeKind::LIST;
+		fieldType = getValidateType(fieldType->get().ofType().lock());
+	}
+
+	if (!fieldType)
+	{
+		return;
+	}
+
+	const auto fieldListSize = getListSize(field);
+
+	if (isList)
+	{
+		multiplier = saturatingMultiply(multiplier, fieldListSize.value_or(listSize));
+		listSize = _limits.defaultListSize;
+	}
+	else
+	{
+		// A size argument on a connection applies to the lists nested inside of it.
+		listSize = fieldListSize.value_or(_limits.defaultListSize);
+	}
+
+	visitSelection(*selection, fieldType->get().name(), multiplier, listSize);
+}
+
+size_t ValidateQueryCost::getFieldCost(std::string_view typeName, std::string_view fieldName) const
+{
+	if (fieldName == R"gql(__typename)gql"sv)
+	{
+		return 0;
+	}
+
+	const auto itrType = _limits.fieldCosts.find(typeName);
+
+	if (itrType != _limits.fieldCosts.end())
+	{
+		const auto itrField = itrType->second.find(fieldName);
+
+		if (itrField != itrType->second.end())
+		{
+			return itrField->second;
+		}
+	}
+
+	return 1;
+}
+
+std::optional<size_t> ValidateQueryCost::getListSize(const peg::ast_node& field) const
+{
+	std::optional<size_t> result;
+
+	peg::on_first_child<peg::arguments>(field, [this, &result](const peg::ast_node& child) {
+		for (const auto& sizeArgument : _limits.listSizeArguments)
+		{
+			for (const auto& argument : child.children)
+			{
+				if (argument->children.front()->string_view() != sizeArgument)
+				{
+					continue;
+				}
+
+				const auto& value = *argument->children.back();
+				int size = 0;
+
+				if (value.is_type<peg::integer_value>())
+				{
+					size = std::atoi(value.string().c_str());
+				}
+				else if (value.is_type<peg::variable_value>())
+				{
+					const auto variableName = value.string_view().substr(1);
+					const response::Value* variableValue = nullptr;
+
+					if (_variables.type() == response::Type::Map)
+					{
+						const auto itr = _variables.find(variableName);
+
+						if (itr != _variables.get<response::MapType>().cend())
+						{
+							variableValue = &itr->second;
+						}
+					}
+
+					if (variableValue)
+					{
+						if (variableValue->type() != response::Type::Int)
+						{
+							continue;
+						}
+
+						size = variableValue->get<int>();
+					}
+					else
+					{
+						// The variable was left out, so the resolver will see its default value.
+						const auto itrDefault = _defaultValues.find(variableName);
+
+						if (itrDefault == _defaultValues.end())
+						{
+							continue;
+						}
+
+						size = itrDefault->second;
+					}
+				}
+				else
+				{
+					continue;
+				}
+
+				result = static_cast<size_t>(std::max(size, 0));
+				return;
+			}
+		}
+	});
+
+	return result;
+}
+
 } // namespace graphql::service
@@ -20,7 +20,7 @@ namespace graphql::introspection {
 namespace object {
 
 Directive::Directive(std::shared_ptr<introspection::Directive> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(__Directive)gql"sv }
 	, _pimpl { std::make_unique<Model<introspection::Directive>>(std::move(pimpl)) }
 {
 }
@@ -31,66 +31,60 @@ Directive::~Directive()
 	// of the implementation type.
 }
 
-service::TypeNames Directive::getTypeNames() const noexcept
+const service::TypeNames& Directive::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(__Directive)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Directive::getResolvers() const noexcept
+const service::ResolverTable& Directive::getResolvers() noexcept
 {
-	return {
-		{ R"gql(args)gql"sv, [this](service::ResolverParams&& params) { return resolveArgs(std::move(params)); } },
-		{ R"gql(name)gql"sv, [this](service::ResolverParams&& params) { return resolveName(std::move(params)); } },
-		{ R"gql(locations)gql"sv, [this](service::ResolverParams&& params) { return resolveLocations(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(description)gql"sv, [this](service::ResolverParams&& params) { return resolveDescription(std::move(params)); } },
-		{ R"gql(isRepeatable)gql"sv, [this](service::ResolverParams&& params) { return resolveIsRepeatable(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(args)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Directive&>(object).resolveArgs(std::move(params)); } },
+		{ R"gql(name)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Directive&>(object).resolveName(std::move(params)); } },
+		{ R"gql(locations)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Directive&>(object).resolveLocations(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Directive&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(description)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Directive&>(object).resolveDescription(std::move(params)); } },
+		{ R"gql(isRepeatable)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Directive&>(object).resolveIsRepeatable(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 service::AwaitableResolver Directive::resolveName(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getName();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<std::string>::convert(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver Directive::resolveDescription(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getDescription();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<std::string>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver Directive::resolveLocations(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getLocations();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<DirectiveLocation>::convert<service::TypeModifier::List>(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver Directive::resolveArgs(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getArgs();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<InputValue>::convert<service::TypeModifier::List>(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver Directive::resolveIsRepeatable(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getIsRepeatable();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<bool>::convert(std::move(result), std::move(params));
 }
@@ -20,7 +20,7 @@ namespace graphql::introspection {
 namespace object {
 
 InputValue::InputValue(std::shared_ptr<introspection::InputValue> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(__InputValue)gql"sv }
 	, _pimpl { std::make_unique<Model<introspection::InputValue>>(std::move(pimpl)) }
 {
 }
@@ -31,56 +31,52 @@ InputValue::~InputValue()
 	// of the implementation type.
 }
 
-service::TypeNames InputValue::getTypeNames() const noexcept
+const service::TypeNames& InputValue::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(__InputValue)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap InputValue::getResolvers() const noexcept
+const service::ResolverTable& InputValue::getResolvers() noexcept
 {
-	return {
-		{ R"gql(name)gql"sv, [this](service::ResolverParams&& params) { return resolveName(std::move(params)); } },
-		{ R"gql(type)gql"sv, [this](service::ResolverParams&& params) { return resolveType(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(description)gql"sv, [this](service::ResolverParams&& params) { return resolveDescription(std::move(params)); } },
-		{ R"gql(defaultValue)gql"sv, [this](service::ResolverParams&& params) { return resolveDefaultValue(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(name)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const InputValue&>(object).resolveName(std::move(params)); } },
+		{ R"gql(type)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const InputValue&>(object).resolveType(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const InputValue&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(description)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const InputValue&>(object).resolveDescription(std::move(params)); } },
+		{ R"gql(defaultValue)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const InputValue&>(object).resolveDefaultValue(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 service::AwaitableResolver InputValue::resolveName(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getName();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<std::string>::convert(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver InputValue::resolveDescription(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getDescription();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<std::string>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver InputValue::resolveType(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getType();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<Type>::convert(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver InputValue::resolveDefaultValue(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getDefaultValue();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<std::string>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -21,7 +21,7 @@ namespace graphql::introspection {
 namespace object {
 
 Schema::Schema(std::shared_ptr<introspection::Schema> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(__Schema)gql"sv }
 	, _pimpl { std::make_unique<Model<introspection::Schema>>(std::move(pimpl)) }
 {
 }
@@ -32,76 +32,68 @@ Schema::~Schema()
 	// of the implementation type.
 }
 
-service::TypeNames Schema::getTypeNames() const noexcept
+const service::TypeNames& Schema::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(__Schema)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Schema::getResolvers() const noexcept
+const service::ResolverTable& Schema::getResolvers() noexcept
 {
-	return {
-		{ R"gql(types)gql"sv, [this](service::ResolverParams&& params) { return resolveTypes(std::move(params)); } },
-		{ R"gql(queryType)gql"sv, [this](service::ResolverParams&& params) { return resolveQueryType(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(directives)gql"sv, [this](service::ResolverParams&& params) { return resolveDirectives(std::move(params)); } },
-		{ R"gql(description)gql"sv, [this](service::ResolverParams&& params) { return resolveDescription(std::move(params)); } },
-		{ R"gql(mutationType)gql"sv, [this](service::ResolverParams&& params) { return resolveMutationType(std::move(params)); } },
-		{ R"gql(subscriptionType)gql"sv, [this](service::ResolverParams&& params) { return resolveSubscriptionType(std::move(params)); } }
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(types)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Schema&>(object).resolveTypes(std::move(params)); } },
+		{ R"gql(queryType)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Schema&>(object).resolveQueryType(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Schema&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(directives)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Schema&>(object).resolveDirectives(std::move(params)); } },
+		{ R"gql(description)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Schema&>(object).resolveDescription(std::move(params)); } },
+		{ R"gql(mutationType)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Schema&>(object).resolveMutationType(std::move(params)); } },
+		{ R"gql(subscriptionType)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Schema&>(object).resolveSubscriptionType(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 service::AwaitableResolver Schema::resolveDescription(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getDescription();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<std::string>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver Schema::resolveTypes(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getTypes();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<Type>::convert<service::TypeModifier::List>(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver Schema::resolveQueryType(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getQueryType();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<Type>::convert(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver Schema::resolveMutationType(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getMutationType();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<Type>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver Schema::resolveSubscriptionType(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getSubscriptionType();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<Type>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver Schema::resolveDirectives(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getDirectives();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<Directive>::convert<service::TypeModifier::List>(std::move(result), std::move(params));
 }
@@ -23,7 +23,7 @@ namespace graphql::introspection {
 namespace object {
 
 Type::Type(std::shared_ptr<introspection::Type> pimpl) noexcept
-	: service::Object{ getTypeNames(), getResolvers() }
+	: service::Object{ getTypeNames(), getResolvers(), R"gql(__Type)gql"sv }
 	, _pimpl { std::make_unique<Model<introspection::Type>>(std::move(pimpl)) }
 {
 }
@@ -34,53 +34,51 @@ Type::~Type()
 	// of the implementation type.
 }
 
-service::TypeNames Type::getTypeNames() const noexcept
+const service::TypeNames& Type::getTypeNames() noexcept
 {
-	return {
+	static const service::TypeNames s_typeNames {
 		R"gql(__Type)gql"sv
 	};
+
+	return s_typeNames;
 }
 
-service::ResolverMap Type::getResolvers() const noexcept
-{
-	return {
-		{ R"gql(kind)gql"sv, [this](service::ResolverParams&& params) { return resolveKind(std::move(params)); } },
-		{ R"gql(name)gql"sv, [this](service::ResolverParams&& params) { return resolveName(std::move(params)); } },
-		{ R"gql(fields)gql"sv, [this](service::ResolverParams&& params) { return resolveFields(std::move(params)); } },
-		{ R"gql(ofType)gql"sv, [this](service::ResolverParams&& params) { return resolveOfType(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(enumValues)gql"sv, [this](service::ResolverParams&& params) { return resolveEnumValues(std::move(params)); } },
-		{ R"gql(interfaces)gql"sv, [this](service::ResolverParams&& params) { return resolveInterfaces(std::move(params)); } },
-		{ R"gql(description)gql"sv, [this](service::ResolverParams&& params) { return resolveDescription(std::move(params)); } },
-		{ R"gql(inputFields)gql"sv, [this](service::ResolverParams&& params) { return resolveInputFields(std::move(params)); } },
-		{ R"gql(possibleTypes)gql"sv, [this](service::ResolverParams&& params) { return resolvePossibleTypes(std::move(params)); } },
-		{ R"gql(specifiedByURL)gql"sv, [this](service::ResolverParams&& params) { return resolveSpecifiedByURL(std::move(params)); } }
+const service::ResolverTable& Type::getResolvers() noexcept
+{
+	static const service::ResolverTable s_resolvers {
+		{ R"gql(kind)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Type&>(object).resolveKind(std::move(params)); } },
+		{ R"gql(name)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Type&>(object).resolveName(std::move(params)); } },
+		{ R"gql(fields)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Type&>(object).resolveFields(std::move(params)); } },
+		{ R"gql(ofType)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Type&>(object).resolveOfType(std::move(params)); } },
+		{ R"gql(__typename)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Type&>(object).resolve_typename(std::move(params)); } },
+		{ R"gql(enumValues)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Type&>(object).resolveEnumValues(std::move(params)); } },
+		{ R"gql(interfaces)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Type&>(object).resolveInterfaces(std::move(params)); } },
+		{ R"gql(description)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Type&>(object).resolveDescription(std::move(params)); } },
+		{ R"gql(inputFields)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Type&>(object).resolveInputFields(std::move(params)); } },
+		{ R"gql(possibleTypes)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Type&>(object).resolvePossibleTypes(std::move(params)); } },
+		{ R"gql(specifiedByURL)gql"sv, [](const service::Object& object, service::ResolverParams&& params) { return static_cast<const Type&>(object).resolveSpecifiedByURL(std::move(params)); } }
 	};
+
+	return s_resolvers;
 }
 
 service::AwaitableResolver Type::resolveKind(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getKind();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<TypeKind>::convert(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver Type::resolveName(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getName();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<std::string>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver Type::resolveDescription(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getDescription();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<std::string>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -102,27 +100,21 @@ service::AwaitableResolver Type::resolveFields(service::ResolverParams&& params)
 	auto argIncludeDeprecated = (pairIncludeDeprecated.second
 		? std::move(pairIncludeDeprecated.first)
 		: service::ModifiedArgument<bool>::require<service::TypeModifier::Nullable>("includeDeprecated", defaultArguments));
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getFields(std::move(argIncludeDeprecated));
-	resolverLock.unlock();
 
 	return service::ModifiedResult<Field>::convert<service::TypeModifier::Nullable, service::TypeModifier::List>(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver Type::resolveInterfaces(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getInterfaces();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<Type>::convert<service::TypeModifier::Nullable, service::TypeModifier::List>(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver Type::resolvePossibleTypes(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getPossibleTypes();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<Type>::convert<service::TypeModifier::Nullable, service::TypeModifier::List>(std::move(result), std::move(params));
 }
@@ -144,36 +136,28 @@ service::AwaitableResolver Type::resolveEnumValues(service::ResolverParams&& par
 	auto argIncludeDeprecated = (pairIncludeDeprecated.second
 		? std::move(pairIncludeDeprecated.first)
 		: service::ModifiedArgument<bool>::require<service::TypeModifier::Nullable>("includeDeprecated", defaultArguments));
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getEnumValues(std::move(argIncludeDeprecated));
-	resolverLock.unlock();
 
 	return service::ModifiedResult<EnumValue>::convert<service::TypeModifier::Nullable, service::TypeModifier::List>(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver Type::resolveInputFields(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getInputFields();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<InputValue>::convert<service::TypeModifier::Nullable, service::TypeModifier::List>(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver Type::resolveOfType(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getOfType();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<Type>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
 
 service::AwaitableResolver Type::resolveSpecifiedByURL(service::ResolverParams&& params) const
 {
-	std::unique_lock resolverLock(_resolverMutex);
 	auto result = _pimpl->getSpecifiedByURL();
-	resolverLock.unlock();
 
 	return service::ModifiedResult<std::string>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -7,6 +7,16 @@
 
 #include "graphqlservice/JSONResponse.h"
 
+#include "graphqlservice/internal/Grammar.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <thread>
+
 using namespace graphql;
 
 using namespace std::literals;
@@ -408,3 +418,712 @@ TEST_F(CoroutineCase, QueryEverythingThreaded)
 		FAIL() << response::toJSON(ex.getErrors());
 	}
 }
+
+TEST_F(CoroutineCase, QueryEverythingPooled)
+{
+	auto query = R"(
+		query Everything {
+			appointments {
+				edges {
+					node {
+						id
+						subject
+						when
+						isNow
+						__typename
+					}
+				}
+			}
+			tasks {
+				edges {
+					node {
+						id
+						title
+						isComplete
+						__typename
+					}
+				}
+			}
+			unreadCounts {
+				edges {
+					node {
+						id
+						name
+						unreadCount
+						__typename
+					}
+				}
+			}
+		})"_graphql;
+	response::Value variables(response::Type::Map);
+	auto state = std::make_shared<today::RequestState>(4);
+	const auto worker = std::make_shared<service::await_worker_pool>(4);
+	auto result = _mockService->service
+					  ->resolve({ query,
+						  "Everything"sv,
+						  std::move(variables),
+						  service::await_async { worker },
+						  state })
+					  .get();
+	EXPECT_EQ(size_t { 1 }, _mockService->getAppointmentsCount)
+		<< "today service lazy loads the appointments and caches the result";
+	EXPECT_EQ(size_t { 1 }, _mockService->getTasksCount)
+		<< "today service lazy loads the tasks and caches the result";
+	EXPECT_EQ(size_t { 1 }, _mockService->getUnreadCountsCount)
+		<< "today service lazy loads the unreadCounts and caches the result";
+	EXPECT_EQ(size_t { 4 }, state->appointmentsRequestId)
+		<< "today service passed the same RequestState";
+	EXPECT_EQ(size_t { 4 }, state->tasksRequestId) << "today service passed the same RequestState";
+	EXPECT_EQ(size_t { 4 }, state->unreadCountsRequestId)
+		<< "today service passed the same RequestState";
+	EXPECT_EQ(size_t { 1 }, state->loadAppointmentsCount) << "today service called the loader once";
+	EXPECT_EQ(size_t { 1 }, state->loadTasksCount) << "today service called the loader once";
+	EXPECT_EQ(size_t { 1 }, state->loadUnreadCountsCount) << "today service called the loader once";
+
+	try
+	{
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		auto errorsItr = result.find("errors");
+		if (errorsItr != result.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(errorsItr->second));
+		}
+		const auto data = service::ScalarArgument::require("data", result);
+
+		const auto appointments = service::ScalarArgument::require("appointments", data);
+		const auto appointmentEdges =
+			service::ScalarArgument::require<service::TypeModifier::List>("edges", appointments);
+		ASSERT_EQ(size_t { 1 }, appointmentEdges.size()) << "appointments should have 1 entry";
+		ASSERT_TRUE(appointmentEdges[0].type() == response::Type::Map)
+			<< "appointment should be an object";
+		const auto appointmentNode = service::ScalarArgument::require("node", appointmentEdges[0]);
+		EXPECT_EQ(today::getFakeAppointmentId(),
+			service::IdArgument::require("id", appointmentNode))
+			<< "id should match in base64 encoding";
+		EXPECT_EQ("Lunch?", service::StringArgument::require("subject", appointmentNode))
+			<< "subject should match";
+		EXPECT_EQ("tomorrow", service::StringArgument::require("when", appointmentNode))
+			<< "when should match";
+		EXPECT_FALSE(service::BooleanArgument::require("isNow", appointmentNode))
+			<< "isNow should match";
+		EXPECT_EQ("Appointment", service::StringArgument::require("__typename", appointmentNode))
+			<< "__typename should match";
+
+		const auto tasks = service::ScalarArgument::require("tasks", data);
+		const auto taskEdges =
+			service::ScalarArgument::require<service::TypeModifier::List>("edges", tasks);
+		ASSERT_EQ(size_t { 1 }, taskEdges.size()) << "tasks should have 1 entry";
+		ASSERT_TRUE(taskEdges[0].type() == response::Type::Map) << "task should be an object";
+		const auto taskNode = service::ScalarArgument::require("node", taskEdges[0]);
+		EXPECT_EQ(today::getFakeTaskId(), service::IdArgument::require("id", taskNode))
+			<< "id should match in base64 encoding";
+		EXPECT_EQ("Don't forget", service::StringArgument::require("title", taskNode))
+			<< "title should match";
+		EXPECT_TRUE(service::BooleanArgument::require("isComplete", taskNode))
+			<< "isComplete should match";
+		EXPECT_EQ("Task", service::StringArgument::require("__typename", taskNode))
+			<< "__typename should match";
+
+		const auto unreadCounts = service::ScalarArgument::require("unreadCounts", data);
+		const auto unreadCountEdges =
+			service::ScalarArgument::require<service::TypeModifier::List>("edges", unreadCounts);
+		ASSERT_EQ(size_t { 1 }, unreadCountEdges.size()) << "unreadCounts should have 1 entry";
+		ASSERT_TRUE(unreadCountEdges[0].type() == response::Type::Map)
+			<< "unreadCount should be an object";
+		const auto unreadCountNode = service::ScalarArgument::require("node", unreadCountEdges[0]);
+		EXPECT_EQ(today::getFakeFolderId(), service::IdArgument::require("id", unreadCountNode))
+			<< "id should match in base64 encoding";
+		EXPECT_EQ("\"Fake\" Inbox", service::StringArgument::require("name", unreadCountNode))
+			<< "name should match";
+		EXPECT_EQ(3, service::IntArgument::require("unreadCount", unreadCountNode))
+			<< "unreadCount should match";
+		EXPECT_EQ("Folder", service::StringArgument::require("__typename", unreadCountNode))
+			<< "__typename should match";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+internal::Awaitable<int> resolveOnWorkerThread(int value)
+{
+	co_await service::await_async { std::launch::async };
+
+	if (value < 0)
+	{
+		throw std::invalid_argument("negative value");
+	}
+
+	co_return value;
+}
+
+internal::Awaitable<int> sumOnWorkerThreads(int count)
+{
+	std::vector<internal::Awaitable<int>> values;
+	int sum = 0;
+
+	values.reserve(static_cast<size_t>(count));
+
+	for (int i = 0; i < count; ++i)
+	{
+		values.push_back(resolveOnWorkerThread(i));
+	}
+
+	for (auto& value : values)
+	{
+		sum += co_await value;
+	}
+
+	co_return sum;
+}
+
+TEST(AwaitableCase, AwaitResults)
+{
+	internal::Awaitable<int> ready { 5 };
+	internal::Awaitable<int> failed { std::make_exception_ptr(std::invalid_argument("failed")) };
+
+	EXPECT_EQ(5, ready.get()) << "should return the ready value";
+	EXPECT_THROW(static_cast<void>(failed.get()), std::invalid_argument)
+		<< "should rethrow the ready exception";
+	EXPECT_EQ(4950, sumOnWorkerThreads(100).get()) << "should sum the values from each thread";
+	EXPECT_THROW(static_cast<void>(resolveOnWorkerThread(-1).get()), std::invalid_argument)
+		<< "should rethrow the exception from the worker thread";
+
+	// Destroying the awaitable before it completes should let the coroutine clean itself up.
+	static_cast<void>(resolveOnWorkerThread(1));
+}
+
+internal::Awaitable<void> recordWorker(service::await_worker_pool& pool,
+	std::thread::id blockedId, std::atomic_size_t& stolen, std::atomic_size_t& done)
+{
+	co_await pool;
+
+	if (std::this_thread::get_id() != blockedId)
+	{
+		++stolen;
+	}
+
+	++done;
+}
+
+internal::Awaitable<void> blockWorker(service::await_worker_pool& pool, size_t count,
+	std::atomic_size_t& stolen, std::atomic_size_t& done)
+{
+	co_await pool;
+
+	// Every child is queued on this worker, which won't take any of them until they are done.
+	const auto blockedId = std::this_thread::get_id();
+	std::vector<internal::Awaitable<void>> children;
+
+	children.reserve(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		children.push_back(recordWorker(pool, blockedId, stolen, done));
+	}
+
+	const auto deadline = std::chrono::steady_clock::now() + 10s;
+
+	while (done < count && std::chrono::steady_clock::now() < deadline)
+	{
+		std::this_thread::yield();
+	}
+}
+
+TEST(WorkerPoolCase, StealFromBlockedWorker)
+{
+	constexpr size_t c_children = 100;
+	service::await_worker_pool pool { 2 };
+	std::atomic_size_t stolen = 0;
+	std::atomic_size_t done = 0;
+
+	blockWorker(pool, c_children, stolen, done).get();
+
+	EXPECT_EQ(c_children, done.load()) << "should resume every child";
+	EXPECT_EQ(c_children, stolen.load()) << "another worker should steal every child";
+}
+
+internal::Awaitable<void> hopTwice(service::await_worker_pool& pool, std::atomic_size_t& hops)
+{
+	co_await pool;
+	++hops;
+	co_await pool;
+	++hops;
+}
+
+TEST(WorkerPoolCase, ShutdownFinishesPendingWork)
+{
+	constexpr size_t c_coroutines = 1000;
+	std::atomic_size_t hops = 0;
+	std::vector<internal::Awaitable<void>> coroutines;
+	std::optional<service::await_worker_pool> pool { std::in_place, 4 };
+
+	coroutines.reserve(c_coroutines);
+
+	for (size_t i = 0; i < c_coroutines; ++i)
+	{
+		coroutines.push_back(hopTwice(*pool, hops));
+	}
+
+	// The destructor should wait for everything which is queued, including the coroutines which
+	// queue themselves again during the shutdown, before it joins the workers.
+	pool.reset();
+
+	EXPECT_EQ(c_coroutines * 2, hops.load()) << "should finish every hop before shutting down";
+
+	for (auto& coroutine : coroutines)
+	{
+		EXPECT_TRUE(coroutine.await_ready()) << "should complete every coroutine";
+	}
+}
+
+TEST(ListCase, ResolveListInChunks)
+{
+	auto query = R"({ values })"_graphql;
+	const service::FragmentMap fragments;
+	const response::Value variables(response::Type::Map);
+	const std::shared_ptr<service::RequestState> state;
+	const service::Directives directives;
+	const auto worker = std::make_shared<service::await_worker_pool>(4);
+	const service::SelectionSetParams selectionSetParams {
+		service::ResolverContext::Query,
+		state,
+		directives,
+		{},
+		{},
+		{},
+		std::nullopt,
+		service::await_async { worker },
+		nullptr,
+		nullptr,
+		nullptr,
+		16,
+	};
+	std::vector<int> values(1000);
+
+	std::iota(values.begin(), values.end(), 0);
+
+	auto result = service::IntResult::convert<service::TypeModifier::List>(values,
+		service::ResolverParams { selectionSetParams,
+			*query.root,
+			"values"s,
+			response::Value(response::Type::Map),
+			{},
+			nullptr,
+			fragments,
+			variables })
+					  .get();
+
+	EXPECT_TRUE(result.errors.empty()) << "should not fail";
+	ASSERT_EQ(values.size(), result.data.size()) << "should resolve every element";
+
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		EXPECT_EQ(values[i], result.data[i].get<int>()) << "should keep the elements in order";
+	}
+}
+
+TEST(ListCase, CancelledListIsNull)
+{
+	auto query = R"({ values })"_graphql;
+	const service::FragmentMap fragments;
+	const response::Value variables(response::Type::Map);
+	const std::shared_ptr<service::RequestState> state;
+	const service::Directives directives;
+	const auto worker = std::make_shared<service::await_worker_pool>(4);
+	std::stop_source stop;
+	service::RequestCancellation cancellation { stop.get_token() };
+	const service::SelectionSetParams selectionSetParams {
+		service::ResolverContext::Query,
+		state,
+		directives,
+		{},
+		{},
+		{},
+		std::make_optional(service::field_path { std::nullopt, service::path_segment { "values"sv } }),
+		service::await_async { worker },
+		nullptr,
+		&cancellation,
+		nullptr,
+		16,
+	};
+	std::vector<int> values(1000);
+
+	stop.request_stop();
+
+	try
+	{
+		auto result = service::IntResult::convert<service::TypeModifier::List>(values,
+			service::ResolverParams { selectionSetParams,
+				*query.root,
+				"values"s,
+				response::Value(response::Type::Map),
+				{},
+				nullptr,
+				fragments,
+				variables })
+						  .get();
+
+		FAIL() << "should not return a partial list";
+	}
+	catch (service::schema_exception& ex)
+	{
+		const auto errors = ex.getStructuredErrors();
+
+		ASSERT_EQ(size_t { 1 }, errors.size()) << "should report the cancellation once";
+		EXPECT_EQ("Request cancelled", errors.front().message) << "should report the cancellation";
+		ASSERT_EQ(size_t { 1 }, errors.front().path.size()) << "should point at the list field";
+		EXPECT_EQ("values", std::get<std::string_view>(errors.front().path.front()))
+			<< "should point at the list field";
+	}
+}
+
+template <service::TypeModifier... Modifiers>
+response::Value convertFailingObjects(service::await_async launch, size_t listGrainSize)
+{
+	auto query = R"({ values })"_graphql;
+	const service::FragmentMap fragments;
+	const response::Value variables(response::Type::Map);
+	const std::shared_ptr<service::RequestState> state;
+	const service::Directives directives;
+	const service::SelectionSetParams selectionSetParams {
+		service::ResolverContext::Query,
+		state,
+		directives,
+		{},
+		{},
+		{},
+		std::make_optional(service::field_path { std::nullopt, service::path_segment { "values"sv } }),
+		std::move(launch),
+		nullptr,
+		nullptr,
+		nullptr,
+		listGrainSize,
+	};
+	const service::TypeNames typeNames { "Value"sv };
+	std::vector<std::shared_ptr<service::Object>> values(8);
+
+	for (auto& value : values)
+	{
+		value = std::make_shared<service::Object>(service::TypeNames { typeNames },
+			service::ResolverMap {});
+	}
+
+	// Each element fails because the object field has no selection set.
+	auto result = service::ObjectResult::convert<Modifiers...>(std::move(values),
+		service::ResolverParams { selectionSetParams,
+			*query.root,
+			"values"s,
+			response::Value(response::Type::Map),
+			{},
+			nullptr,
+			fragments,
+			variables })
+					  .get();
+
+	EXPECT_EQ(size_t { 8 }, result.errors.size()) << "should report every element error";
+
+	return std::move(result.data);
+}
+
+TEST(ListCase, NullableElementErrorIsNull)
+{
+	const auto data =
+		convertFailingObjects<service::TypeModifier::List, service::TypeModifier::Nullable>({},
+			0);
+
+	ASSERT_TRUE(data.type() == response::Type::List) << "should keep the list";
+	ASSERT_EQ(size_t { 8 }, data.size()) << "should keep every element";
+
+	for (size_t i = 0; i < data.size(); ++i)
+	{
+		EXPECT_TRUE(data[i].type() == response::Type::Null) << "should replace the element";
+	}
+}
+
+TEST(ListCase, NonNullElementErrorNullsList)
+{
+	const auto worker = std::make_shared<service::await_worker_pool>(4);
+
+	for (const auto listGrainSize : { size_t { 0 }, size_t { 3 } })
+	{
+		try
+		{
+			const auto data = convertFailingObjects<service::TypeModifier::List>(
+				service::await_async { worker },
+				listGrainSize);
+
+			FAIL() << "should not return a list with null elements";
+		}
+		catch (service::schema_exception& ex)
+		{
+			EXPECT_EQ(size_t { 8 }, ex.getStructuredErrors().size())
+				<< "should report every element error";
+		}
+	}
+}
+
+TEST(ListCase, StreamedNullableElementErrorIsNull)
+{
+	auto query = R"({ values })"_graphql;
+	const service::FragmentMap fragments;
+	const response::Value variables(response::Type::Map);
+	const std::shared_ptr<service::RequestState> state;
+	const service::Directives directives;
+	const service::SelectionSetParams selectionSetParams {
+		service::ResolverContext::Query,
+		state,
+		directives,
+		{},
+		{},
+		{},
+		std::make_optional(service::field_path { std::nullopt, service::path_segment { "values"sv } }),
+		{},
+		nullptr,
+		nullptr,
+		nullptr,
+		0,
+		nullptr,
+		true,
+	};
+	const service::TypeNames typeNames { "Value"sv };
+	std::vector<std::shared_ptr<service::Object>> values(3);
+
+	for (auto& value : values)
+	{
+		value = std::make_shared<service::Object>(service::TypeNames { typeNames },
+			service::ResolverMap {});
+	}
+
+	// Each element fails because the object field has no selection set.
+	auto result =
+		service::ObjectResult::convert<service::TypeModifier::List,
+			service::TypeModifier::Nullable>(std::move(values),
+			service::ResolverParams { selectionSetParams,
+				*query.root,
+				"values"s,
+				response::Value(response::Type::Map),
+				{},
+				nullptr,
+				fragments,
+				variables })
+			.get();
+
+	ASSERT_TRUE(result.stream) << "should stream the list";
+
+	std::ostringstream stream;
+	const auto writer = response::makeJSONWriter(stream);
+
+	result.stream->prepare().get();
+
+	const auto errors = result.stream->write(writer).get();
+
+	EXPECT_EQ(size_t { 3 }, errors.size()) << "should report every element error";
+	EXPECT_EQ("[null,null,null]", stream.str()) << "should write each element as null";
+}
+
+TEST(ListCase, StreamedNonNullElementErrorWritesNothing)
+{
+	auto query = R"({ values })"_graphql;
+	const service::FragmentMap fragments;
+	const response::Value variables(response::Type::Map);
+	const std::shared_ptr<service::RequestState> state;
+	const service::Directives directives;
+	const auto worker = std::make_shared<service::await_worker_pool>(4);
+	const service::TypeNames typeNames { "Value"sv };
+
+	for (const auto listGrainSize : { size_t { 0 }, size_t { 3 } })
+	{
+		const service::SelectionSetParams selectionSetParams {
+			service::ResolverContext::Query,
+			state,
+			directives,
+			{},
+			{},
+			{},
+			std::make_optional(
+				service::field_path { std::nullopt, service::path_segment { "values"sv } }),
+			service::await_async { worker },
+			nullptr,
+			nullptr,
+			nullptr,
+			listGrainSize,
+			nullptr,
+			true,
+		};
+		std::vector<std::shared_ptr<service::Object>> values(8);
+
+		for (auto& value : values)
+		{
+			value = std::make_shared<service::Object>(service::TypeNames { typeNames },
+				service::ResolverMap {});
+		}
+
+		auto result = service::ObjectResult::convert<service::TypeModifier::List>(
+			std::move(values),
+			service::ResolverParams { selectionSetParams,
+				*query.root,
+				"values"s,
+				response::Value(response::Type::Map),
+				{},
+				nullptr,
+				fragments,
+				variables })
+						  .get();
+
+		ASSERT_TRUE(result.stream) << "should stream the list";
+
+		try
+		{
+			result.stream->prepare().get();
+
+			FAIL() << "should not write a list with null elements";
+		}
+		catch (service::schema_exception& ex)
+		{
+			EXPECT_EQ(size_t { 8 }, ex.getStructuredErrors().size())
+				<< "should report every element error";
+		}
+	}
+}
+
+struct BatchingRequestState : service::RequestState
+{
+	std::mutex mutex;
+	std::vector<std::vector<int>> batches;
+	service::DataLoader<int, int> loader { *this, [this](std::vector<int> keys) {
+											  std::unique_lock lock { mutex };
+
+											  batches.push_back(keys);
+											  lock.unlock();
+
+											  for (auto& key : keys)
+											  {
+												  key *= 10;
+											  }
+
+											  return internal::Awaitable<std::vector<int>> {
+												  std::move(keys)
+											  };
+										  } };
+};
+
+internal::Awaitable<int> loadTwice(BatchingRequestState& state, int key)
+{
+	const auto first = co_await state.loader.load(key);
+
+	co_return co_await state.loader.load(first + 1);
+}
+
+TEST(DataLoaderCase, BatchSiblingLoads)
+{
+	BatchingRequestState state;
+	std::vector<internal::Awaitable<int>> results;
+
+	state.beginBatch();
+	results.push_back(loadTwice(state, 1));
+	results.push_back(loadTwice(state, 2));
+	results.push_back(loadTwice(state, 1));
+
+	ASSERT_TRUE(state.batches.empty()) << "should wait for the batch to end";
+
+	state.endBatch();
+
+	ASSERT_EQ(size_t { 2 }, state.batches.size()) << "should batch each level once";
+	EXPECT_EQ((std::vector<int> { 1, 2 }), state.batches[0]) << "should dedupe the keys";
+	EXPECT_EQ((std::vector<int> { 11, 21 }), state.batches[1]) << "should batch the next level";
+	EXPECT_EQ(110, results[0].get());
+	EXPECT_EQ(210, results[1].get());
+	EXPECT_EQ(110, results[2].get());
+
+	EXPECT_EQ(110, loadTwice(state, 1).get());
+	EXPECT_EQ(size_t { 2 }, state.batches.size()) << "should cache the values";
+}
+
+service::AwaitableScalar<int> loadValue(BatchingRequestState& state, int key)
+{
+	co_return co_await state.loader.load(key);
+}
+
+TEST(DataLoaderCase, BatchSiblingLoadsOnWorkerPool)
+{
+	auto query = R"({ values { value } })"_graphql;
+	const peg::ast_node* field = nullptr;
+	const peg::ast_node* selection = nullptr;
+
+	peg::on_first_child<peg::selection_set>(*query.root->children.front(),
+		[&field, &selection](const peg::ast_node& operationSelection) {
+			peg::on_first_child<peg::field>(operationSelection,
+				[&field, &selection](const peg::ast_node& child) {
+					field = &child;
+					peg::on_first_child<peg::selection_set>(child,
+						[&selection](const peg::ast_node& fieldSelection) {
+							selection = &fieldSelection;
+						});
+				});
+		});
+
+	ASSERT_NE(nullptr, selection) << "should find the selection set";
+
+	const service::FragmentMap fragments;
+	const response::Value variables(response::Type::Map);
+	const auto batchingState = std::make_shared<BatchingRequestState>();
+	const std::shared_ptr<service::RequestState> state = batchingState;
+	const service::Directives directives;
+	const service::SelectionSetParams selectionSetParams {
+		service::ResolverContext::Query,
+		state,
+		directives,
+		{},
+		{},
+		{},
+		std::make_optional(service::field_path { std::nullopt, service::path_segment { "values"sv } }),
+		service::await_async { std::make_shared<service::await_worker_pool>(4) },
+	};
+	const service::TypeNames typeNames { "Value"sv };
+	std::vector<std::shared_ptr<service::Object>> values;
+
+	for (int key = 1; key <= 8; ++key)
+	{
+		service::ResolverMap resolvers;
+
+		resolvers.emplace("value"sv, [key](service::ResolverParams&& params) {
+			auto& requestState = static_cast<BatchingRequestState&>(*params.state);
+
+			return service::IntResult::convert(loadValue(requestState, key), std::move(params));
+		});
+
+		values.push_back(std::make_shared<service::Object>(service::TypeNames { typeNames },
+			std::move(resolvers)));
+	}
+
+	// Each element hops to a worker thread before it calls the field getter.
+	auto result = service::ObjectResult::convert<service::TypeModifier::List>(std::move(values),
+		service::ResolverParams { selectionSetParams,
+			*field,
+			"values"s,
+			response::Value(response::Type::Map),
+			{},
+			selection,
+			fragments,
+			variables })
+					  .get();
+
+	ASSERT_TRUE(result.errors.empty()) << "should not report any errors";
+	ASSERT_EQ(size_t { 1 }, batchingState->batches.size()) << "should batch every element once";
+
+	auto keys = batchingState->batches.front();
+
+	std::sort(keys.begin(), keys.end());
+	EXPECT_EQ((std::vector<int> { 1, 2, 3, 4, 5, 6, 7, 8 }), keys) << "should load every key";
+	ASSERT_TRUE(result.data.type() == response::Type::List) << "should resolve the list";
+	ASSERT_EQ(size_t { 8 }, result.data.size()) << "should resolve every element";
+
+	for (size_t i = 0; i < result.data.size(); ++i)
+	{
+		EXPECT_EQ(static_cast<int>(i + 1) * 10,
+			service::IntArgument::require("value", result.data[i]))
+			<< "should resolve the loaded value";
+	}
+}
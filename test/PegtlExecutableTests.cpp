@@ -6,14 +6,66 @@
 #include "graphqlservice/GraphQLParse.h"
 
 #include "graphqlservice/internal/Grammar.h"
+#include "graphqlservice/internal/SyntaxTree.h"
 
 #include <tao/pegtl/contrib/analyze.hpp>
 
+#include <cstdlib>
+#include <new>
+#include <string>
+
 using namespace graphql;
 using namespace graphql::peg;
 
 using namespace tao::graphqlpeg;
 
+namespace {
+
+// Count the global heap allocations made on this thread while a test is counting them.
+thread_local bool t_countAllocations = false;
+thread_local size_t t_allocations = 0;
+
+size_t countParseAllocations(std::string_view input)
+{
+	t_allocations = 0;
+	t_countAllocations = true;
+
+	auto query = peg::parseString(input);
+
+	t_countAllocations = false;
+
+	EXPECT_NE(nullptr, query.root) << "should parse the query";
+
+	return t_allocations;
+}
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+	if (t_countAllocations)
+	{
+		++t_allocations;
+	}
+
+	if (auto ptr = std::malloc(size == 0 ? 1 : size))
+	{
+		return ptr;
+	}
+
+	throw std::bad_alloc {};
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+	std::free(ptr);
+}
+
 TEST(PegtlExecutableCase, ParseKitchenSinkQuery)
 {
 	memory_input<> input(R"gql(
@@ -229,4 +281,54 @@ TEST(PegtlExecutableCase, ParserDepthLimitExceeded)
 
 	EXPECT_TRUE(caughtException) << "should catch a parse exception";
 	EXPECT_FALSE(parsedQuery) << "should not successfully parse the query";
-}
\ No newline at end of file
+}
+
+TEST(PegtlExecutableCase, ParsedNodesOutliveDocument)
+{
+	std::shared_ptr<peg::ast_node> root;
+
+	{
+		auto query = peg::parseString(R"gql(query {
+				foo(arg: "escaped \"string\"") {
+					bar
+				}
+			})gql"sv);
+
+		root = query.root;
+	}
+
+	ASSERT_NE(nullptr, root) << "should parse the query";
+	ASSERT_EQ(size_t { 1 }, root->children.size()) << "should have one operation definition";
+
+	// The nodes and the arena they were allocated from belong to the root, so the tree can still
+	// be walked. The input buffer belonged to the document, and it was freed with the document, so
+	// anything which views the input, e.g. string_view() or unescaped_view(), is no longer valid.
+	const auto& operation = *root->children.front();
+
+	EXPECT_TRUE(operation.is_type<peg::operation_definition>()) << "should be an operation";
+	EXPECT_FALSE(operation.children.empty()) << "should keep the child nodes";
+}
+
+TEST(PegtlExecutableCase, ParseAllocatesNodesFromArena)
+{
+	std::string input { "query {\n" };
+
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		const auto index = std::to_string(i);
+
+		input.append("\tfield").append(index).append("(arg: ").append(index).append(") { id }\n");
+	}
+
+	input.append("}");
+
+	const auto smallAllocations =
+		countParseAllocations(R"gql(query { field0(arg: 0) { id } })gql"sv);
+	const auto largeAllocations = countParseAllocations(input);
+
+	// The document and the input buffer take a few allocations, and the arena grows geometrically,
+	// but none of the nodes or their child lists should come from the global heap.
+	EXPECT_GE(smallAllocations + 16, largeAllocations)
+		<< "the number of allocations should not grow with the number of nodes";
+	EXPECT_GT(size_t { 64 }, largeAllocations) << "should only allocate a handful of times";
+}
@@ -4,9 +4,16 @@
 #include <gtest/gtest.h>
 
 #include "graphqlservice/GraphQLResponse.h"
+#include "graphqlservice/JSONResponse.h"
+
+#include "graphqlservice/internal/Base64.h"
+
+#include <random>
 
 using namespace graphql;
 
+using namespace std::literals;
+
 TEST(ResponseCase, ValueConstructorFromStringLiteral)
 {
 	auto expected = "Test String";
@@ -33,3 +40,129 @@ TEST(ResponseCase, IdTypeCompareEqual)
 	EXPECT_TRUE(fakeId == response::IdType { "ZmFrZUlk" })
 		<< "actual string should compare as equal";
 }
+
+TEST(ResponseCase, MapKeySharesInternedString)
+{
+	const auto interned = std::make_shared<const std::string>("alias");
+	response::Value first(response::Type::Map);
+	response::Value second(response::Type::Map);
+
+	ASSERT_TRUE(first.emplace_back(response::MapKey { interned }, response::Value(1)));
+	ASSERT_TRUE(second.emplace_back(response::MapKey { interned }, response::Value(2)));
+	ASSERT_FALSE(first.emplace_back(std::string { "alias" }, response::Value(3)))
+		<< "an owned key should still match an interned key";
+
+	const std::string& firstKey = first.begin()->first;
+	const std::string& secondKey = second.begin()->first;
+
+	EXPECT_EQ(&firstKey, interned.get()) << "should not copy the interned string";
+	EXPECT_EQ(&firstKey, &secondKey) << "should share the interned string";
+	EXPECT_TRUE(first.begin()->first == "alias") << "should compare with a string";
+	EXPECT_TRUE(first.find("alias") != first.end()) << "should find the interned key";
+}
+
+TEST(ResponseCase, ParseJSONWithEmbeddedNull)
+{
+	const auto json = R"js({"key\u0000":"value\u0000"})js"sv;
+	auto parsed = response::parseJSON(json);
+
+	ASSERT_TRUE(response::Type::Map == parsed.type());
+	ASSERT_EQ(size_t { 1 }, parsed.size());
+	EXPECT_EQ("key\0"sv, std::string_view { parsed.begin()->first });
+	EXPECT_EQ("value\0"sv, parsed.begin()->second.get<response::StringType>());
+}
+
+TEST(ResponseCase, ParseJSONInSitu)
+{
+	std::string json { R"js({"list":[1,"two",3.5,null,true]})js" };
+	auto parsed = response::parseJSONInSitu(json);
+	const auto& list = parsed["list"sv].get<response::ListType>();
+
+	ASSERT_EQ(size_t { 5 }, list.size());
+	EXPECT_EQ(1, list[0].get<response::IntType>());
+	EXPECT_EQ("two", list[1].get<response::StringType>());
+	EXPECT_EQ(3.5, list[2].get<response::FloatType>());
+	EXPECT_TRUE(response::Type::Null == list[3].type());
+	EXPECT_TRUE(list[4].get<response::BooleanType>());
+}
+
+TEST(ResponseCase, ParseJSONReportsErrorOffset)
+{
+	try
+	{
+		auto parsed = response::parseJSON(R"js({"key":"value",})js"sv);
+		FAIL() << "should throw a json_exception";
+	}
+	catch (const response::json_exception& ex)
+	{
+		EXPECT_EQ(size_t { 15 }, ex.offset()) << "should report where the member name is missing";
+	}
+
+	EXPECT_THROW(auto parsed = response::parseJSON("{} {}"sv), response::json_exception)
+		<< "should not ignore trailing values";
+	EXPECT_THROW(auto parsed = response::parseJSON(std::string_view { "{}\0{}", 5 }),
+		response::json_exception)
+		<< "should not stop at a null character";
+}
+
+std::string referenceToBase64(const std::vector<std::uint8_t>& bytes)
+{
+	constexpr std::string_view alphabet {
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+	};
+	std::string result;
+
+	for (size_t i = 0; i < bytes.size(); i += 3)
+	{
+		const size_t count = std::min<size_t>(3, bytes.size() - i);
+		std::uint32_t segment = static_cast<std::uint32_t>(bytes[i]) << 16;
+
+		segment |= (count > 1) ? static_cast<std::uint32_t>(bytes[i + 1]) << 8 : 0;
+		segment |= (count > 2) ? static_cast<std::uint32_t>(bytes[i + 2]) : 0;
+
+		for (size_t j = 0; j < 4; ++j)
+		{
+			result.push_back(j <= count ? alphabet[(segment >> (18 - (6 * j))) & 0x3F] : '=');
+		}
+	}
+
+	return result;
+}
+
+TEST(ResponseCase, Base64MatchesReference)
+{
+	std::mt19937 random { 20240917 };
+	std::uniform_int_distribution<int> byteValue { 0, 255 };
+
+	for (size_t size = 0; size < 200; ++size)
+	{
+		std::vector<std::uint8_t> bytes(size);
+
+		for (auto& byte : bytes)
+		{
+			byte = static_cast<std::uint8_t>(byteValue(random));
+		}
+
+		const auto encoded = internal::Base64::toBase64(bytes);
+
+		ASSERT_EQ(referenceToBase64(bytes), encoded) << "size: " << size;
+		ASSERT_EQ(bytes, internal::Base64::fromBase64(encoded)) << "size: " << size;
+		ASSERT_TRUE(internal::Base64::validateBase64(encoded)) << "size: " << size;
+
+		if (encoded.empty())
+		{
+			continue;
+		}
+
+		// Corrupt a single character anywhere in the string, including the middle of a block
+		// which would otherwise be decoded 16 characters at a time.
+		std::uniform_int_distribution<size_t> position { 0, encoded.size() - 1 };
+		auto corrupted = encoded;
+
+		corrupted[position(random)] = '*';
+
+		EXPECT_THROW(auto decoded = internal::Base64::fromBase64(corrupted), std::logic_error)
+			<< "size: " << size;
+		EXPECT_FALSE(internal::Base64::validateBase64(corrupted)) << "size: " << size;
+	}
+}
@@ -0,0 +1,166 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <gtest/gtest.h>
+
+#include "TodayMock.h"
+
+#include "graphqlservice/JSONResponse.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace graphql;
+
+using namespace std::literals;
+
+// The today sample in this test is generated with schemagen --thread-safe-resolvers, so the
+// resolver mutex is only skipped for implementation types which declare threadSafeResolvers.
+
+namespace {
+
+// Track how many callers are inside a field getter at the same time. Each caller waits for the
+// rest of them to arrive, or for the timeout if the resolver mutex keeps them out.
+class ConcurrentCalls
+{
+public:
+	explicit ConcurrentCalls(size_t callers, std::chrono::milliseconds timeout) noexcept
+		: _callers { callers }
+		, _timeout { timeout }
+	{
+	}
+
+	void enter()
+	{
+		std::unique_lock lock(_mutex);
+
+		_peak = std::max(++_inside, _peak);
+		_condition.notify_all();
+		_condition.wait_for(lock, _timeout, [this]() noexcept {
+			return _peak == _callers;
+		});
+		--_inside;
+	}
+
+	size_t peak()
+	{
+		std::unique_lock lock(_mutex);
+
+		return _peak;
+	}
+
+private:
+	const size_t _callers;
+	const std::chrono::milliseconds _timeout;
+
+	std::mutex _mutex;
+	std::condition_variable _condition;
+	size_t _inside = 0;
+	size_t _peak = 0;
+};
+
+template <bool ThreadSafe>
+class DefaultQuery
+{
+public:
+	static constexpr bool threadSafeResolvers = ThreadSafe;
+
+	explicit DefaultQuery(ConcurrentCalls& calls) noexcept
+		: _calls { calls }
+	{
+	}
+
+	std::optional<std::string> getDefault() const
+	{
+		_calls.enter();
+
+		return "Default"s;
+	}
+
+private:
+	ConcurrentCalls& _calls;
+};
+
+class EmptyMutation
+{
+};
+
+template <bool ThreadSafe>
+size_t resolveConcurrently(size_t callers, std::chrono::milliseconds timeout)
+{
+	ConcurrentCalls calls { callers, timeout };
+	auto query = std::make_shared<DefaultQuery<ThreadSafe>>(calls);
+	auto mutation = std::make_shared<EmptyMutation>();
+	auto service = std::make_shared<today::Operations>(std::move(query), std::move(mutation));
+	std::vector<response::Value> results(callers);
+	std::vector<std::thread> threads;
+
+	threads.reserve(callers);
+
+	for (auto& result : results)
+	{
+		threads.emplace_back([&service, &result]() {
+			auto request = R"({ default })"_graphql;
+
+			result = service->resolve({ request }).get();
+		});
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	for (auto& result : results)
+	{
+		EXPECT_TRUE(result.type() == response::Type::Map);
+		auto errorsItr = result.find("errors");
+		if (errorsItr != result.get<response::MapType>().cend())
+		{
+			ADD_FAILURE() << response::toJSON(response::Value(errorsItr->second));
+			continue;
+		}
+		const auto data = service::ScalarArgument::require("data", result);
+
+		EXPECT_EQ("Default", service::StringArgument::require("default", data))
+			<< "default should match";
+	}
+
+	return calls.peak();
+}
+
+} // namespace
+
+TEST(ThreadSafeCase, ThreadSafeTypeSkipsResolverMutex)
+{
+	constexpr size_t callers = 4;
+
+	try
+	{
+		EXPECT_EQ(callers, resolveConcurrently<true>(callers, 10s))
+			<< "every caller should be inside getDefault at the same time";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST(ThreadSafeCase, OtherTypesKeepResolverMutex)
+{
+	constexpr size_t callers = 2;
+
+	try
+	{
+		EXPECT_EQ(size_t { 1 }, resolveConcurrently<false>(callers, 100ms))
+			<< "the resolver mutex should serialize the calls to getDefault";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
@@ -5,9 +5,20 @@
 
 #include "TodayMock.h"
 
+#include "graphqlservice/GraphQLTracing.h"
 #include "graphqlservice/JSONResponse.h"
 
+#include "graphqlservice/internal/Introspection.h"
+
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <future>
+#include <memory_resource>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
 
 using namespace graphql;
 
@@ -2084,3 +2095,1388 @@ TEST_F(TodayServiceCase, MutateCoerceSetFloat)
 		FAIL() << response::toJSON(ex.getErrors());
 	}
 }
+
+TEST_F(TodayServiceCase, QueryDocumentCache)
+{
+	constexpr auto queryText = R"(query {
+			tasks {
+				edges {
+					node {
+						...TaskFields
+					}
+				}
+			}
+		}
+
+		fragment TaskFields on Task {
+			id
+			title
+			isComplete
+		})"sv;
+	service::DocumentCache documentCache { _mockService->service, 1 };
+	auto document = documentCache.getDocument(queryText);
+	auto cachedDocument = documentCache.getDocument(queryText);
+
+	ASSERT_EQ(document, cachedDocument) << "should return the same cached document";
+	ASSERT_TRUE(document->query.validated) << "should cache the validated query";
+	ASSERT_TRUE(document->fragments) << "should collect fragments without directives once";
+
+	auto query = document->query;
+	response::Value variables(response::Type::Map);
+	auto state = std::make_shared<today::RequestState>(23);
+	auto result = _mockService->service
+					  ->resolve({ query, {}, std::move(variables), {}, state, document->fragments })
+					  .get();
+
+	try
+	{
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		auto errorsItr = result.find("errors");
+		if (errorsItr != result.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(errorsItr->second));
+		}
+		const auto data = service::ScalarArgument::require("data", result);
+
+		const auto tasks = service::ScalarArgument::require("tasks", data);
+		const auto taskEdges =
+			service::ScalarArgument::require<service::TypeModifier::List>("edges", tasks);
+		ASSERT_EQ(size_t { 1 }, taskEdges.size()) << "tasks should have 1 entry";
+		const auto taskNode = service::ScalarArgument::require("node", taskEdges[0]);
+		EXPECT_EQ(today::getFakeTaskId(), service::IdArgument::require("id", taskNode))
+			<< "id should match in base64 encoding";
+		EXPECT_EQ("Don't forget", service::StringArgument::require("title", taskNode))
+			<< "title should match";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+
+	documentCache.addPersistedDocument("persisted"sv, "{ __typename }"sv);
+
+	ASSERT_EQ(nullptr, documentCache.findPersistedDocument("missing"sv))
+		<< "should not find a missing persisted document";
+	ASSERT_NE(nullptr, documentCache.findPersistedDocument("persisted"sv))
+		<< "should find the persisted document";
+
+	const auto stats = documentCache.getStats();
+
+	ASSERT_EQ(size_t { 2 }, stats.hits) << "should count the cache hits";
+	ASSERT_EQ(size_t { 2 }, stats.misses) << "should count the cache misses";
+	ASSERT_EQ(size_t { 1 }, stats.evictions) << "should evict the query with a capacity of 1";
+	ASSERT_EQ(size_t { 1 }, stats.size) << "should only hold 1 document";
+}
+
+TEST_F(TodayServiceCase, QueryDocumentCacheValidationError)
+{
+	service::DocumentCache documentCache { _mockService->service };
+
+	try
+	{
+		auto document = documentCache.getDocument("{ unknownField }"sv);
+
+		FAIL() << "should throw a schema_exception for an invalid query";
+	}
+	catch (const service::schema_exception&)
+	{
+	}
+
+	ASSERT_EQ(size_t { 0 }, documentCache.getStats().size) << "should not cache invalid queries";
+}
+
+TEST_F(TodayServiceCase, QueryStreamedJSON)
+{
+	auto query = R"(query {
+			appointments {
+				edges {
+					node {
+						id
+						subject
+						when
+						isNow
+					}
+				}
+			}
+			tasks {
+				edges {
+					node {
+						id
+						title
+					}
+				}
+			}
+		})"_graphql;
+	auto state = std::make_shared<today::RequestState>(24);
+	const auto expected =
+		response::toJSON(_mockService->service->resolve({ query, {}, {}, {}, state }).get());
+	std::ostringstream stream;
+	const auto writer = response::makeJSONWriter(stream);
+
+	_mockService->service->resolve({ query, {}, {}, {}, state }, writer).get();
+
+	EXPECT_EQ(expected, stream.str()) << "should stream the same JSON as toJSON";
+}
+
+TEST_F(TodayServiceCase, QueryStreamedJSONError)
+{
+	auto query = R"(query {
+			unknownField
+		})"_graphql;
+	const auto expected = response::toJSON(_mockService->service->resolve({ query }).get());
+	std::ostringstream stream;
+	const auto writer = response::makeJSONWriter(stream);
+
+	_mockService->service->resolve({ query }, writer).get();
+
+	EXPECT_EQ(expected, stream.str()) << "should stream the same errors as toJSON";
+}
+
+TEST_F(TodayServiceCase, QueryStreamedNestedErrors)
+{
+	auto query = R"(query {
+			appointments {
+				edges {
+					node {
+						id
+						forceError
+					}
+				}
+			}
+			nested {
+				depth
+				nested {
+					depth
+				}
+			}
+			unimplemented
+		})"_graphql;
+	const auto expected = response::toJSON(_mockService->service->resolve({ query }).get());
+	std::ostringstream stream;
+	const auto writer = response::makeJSONWriter(stream);
+
+	_mockService->service->resolve({ query }, writer).get();
+
+	EXPECT_EQ(expected, stream.str()) << "should stream the same nested errors as toJSON";
+}
+
+TEST_F(TodayServiceCase, SubscribeUnsubscribeConcurrently)
+{
+	constexpr size_t c_threadCount = 4;
+	constexpr size_t c_subscriptionsPerThread = 25;
+	auto query = peg::parseString(R"(subscription {
+			nextAppointmentChange {
+				id
+			}
+		})");
+	std::atomic_size_t delivered = 0;
+	std::vector<std::vector<service::SubscriptionKey>> keys(c_threadCount);
+	std::vector<std::thread> threads;
+
+	ASSERT_TRUE(_mockService->service->validate(query).empty()) << "should validate the query";
+
+	for (auto& threadKeys : keys)
+	{
+		threads.emplace_back([this, &query, &delivered, &threadKeys]() {
+			for (size_t i = 0; i < c_subscriptionsPerThread; ++i)
+			{
+				threadKeys.push_back(_mockService->service
+										 ->subscribe({ [&delivered](response::Value&&) {
+														  ++delivered;
+													  },
+											 peg::ast { query } })
+										 .get());
+			}
+		});
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	threads.clear();
+	_mockService->service->deliver({ "nextAppointmentChange"sv }).get();
+
+	EXPECT_EQ(c_threadCount * c_subscriptionsPerThread, delivered)
+		<< "should deliver to every subscription once";
+
+	for (auto& threadKeys : keys)
+	{
+		threads.emplace_back([this, &threadKeys]() {
+			for (const auto key : threadKeys)
+			{
+				_mockService->service->unsubscribe({ key }).get();
+			}
+		});
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	_mockService->service->deliver({ "nextAppointmentChange"sv }).get();
+
+	EXPECT_EQ(c_threadCount * c_subscriptionsPerThread, delivered)
+		<< "should not deliver after unsubscribing";
+}
+
+TEST_F(TodayServiceCase, DeliverSharedSubscriptions)
+{
+	auto state = std::make_shared<today::RequestState>(23);
+	auto otherState = std::make_shared<today::RequestState>(24);
+	std::vector<response::Value> documents;
+	std::mutex documentsMutex;
+	const auto subscribe = [this, &documents, &documentsMutex](
+							   std::shared_ptr<today::RequestState> subscriptionState) {
+		// Parse the query separately for each subscription, they should still share results.
+		return _mockService->service
+			->subscribe({
+				[&documents, &documentsMutex](response::Value&& document) {
+					std::lock_guard lock { documentsMutex };
+
+					documents.push_back(std::move(document));
+				},
+				peg::parseString(R"(subscription {
+					nextAppointmentChange {
+						id
+						subject
+					}
+				})"),
+				{},
+				response::Value(response::Type::Map),
+				{},
+				std::move(subscriptionState),
+			})
+			.get();
+	};
+	const std::vector<service::SubscriptionKey> keys {
+		subscribe(state),
+		subscribe(state),
+		subscribe(otherState),
+	};
+	const auto subscriptionBegin =
+		today::NextAppointmentChange::getCount(service::ResolverContext::Subscription);
+
+	_mockService->service->deliver({ "nextAppointmentChange"sv, {}, std::launch::async }).get();
+
+	const auto subscriptionEnd =
+		today::NextAppointmentChange::getCount(service::ResolverContext::Subscription);
+
+	for (const auto key : keys)
+	{
+		_mockService->service->unsubscribe({ key }).get();
+	}
+
+	EXPECT_EQ(subscriptionBegin + 2, subscriptionEnd)
+		<< "should resolve identical subscriptions once";
+	ASSERT_EQ(size_t { 3 }, documents.size()) << "should deliver to every subscription";
+
+	for (const auto& document : documents)
+	{
+		EXPECT_TRUE(document == documents.front()) << "should deliver the same payload";
+	}
+}
+
+TEST_F(TodayServiceCase, DeliverSharedSubscriptionsWhenCallbackThrows)
+{
+	auto state = std::make_shared<today::RequestState>(41);
+	std::vector<response::Value> documents;
+	std::mutex documentsMutex;
+	const auto subscribe = [this, &state](service::SubscriptionCallback callback) {
+		return _mockService->service
+			->subscribe({
+				std::move(callback),
+				peg::parseString(R"(subscription {
+					nextAppointmentChange {
+						id
+						subject
+					}
+				})"),
+				{},
+				response::Value(response::Type::Map),
+				{},
+				state,
+			})
+			.get();
+	};
+	size_t calls = 0;
+	// Whichever callback the group calls first throws, the others should still get the payload.
+	const auto callback = [&documents, &documentsMutex, &calls](response::Value&& document) {
+		std::lock_guard lock { documentsMutex };
+
+		if (calls++ == 0)
+		{
+			throw std::runtime_error("callback failed");
+		}
+
+		documents.push_back(std::move(document));
+	};
+	const std::vector<service::SubscriptionKey> keys {
+		subscribe(callback),
+		subscribe(callback),
+		subscribe(callback),
+	};
+
+	EXPECT_THROW(_mockService->service->deliver({ "nextAppointmentChange"sv }).get(),
+		std::runtime_error)
+		<< "should rethrow the exception from the callback";
+
+	for (const auto key : keys)
+	{
+		_mockService->service->unsubscribe({ key }).get();
+	}
+
+	EXPECT_EQ(size_t { 3 }, calls) << "should call every subscription in the group";
+	ASSERT_EQ(size_t { 2 }, documents.size()) << "should deliver to the rest of the group";
+	EXPECT_TRUE(documents.front() == documents.back()) << "should deliver the same payload";
+}
+
+TEST_F(TodayServiceCase, ReuseCompiledPlanWithVariables)
+{
+	auto query = R"(query Appointments($skipSubject: Boolean!, $first: Int) {
+			appointments(first: $first) {
+				edges {
+					node {
+						id
+						subject @skip(if: $skipSubject)
+						isNow @include(if: true)
+						when @skip(if: true)
+					}
+				}
+			}
+		})"_graphql;
+	const auto resolve = [this, &query](bool skipSubject) {
+		response::Value variables(response::Type::Map);
+
+		variables.emplace_back("skipSubject", response::Value(skipSubject));
+		variables.emplace_back("first", response::Value(1));
+
+		return _mockService->service
+			->resolve({ query,
+				"Appointments"sv,
+				std::move(variables),
+				{},
+				std::make_shared<today::RequestState>(25) })
+			.get();
+	};
+	const auto getNode = [](const response::Value& result) {
+		const auto data = service::ScalarArgument::require("data", result);
+		const auto appointments = service::ScalarArgument::require("appointments", data);
+		const auto edges =
+			service::ScalarArgument::require<service::TypeModifier::List>("edges", appointments);
+
+		EXPECT_EQ(size_t { 1 }, edges.size()) << "appointments should have 1 entry";
+
+		return service::ScalarArgument::require("node", edges.front());
+	};
+
+	try
+	{
+		const auto included = resolve(false);
+
+		ASSERT_TRUE(query.plan) << "compiled plans should be cached with the validated query";
+
+		const auto skipped = resolve(true);
+		const auto includedNode = getNode(included);
+		const auto skippedNode = getNode(skipped);
+
+		EXPECT_TRUE(service::ScalarArgument::find("subject", includedNode).second)
+			<< "subject should be included";
+		EXPECT_FALSE(service::ScalarArgument::find("subject", skippedNode).second)
+			<< "subject should be skipped";
+		EXPECT_TRUE(service::ScalarArgument::find("isNow", skippedNode).second)
+			<< "isNow should always be included";
+		EXPECT_FALSE(service::ScalarArgument::find("when", includedNode).second)
+			<< "when should always be skipped";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST_F(TodayServiceCase, RejectOperationOverCostLimit)
+{
+	auto query = R"(query Appointments($first: Int) {
+			appointments(first: $first) {
+				edges {
+					node {
+						id
+						subject
+						__typename
+					}
+				}
+			}
+		})"_graphql;
+	auto limits = std::make_shared<service::CostLimits>();
+
+	// appointments + edges + (id + subject) * first
+	limits->maxCost = 100;
+	_mockService->service->setCostLimits(std::move(limits));
+
+	const auto resolve = [this, &query](int first) {
+		response::Value variables(response::Type::Map);
+
+		variables.emplace_back("first", response::Value(first));
+
+		auto state = std::make_shared<today::RequestState>(26);
+		auto result = _mockService->service
+						  ->resolve({ query, "Appointments"sv, std::move(variables), {}, state })
+						  .get();
+
+		return std::make_pair(std::move(result), state->loadAppointmentsCount);
+	};
+
+	try
+	{
+		const auto [allowed, allowedLoads] = resolve(49);
+
+		ASSERT_TRUE(allowed.type() == response::Type::Map);
+		auto errorsItr = allowed.find("errors");
+		if (errorsItr != allowed.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(errorsItr->second));
+		}
+		EXPECT_EQ(size_t { 1 }, allowedLoads) << "today service called the loader once";
+
+		const auto [rejected, rejectedLoads] = resolve(50);
+
+		ASSERT_TRUE(rejected.type() == response::Type::Map);
+		errorsItr = rejected.find("errors");
+		if (errorsItr == rejected.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(rejected)) << "no errors returned";
+		}
+
+		auto errorsString = response::toJSON(response::Value(errorsItr->second));
+		EXPECT_EQ(
+			R"js([{"message":"Operation cost exceeds the limit: 100","locations":[{"line":1,"column":1}]}])js",
+			errorsString)
+			<< "error should match";
+		EXPECT_EQ(size_t { 0 }, rejectedLoads) << "today service did not call the loader";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST_F(TodayServiceCase, RejectDefaultedSizeOverCostLimit)
+{
+	auto query = R"(query Appointments($first: Int = 100000) {
+			appointments(first: $first) {
+				edges {
+					node {
+						id
+						subject
+					}
+				}
+			}
+		})"_graphql;
+	auto limits = std::make_shared<service::CostLimits>();
+
+	limits->maxCost = 100;
+	_mockService->service->setCostLimits(std::move(limits));
+
+	auto state = std::make_shared<today::RequestState>(34);
+	auto result = _mockService->service
+					  ->resolve({ query,
+						  "Appointments"sv,
+						  response::Value(response::Type::Map),
+						  {},
+						  state })
+					  .get();
+
+	try
+	{
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		auto errorsItr = result.find("errors");
+		if (errorsItr == result.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(result)) << "no errors returned";
+		}
+
+		auto errorsString = response::toJSON(response::Value(errorsItr->second));
+		EXPECT_EQ(
+			R"js([{"message":"Operation cost exceeds the limit: 100","locations":[{"line":1,"column":1}]}])js",
+			errorsString)
+			<< "error should match";
+		EXPECT_EQ(size_t { 0 }, state->loadAppointmentsCount)
+			<< "today service did not call the loader";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST_F(TodayServiceCase, CancelRequestBeforeResolvingFields)
+{
+	auto query = peg::parseString(R"({ appointments { edges { node { id } } } })");
+	std::stop_source stopSource;
+
+	stopSource.request_stop();
+
+	auto state = std::make_shared<today::RequestState>(27);
+	auto result = _mockService->service
+					  ->resolve({ query,
+						  {},
+						  response::Value(response::Type::Map),
+						  {},
+						  state,
+						  {},
+						  { stopSource.get_token() } })
+					  .get();
+
+	EXPECT_EQ(size_t { 0 }, state->loadAppointmentsCount) << "today service did not call the loader";
+
+	try
+	{
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		auto errorsItr = result.find("errors");
+		if (errorsItr == result.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(result)) << "no errors returned";
+		}
+
+		auto errorsString = response::toJSON(response::Value(errorsItr->second));
+		EXPECT_EQ(
+			R"js([{"message":"Request cancelled","locations":[{"line":1,"column":3}],"path":["appointments"]}])js",
+			errorsString)
+			<< "error should match";
+
+		const auto data = service::ScalarArgument::require("data", result);
+		const auto appointmentsItr = data.find("appointments");
+
+		ASSERT_TRUE(appointmentsItr != data.get<response::MapType>().cend())
+			<< "appointments should be in the response";
+		EXPECT_TRUE(appointmentsItr->second.type() == response::Type::Null)
+			<< "appointments should be null";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST_F(TodayServiceCase, ExpiredDeadlineSkipsFields)
+{
+	auto query = peg::parseString(R"({ appointments { edges { node { id } } } })");
+	auto result = _mockService->service
+					  ->resolve({ query,
+						  {},
+						  response::Value(response::Type::Map),
+						  {},
+						  std::make_shared<today::RequestState>(28),
+						  {},
+						  { {}, std::chrono::steady_clock::now() } })
+					  .get();
+
+	try
+	{
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		auto errorsItr = result.find("errors");
+		if (errorsItr == result.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(result)) << "no errors returned";
+		}
+
+		auto errorsString = response::toJSON(response::Value(errorsItr->second));
+		EXPECT_EQ(
+			R"js([{"message":"Request deadline exceeded","locations":[{"line":1,"column":3}],"path":["appointments"]}])js",
+			errorsString)
+			<< "error should match";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST_F(TodayServiceCase, TraceFieldResolvers)
+{
+	auto query = peg::parseString(R"({ appointments { edges { node { id } } } })");
+	auto histogram = std::make_shared<service::FieldLatencyHistogram>();
+	auto instrumentation = std::make_shared<service::TracingInstrumentation>(histogram, true);
+	auto result = _mockService->service
+					  ->resolve({ query,
+						  {},
+						  response::Value(response::Type::Map),
+						  {},
+						  std::make_shared<today::RequestState>(29),
+						  {},
+						  {},
+						  instrumentation })
+					  .get();
+
+	try
+	{
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		auto errorsItr = result.find("errors");
+		if (errorsItr != result.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(errorsItr->second));
+		}
+
+		const auto latencies = histogram->getLatencies();
+		const auto itrQuery = latencies.find("Query");
+		const auto itrAppointment = latencies.find("Appointment");
+
+		ASSERT_TRUE(itrQuery != latencies.end()) << "Query fields should be measured";
+		ASSERT_TRUE(itrAppointment != latencies.end()) << "Appointment fields should be measured";
+		EXPECT_EQ(size_t { 1 }, itrQuery->second.at("appointments").count)
+			<< "appointments should be measured once";
+		EXPECT_EQ(size_t { 1 }, itrAppointment->second.at("id").count)
+			<< "id should be measured once";
+
+		const auto extensions = service::ScalarArgument::require("extensions", result);
+		const auto tracing = service::ScalarArgument::require("tracing", extensions);
+		const auto execution = service::ScalarArgument::require("execution", tracing);
+		const auto resolvers =
+			service::ScalarArgument::require<service::TypeModifier::List>("resolvers", execution);
+
+		EXPECT_TRUE(service::ScalarArgument::find("validation", tracing).second)
+			<< "validation should be traced";
+		ASSERT_EQ(size_t { 4 }, resolvers.size())
+			<< "appointments, edges, node, and id should be traced";
+
+		const auto itrId =
+			std::find_if(resolvers.cbegin(), resolvers.cend(), [](const response::Value& entry) {
+				return service::StringArgument::require("fieldName", entry) == "id";
+			});
+
+		ASSERT_TRUE(itrId != resolvers.cend()) << "id should be traced";
+		EXPECT_EQ("Appointment", service::StringArgument::require("parentType", *itrId))
+			<< "id should belong to Appointment";
+		EXPECT_EQ(R"js(["appointments","edges",0,"node","id"])js",
+			response::toJSON(service::ScalarArgument::require("path", *itrId)))
+			<< "path should match";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST_F(TodayServiceCase, CacheIntrospection)
+{
+	const auto schema = today::GetSchema();
+	const auto cache = introspection::ObjectCache::get(*schema);
+
+	ASSERT_EQ(cache, introspection::ObjectCache::get(*schema)) << "should reuse the object cache";
+	EXPECT_EQ(introspection::Schema { schema }.getTypes(), introspection::Schema { schema }.getTypes())
+		<< "should share the type wrappers";
+
+	constexpr auto queryText = R"({
+			__schema {
+				types {
+					kind
+					name
+					fields(includeDeprecated: true) {
+						name
+						type {
+							kind
+							name
+							ofType {
+								kind
+								name
+							}
+						}
+					}
+				}
+			}
+			__type(name: "Appointment") {
+				name
+			}
+		})"sv;
+	service::DocumentCache documentCache { _mockService->service };
+	const auto document = documentCache.getDocument(queryText);
+
+	_mockService->service->setCacheIntrospection(true);
+
+	auto query = document->query;
+	auto first = _mockService->service->resolve({ query }).get();
+	auto second = _mockService->service->resolve({ query }).get();
+	auto third = _mockService->service->resolve({ query }).get();
+	std::ostringstream stream;
+	const auto writer = response::makeJSONWriter(stream);
+
+	_mockService->service->resolve({ query }, writer).get();
+
+	try
+	{
+		ASSERT_TRUE(first.type() == response::Type::Map);
+		auto errorsItr = first.find("errors");
+		if (errorsItr != first.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(errorsItr->second));
+		}
+		const auto data = service::ScalarArgument::require("data", first);
+		const auto types = service::ScalarArgument::require<service::TypeModifier::List>("types",
+			service::ScalarArgument::require("__schema", data));
+		const auto type = service::ScalarArgument::require("__type", data);
+
+		EXPECT_EQ(schema->types().size(), types.size()) << "should return every type";
+		EXPECT_EQ("Appointment", service::StringArgument::require("name", type))
+			<< "should find the type by name";
+		EXPECT_EQ(&second.find("data")->second.get<response::MapType>(),
+			&third.find("data")->second.get<response::MapType>())
+			<< "should share the cached data instead of copying it";
+		EXPECT_EQ(response::toJSON(response::Value { first }), stream.str())
+			<< "should stream the same response from the cache";
+		EXPECT_EQ(response::toJSON(std::move(first)), response::toJSON(std::move(second)))
+			<< "should return the same response from the cache";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+// The resolvers may allocate from any of the worker threads, so the counters are atomic.
+class CountingMemoryResource : public std::pmr::memory_resource
+{
+public:
+	std::atomic<size_t> allocations = 0;
+	std::atomic<size_t> outstanding = 0;
+
+private:
+	void* do_allocate(size_t bytes, size_t alignment) override
+	{
+		++allocations;
+		outstanding += bytes;
+
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void* ptr, size_t bytes, size_t alignment) override
+	{
+		outstanding -= bytes;
+		std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+	{
+		return this == &other;
+	}
+};
+
+TEST_F(TodayServiceCase, ResolveWithMemoryResource)
+{
+	auto query = peg::parseString(R"({
+			appointments {
+				edges {
+					node {
+						id
+						subject
+						when
+					}
+				}
+			}
+		})");
+	CountingMemoryResource memoryResource;
+	auto result = _mockService->service
+					  ->resolve({ query,
+						  {},
+						  response::Value(response::Type::Map),
+						  {},
+						  std::make_shared<today::RequestState>(30),
+						  {},
+						  {},
+						  {},
+						  0,
+						  &memoryResource })
+					  .get();
+
+	EXPECT_LT(size_t { 0 }, memoryResource.allocations.load())
+		<< "should allocate from the resource";
+	EXPECT_EQ(size_t { 0 }, memoryResource.outstanding.load())
+		<< "should release everything it allocated";
+
+	try
+	{
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		auto errorsItr = result.find("errors");
+		if (errorsItr != result.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(errorsItr->second));
+		}
+		const auto data = service::ScalarArgument::require("data", result);
+		const auto appointments = service::ScalarArgument::require("appointments", data);
+		const auto edges =
+			service::ScalarArgument::require<service::TypeModifier::List>("edges", appointments);
+
+		ASSERT_EQ(size_t { 1 }, edges.size()) << "appointments should have 1 entry";
+		const auto node = service::ScalarArgument::require("node", edges[0]);
+		EXPECT_EQ(today::getFakeAppointmentId(), service::IdArgument::require("id", node))
+			<< "id should match in base64 encoding";
+		EXPECT_EQ("Lunch?", service::StringArgument::require("subject", node))
+			<< "subject should match";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST_F(TodayServiceCase, ResolveWithMemoryResourceOnWorkerPool)
+{
+	auto query = peg::parseString(R"({
+			appointments {
+				edges {
+					node {
+						id
+						subject
+						when
+					}
+				}
+			}
+			tasks {
+				edges {
+					node {
+						id
+						title
+						isComplete
+					}
+				}
+			}
+			unreadCounts {
+				edges {
+					node {
+						name
+						unreadCount
+					}
+				}
+			}
+		})");
+	const auto expected = response::toJSON(
+		_mockService->service
+			->resolve({ query, {}, {}, {}, std::make_shared<today::RequestState>(39) })
+			.get());
+	CountingMemoryResource memoryResource;
+	auto result = _mockService->service
+					  ->resolve({ query,
+						  {},
+						  response::Value(response::Type::Map),
+						  service::await_async { std::make_shared<service::await_worker_pool>(4) },
+						  std::make_shared<today::RequestState>(40),
+						  {},
+						  {},
+						  {},
+						  0,
+						  &memoryResource })
+					  .get();
+
+	EXPECT_LT(size_t { 0 }, memoryResource.allocations.load())
+		<< "should allocate from the resource";
+	EXPECT_EQ(size_t { 0 }, memoryResource.outstanding.load())
+		<< "should release everything it allocated on every thread";
+	EXPECT_EQ(expected, response::toJSON(std::move(result)))
+		<< "should resolve the same result as the default resource";
+}
+
+service::SelectionSetParams makeScalarParams(const std::shared_ptr<service::RequestState>& state,
+	const service::Directives& directives, service::await_async launch,
+	std::pmr::memory_resource* memoryResource = nullptr)
+{
+	return { service::ResolverContext::Query,
+		state,
+		directives,
+		{},
+		{},
+		{},
+		std::make_optional(
+			service::field_path { std::nullopt, service::path_segment { "value"sv } }),
+		std::move(launch),
+		nullptr,
+		nullptr,
+		nullptr,
+		0,
+		memoryResource };
+}
+
+TEST(ScalarCase, ReadyScalarSkipsCoroutineFrame)
+{
+	auto query = R"({ value })"_graphql;
+	const service::FragmentMap fragments;
+	const response::Value variables(response::Type::Map);
+	const std::shared_ptr<service::RequestState> state;
+	const service::Directives directives;
+	CountingMemoryResource memoryResource;
+	const auto syncParams = makeScalarParams(state, directives, {}, &memoryResource);
+	const auto pooledParams = makeScalarParams(state,
+		directives,
+		service::await_async { std::make_shared<service::await_worker_pool>(2) },
+		&memoryResource);
+	const auto makeParams = [&](const service::SelectionSetParams& selectionSetParams) {
+		return service::ResolverParams { selectionSetParams,
+			*query.root,
+			"value"s,
+			response::Value(response::Type::Map),
+			{},
+			nullptr,
+			fragments,
+			variables };
+	};
+
+	auto value = service::IntResult::convert(5, makeParams(syncParams));
+	auto optionalValue = service::StringResult::convert<service::TypeModifier::Nullable>(
+		std::make_optional("ready"s),
+		makeParams(syncParams));
+
+	EXPECT_TRUE(value.await_ready()) << "should already be ready";
+	EXPECT_TRUE(optionalValue.await_ready()) << "should already be ready";
+	EXPECT_EQ(size_t { 0 }, memoryResource.allocations.load())
+		<< "should not allocate a coroutine frame";
+
+	auto pooled = service::IntResult::convert(5, makeParams(pooledParams));
+
+	EXPECT_LT(size_t { 0 }, memoryResource.allocations.load())
+		<< "should still allocate a frame to hop to the worker pool";
+	EXPECT_EQ(5, value.get().data.get<int>()) << "should convert the value";
+	EXPECT_EQ("ready", optionalValue.get().data.get<std::string>()) << "should convert the value";
+	EXPECT_EQ(5, pooled.get().data.get<int>()) << "should convert the value on the worker pool";
+}
+
+TEST(ScalarCase, FutureExceptionKeepsErrorShape)
+{
+	auto query = R"({ value })"_graphql;
+	const service::FragmentMap fragments;
+	const response::Value variables(response::Type::Map);
+	const std::shared_ptr<service::RequestState> state;
+	const service::Directives directives;
+	const auto syncParams = makeScalarParams(state, directives, {});
+	const auto pooledParams = makeScalarParams(state,
+		directives,
+		service::await_async { std::make_shared<service::await_worker_pool>(2) });
+	const auto makeParams = [&](const service::SelectionSetParams& selectionSetParams) {
+		return service::ResolverParams { selectionSetParams,
+			*query.root,
+			"value"s,
+			response::Value(response::Type::Map),
+			{},
+			nullptr,
+			fragments,
+			variables };
+	};
+	const auto makeFailedFuture = []<typename T>(std::in_place_type_t<T>) {
+		std::promise<T> promise;
+
+		promise.set_exception(std::make_exception_ptr(std::runtime_error { "getter failed" }));
+
+		return promise.get_future();
+	};
+
+	// The future is already failed, so the synchronous launch takes the fast path.
+	auto ready = service::IntResult::convert(makeFailedFuture(std::in_place_type<int>),
+		makeParams(syncParams))
+					 .get();
+	auto pooled = service::IntResult::convert(makeFailedFuture(std::in_place_type<int>),
+		makeParams(pooledParams))
+					  .get();
+
+	EXPECT_TRUE(ready.data.type() == response::Type::Null) << "should not return any data";
+	EXPECT_TRUE(pooled.data.type() == response::Type::Null) << "should not return any data";
+	EXPECT_EQ(response::toJSON(service::schema_exception { std::move(pooled.errors) }.getErrors()),
+		response::toJSON(service::schema_exception { std::move(ready.errors) }.getErrors()))
+		<< "should report the same error on either path";
+
+	auto readyOptional = service::IntResult::convert<service::TypeModifier::Nullable>(
+		makeFailedFuture(std::in_place_type<std::optional<int>>),
+		makeParams(syncParams));
+	auto pooledOptional = service::IntResult::convert<service::TypeModifier::Nullable>(
+		makeFailedFuture(std::in_place_type<std::optional<int>>),
+		makeParams(pooledParams));
+
+	EXPECT_THROW(static_cast<void>(readyOptional.get()), std::runtime_error)
+		<< "should rethrow the exception for the parent to report";
+	EXPECT_THROW(static_cast<void>(pooledOptional.get()), std::runtime_error)
+		<< "should rethrow the exception for the parent to report";
+}
+
+struct ManualLaunch
+{
+	std::vector<coro::coroutine_handle<>> pending;
+
+	bool await_ready() const noexcept
+	{
+		return false;
+	}
+
+	void await_suspend(coro::coroutine_handle<> h)
+	{
+		pending.push_back(h);
+	}
+
+	void await_resume() const noexcept
+	{
+	}
+
+	void resumeAll()
+	{
+		while (!pending.empty())
+		{
+			auto h = pending.back();
+
+			pending.pop_back();
+			h.resume();
+		}
+	}
+};
+
+// The getter starts a coroutine which keeps running after the request has finished with its memory
+// resource.
+class KeepCoroutineQuery
+{
+public:
+	explicit KeepCoroutineQuery(ManualLaunch& launch) noexcept
+		: _launch { launch }
+	{
+	}
+
+	std::optional<std::string> getDefault(service::FieldParams&& params)
+	{
+		kept.emplace(keepRunning(std::move(params)));
+
+		return "Default"s;
+	}
+
+	std::optional<internal::Awaitable<void>> kept;
+
+private:
+	internal::Awaitable<void> keepRunning(service::FieldParams params)
+	{
+		co_await _launch;
+	}
+
+	ManualLaunch& _launch;
+};
+
+TEST(MemoryResourceCase, GetterCoroutineOutlivesRequest)
+{
+	ManualLaunch launch;
+	auto query = std::make_shared<KeepCoroutineQuery>(launch);
+	auto service = std::make_shared<today::Operations>(std::make_shared<today::object::Query>(query),
+		nullptr,
+		nullptr);
+	auto request = R"({ default })"_graphql;
+	std::optional<CountingMemoryResource> memoryResource { std::in_place };
+	auto result = service
+					  ->resolve({ request,
+						  {},
+						  response::Value(response::Type::Map),
+						  {},
+						  {},
+						  {},
+						  {},
+						  {},
+						  0,
+						  &*memoryResource })
+					  .get();
+
+	EXPECT_LT(size_t { 0 }, memoryResource->allocations.load())
+		<< "should allocate the executor frames from the resource";
+	EXPECT_EQ(size_t { 0 }, memoryResource->outstanding.load())
+		<< "should not allocate the getter coroutine from the resource";
+
+	memoryResource.reset();
+
+	ASSERT_TRUE(query->kept) << "should start the getter coroutine";
+	EXPECT_FALSE(query->kept->await_ready()) << "should still be waiting";
+	EXPECT_EQ(size_t { 1 }, launch.pending.size()) << "should still be waiting";
+
+	launch.resumeAll();
+
+	EXPECT_TRUE(query->kept->await_ready()) << "should finish after the request";
+	query->kept.reset();
+
+	const auto data = service::ScalarArgument::require("data", result);
+
+	EXPECT_EQ("Default", service::StringArgument::require("default", data))
+		<< "default should match";
+}
+
+TEST_F(TodayServiceCase, CoalesceIdenticalRequests)
+{
+	auto query = peg::parseString(R"(query Appointments($first: Int, $after: ItemCursor) {
+			appointments(first: $first, after: $after) {
+				edges {
+					node {
+						id
+						subject
+					}
+				}
+			}
+		})");
+	service::RequestCoalescer coalescer { _mockService->service };
+	auto launch = std::make_shared<ManualLaunch>();
+	response::Value variables(response::Type::Map);
+	response::Value reordered(response::Type::Map);
+
+	variables.emplace_back("first", response::Value(1));
+	variables.emplace_back("after", response::Value());
+	reordered.emplace_back("after", response::Value());
+	reordered.emplace_back("first", response::Value(1));
+
+	auto first = coalescer.resolve("Appointments"sv,
+		"user"sv,
+		{ query,
+			{},
+			std::move(variables),
+			service::await_async { launch },
+			std::make_shared<today::RequestState>(31) });
+	auto secondLaunch = std::make_shared<ManualLaunch>();
+	auto second = coalescer.resolve("Appointments"sv,
+		"user"sv,
+		{ query,
+			{},
+			std::move(reordered),
+			service::await_async { secondLaunch },
+			std::make_shared<today::RequestState>(32) });
+	response::Value otherVariables(response::Type::Map);
+
+	otherVariables.emplace_back("first", response::Value(1));
+	otherVariables.emplace_back("after", response::Value());
+
+	auto other = coalescer.resolve("Appointments"sv,
+		"other user"sv,
+		{ query, {}, std::move(otherVariables), {}, std::make_shared<today::RequestState>(33) });
+
+	EXPECT_TRUE(other.await_ready()) << "a different partition should resolve on its own";
+	EXPECT_FALSE(second.await_ready()) << "the identical request should wait for the first one";
+
+	auto stats = coalescer.getStats();
+
+	EXPECT_EQ(size_t { 2 }, stats.resolved) << "should resolve each partition";
+	EXPECT_EQ(size_t { 1 }, stats.coalesced) << "should coalesce the identical request";
+	EXPECT_EQ(size_t { 1 }, stats.inFlight) << "should still be resolving the first request";
+
+	launch->resumeAll();
+
+	EXPECT_TRUE(first.await_ready()) << "the first request should finish on its own launch";
+	EXPECT_FALSE(second.await_ready()) << "the identical request should resume on its own launch";
+	EXPECT_EQ(size_t { 0 }, coalescer.getStats().inFlight) << "should finish every request";
+
+	secondLaunch->resumeAll();
+
+	auto firstResult = first.get();
+	auto secondResult = second.get();
+	auto otherResult = other.get();
+
+	try
+	{
+		ASSERT_TRUE(firstResult.type() == response::Type::Map);
+		auto errorsItr = firstResult.find("errors");
+		if (errorsItr != firstResult.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(errorsItr->second));
+		}
+		const auto data = service::ScalarArgument::require("data", firstResult);
+		const auto appointments = service::ScalarArgument::require("appointments", data);
+		const auto edges =
+			service::ScalarArgument::require<service::TypeModifier::List>("edges", appointments);
+
+		ASSERT_EQ(size_t { 1 }, edges.size()) << "appointments should have 1 entry";
+		EXPECT_EQ(response::toJSON(response::Value(firstResult)),
+			response::toJSON(std::move(secondResult)))
+			<< "should share the result with the identical request";
+		EXPECT_EQ(response::toJSON(std::move(firstResult)), response::toJSON(std::move(otherResult)))
+			<< "should resolve the same result for the other partition";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST_F(TodayServiceCase, CoalescerCancelsOnlyItsOwnWait)
+{
+	auto query = peg::parseString(R"(query {
+			appointments {
+				edges {
+					node {
+						id
+					}
+				}
+			}
+		})");
+	service::RequestCoalescer coalescer { _mockService->service };
+	auto launch = std::make_shared<ManualLaunch>();
+	std::stop_source stop;
+
+	auto first = coalescer.resolve("Appointments"sv,
+		"user"sv,
+		{ query,
+			{},
+			response::Value { response::Type::Map },
+			service::await_async { launch },
+			std::make_shared<today::RequestState>(35),
+			{},
+			service::RequestCancellation { stop.get_token() } });
+	auto second = coalescer.resolve("Appointments"sv,
+		"user"sv,
+		{ query,
+			{},
+			response::Value { response::Type::Map },
+			{},
+			std::make_shared<today::RequestState>(36) });
+
+	ASSERT_FALSE(first.await_ready()) << "the first request should be waiting for its launch";
+	ASSERT_FALSE(second.await_ready()) << "the identical request should wait for the first one";
+
+	stop.request_stop();
+	launch->resumeAll();
+
+	auto firstResult = first.get();
+	auto secondResult = second.get();
+
+	EXPECT_EQ(size_t { 0 }, coalescer.getStats().inFlight) << "should finish the shared request";
+
+	try
+	{
+		ASSERT_TRUE(firstResult.type() == response::Type::Map);
+		const auto firstErrors = service::ScalarArgument::require<service::TypeModifier::List>(
+			"errors",
+			firstResult);
+
+		ASSERT_EQ(size_t { 1 }, firstErrors.size()) << "the cancelled request should get 1 error";
+		EXPECT_EQ("Request cancelled",
+			service::StringArgument::require("message", firstErrors.front()))
+			<< "should report its own cancellation";
+
+		ASSERT_TRUE(secondResult.type() == response::Type::Map);
+		auto errorsItr = secondResult.find("errors");
+		if (errorsItr != secondResult.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(errorsItr->second));
+		}
+		const auto data = service::ScalarArgument::require("data", secondResult);
+		const auto appointments = service::ScalarArgument::require("appointments", data);
+		const auto edges =
+			service::ScalarArgument::require<service::TypeModifier::List>("edges", appointments);
+
+		EXPECT_EQ(size_t { 1 }, edges.size()) << "the other request should still get the result";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST_F(TodayServiceCase, CoalescerStopsWaitingAtItsDeadline)
+{
+	auto query = peg::parseString(R"(query {
+			appointments {
+				edges {
+					node {
+						id
+					}
+				}
+			}
+		})");
+	service::RequestCoalescer coalescer { _mockService->service };
+	auto launch = std::make_shared<ManualLaunch>();
+
+	auto first = coalescer.resolve("Appointments"sv,
+		"user"sv,
+		{ query,
+			{},
+			response::Value { response::Type::Map },
+			service::await_async { launch },
+			std::make_shared<today::RequestState>(42) });
+	auto second = coalescer.resolve("Appointments"sv,
+		"user"sv,
+		{ query,
+			{},
+			response::Value { response::Type::Map },
+			{},
+			std::make_shared<today::RequestState>(43),
+			{},
+			service::RequestCancellation { {},
+				std::chrono::steady_clock::now() + std::chrono::milliseconds { 50 } } });
+
+	ASSERT_FALSE(first.await_ready()) << "the first request should be waiting for its launch";
+	ASSERT_FALSE(second.await_ready()) << "the identical request should wait for the first one";
+
+	// The shared resolution is still waiting for its launch, so only the deadline can resume it.
+	auto secondFuture = std::async(std::launch::async, [&second]() {
+		return second.get();
+	});
+	const auto status = secondFuture.wait_for(std::chrono::seconds { 10 });
+
+	EXPECT_EQ(std::future_status::ready, status) << "should stop waiting at its own deadline";
+
+	launch->resumeAll();
+
+	auto firstResult = first.get();
+	auto secondResult = secondFuture.get();
+
+	EXPECT_EQ(size_t { 0 }, coalescer.getStats().inFlight) << "should finish the shared request";
+
+	try
+	{
+		ASSERT_TRUE(secondResult.type() == response::Type::Map);
+		const auto secondErrors = service::ScalarArgument::require<service::TypeModifier::List>(
+			"errors",
+			secondResult);
+
+		ASSERT_EQ(size_t { 1 }, secondErrors.size()) << "the expired request should get 1 error";
+		EXPECT_EQ("Request deadline exceeded",
+			service::StringArgument::require("message", secondErrors.front()))
+			<< "should report its own deadline";
+
+		ASSERT_TRUE(firstResult.type() == response::Type::Map);
+		auto errorsItr = firstResult.find("errors");
+		if (errorsItr != firstResult.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(errorsItr->second));
+		}
+		const auto data = service::ScalarArgument::require("data", firstResult);
+		const auto appointments = service::ScalarArgument::require("appointments", data);
+		const auto edges =
+			service::ScalarArgument::require<service::TypeModifier::List>("edges", appointments);
+
+		EXPECT_EQ(size_t { 1 }, edges.size()) << "the first request should still get the result";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST_F(TodayServiceCase, CoalescerSkipsMutations)
+{
+	auto query = R"(mutation {
+			completeTask(input: {id: "ZmFrZVRhc2tJZA==", isComplete: true}) {
+				clientMutationId
+			}
+		})"_graphql;
+	service::RequestCoalescer coalescer { _mockService->service };
+	auto launch = std::make_shared<ManualLaunch>();
+
+	auto first = coalescer.resolve("CompleteTask"sv,
+		"user"sv,
+		{ query,
+			{},
+			response::Value { response::Type::Map },
+			service::await_async { launch },
+			std::make_shared<today::RequestState>(37) });
+	auto second = coalescer.resolve("CompleteTask"sv,
+		"user"sv,
+		{ query,
+			{},
+			response::Value { response::Type::Map },
+			service::await_async { launch },
+			std::make_shared<today::RequestState>(38) });
+
+	launch->resumeAll();
+
+	const auto stats = coalescer.getStats();
+
+	EXPECT_EQ(size_t { 0 }, stats.resolved) << "should not share a mutation";
+	EXPECT_EQ(size_t { 0 }, stats.coalesced) << "should run each mutation on its own";
+	EXPECT_EQ(response::toJSON(first.get()), response::toJSON(second.get()))
+		<< "should still resolve both mutations";
+}
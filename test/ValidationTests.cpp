@@ -7,7 +7,10 @@
 
 #include "graphqlservice/JSONResponse.h"
 
+#include <atomic>
 #include <chrono>
+#include <thread>
+#include <vector>
 
 using namespace graphql;
 
@@ -2037,3 +2040,49 @@ TEST_F(ValidationExamplesCase, Example187)
 
 	ASSERT_TRUE(errors.empty());
 }
+
+TEST_F(ValidationExamplesCase, ConcurrentValidation)
+{
+	constexpr size_t c_threadCount = 8;
+	constexpr size_t c_iterations = 50;
+	std::vector<std::thread> threads;
+	std::atomic_size_t validCount = 0;
+	std::atomic_size_t errorCount = 0;
+
+	threads.reserve(c_threadCount);
+
+	for (size_t i = 0; i < c_threadCount; ++i)
+	{
+		threads.emplace_back([&validCount, &errorCount]() {
+			for (size_t j = 0; j < c_iterations; ++j)
+			{
+				auto validQuery = R"(query getDogName {
+						dog {
+							name
+						}
+					})"_graphql;
+				auto invalidQuery = R"(query getDogName {
+						dog {
+							name
+							color
+						}
+					})"_graphql;
+
+				if (_service->validate(validQuery).empty())
+				{
+					++validCount;
+				}
+
+				errorCount += _service->validate(invalidQuery).size();
+			}
+		});
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	EXPECT_EQ(c_threadCount * c_iterations, validCount) << "every valid query should pass";
+	EXPECT_EQ(c_threadCount * c_iterations, errorCount) << "every invalid query has 1 error";
+}